@@ -0,0 +1,242 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "lcfr/ecdsa.h"
+#include "lcfr/library_info.h"
+
+// Benchmark of the field, point and ECDSA operations of every curve, printing one JSON document on stdout.
+// Each operation is timed in samples of several calls, the call count of a sample being calibrated so
+// that a sample lasts about SAMPLE_NS; the percentiles are taken over the per-call time of the samples.
+//
+// usage: lcfr_bench [--quick] [curve...]
+
+namespace {
+
+using namespace lcfr;
+
+const char* const SCHEMA = "lcfr-bench/1";
+const double SAMPLE_NS = 20000;
+const size_t MIN_SAMPLES = 10;
+const size_t MAX_SAMPLES = 100000;
+
+double min_time_ns = 200e6;
+
+volatile uint64_t sink;
+
+inline uint64_t read_tsc()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+inline double now_ns()
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct result
+{
+    std::string curve;
+    std::string operation;
+    uint64_t    calls;
+    double      ns_per_op;
+    double      cycles_per_op;
+    double      p50, p90, p99, p999, min, max;
+};
+
+std::vector<result> results;
+
+template <class F>
+void measure(const char* curve, const char* operation, F&& f)
+{
+    // warmup and calibration
+    size_t reps = 1;
+    for (;;)
+    {
+        double t0 = now_ns();
+        for (size_t i = 0; i < reps; i++) f();
+        double t = now_ns() - t0;
+        if (t >= SAMPLE_NS || reps >= (size_t(1) << 24)) break;
+        reps = t < SAMPLE_NS / 64 ? reps * 8 : reps * 2;
+    }
+
+    std::vector<double> samples;
+    double total_ns = 0;
+    uint64_t total_cycles = 0;
+    while ((total_ns < min_time_ns || samples.size() < MIN_SAMPLES) && samples.size() < MAX_SAMPLES)
+    {
+        double t0 = now_ns();
+        uint64_t c0 = read_tsc();
+        for (size_t i = 0; i < reps; i++) f();
+        uint64_t c = read_tsc() - c0;
+        double t = now_ns() - t0;
+        samples.push_back(t / reps);
+        total_ns += t;
+        total_cycles += c;
+    }
+
+    uint64_t calls = uint64_t(samples.size()) * reps;
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&](double q) {
+        size_t i = size_t(q * samples.size());
+        return samples[i < samples.size() ? i : samples.size() - 1];
+    };
+
+    result r;
+    r.curve = curve;
+    r.operation = operation;
+    r.calls = calls;
+    r.ns_per_op = total_ns / calls;
+    r.cycles_per_op = double(total_cycles) / calls;
+    r.p50 = percentile(0.50);
+    r.p90 = percentile(0.90);
+    r.p99 = percentile(0.99);
+    r.p999 = percentile(0.999);
+    r.min = samples.front();
+    r.max = samples.back();
+    results.push_back(r);
+
+    fprintf(stderr, "%-10s %-16s %12.1f ns/op\n", curve, operation, r.ns_per_op);
+}
+
+// deterministic inputs, so that runs are comparable
+struct xorshift
+{
+    uint64_t s = 0x9E3779B97F4A7C15ull;
+
+    void fill(uint8_t* p, size_t n)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+            p[i] = uint8_t(s);
+        }
+    }
+};
+
+template <class Curve>
+void bench_curve(const char* name)
+{
+    typedef ecdsa<Curve>                    front;
+    typedef typename front::cipher_type     cipher;
+    typedef typename cipher::p_ui           p_ui;
+    typedef typename cipher::n_ui           n_ui;
+    typedef typename cipher::ecpp           ecpp;
+
+    const size_t NP = front::PRIME_BYTES;
+    const size_t NC = front::COORDINATE_BYTES;
+    const unsigned NPW = cipher::NPW;
+    const unsigned NNW = cipher::NNW;
+
+    front f;
+    const cipher& c = f.cipher();
+    xorshift rng;
+
+    uint8_t sk[64], ek[64], hash[32], qx[64], qy[64], r[64], s[64];
+    rng.fill(sk, NP);
+    rng.fill(ek, NP);
+    rng.fill(hash, sizeof(hash));
+    f.generate_public_key(qx, qy, sk);
+    f.sign(r, s, hash, sizeof(hash), ek, sk);
+    if (!f.verify(r, s, hash, sizeof(hash), qx, qy))
+    {
+        fprintf(stderr, "%s: signature check failed\n", name);
+        return;
+    }
+
+    // field arithmetic modulo p, on coordinates of the public key
+    const p_ui px(qx, NC), py(qy, NC);
+    p_ui x(px), y(py), z;
+    measure(name, "fp_mult", [&] { c.p_fp_.mult(x, x, y); });
+    measure(name, "fp_square", [&] { c.p_fp_.square(x, x); });
+    measure(name, "fp_inverse", [&] { c.p_fp_.inverse(z, x); c.p_fp_.add(x, x, y); });
+    sink = sink + x[0] + z[0];
+
+    // point arithmetic in projective coordinates
+    n_ui k(sk, NP);
+    ecpp g(c.G.x, c.G.y), p1, p2(px, py), sum;
+    c.mult(p1, g, k, NNW);
+    measure(name, "point_add", [&] { c.add(sum, p1, p2); });
+    measure(name, "point_double", [&] { c.twice(p1, p1); });
+    measure(name, "scalar_mult", [&] { c.mult(sum, g, k, NNW); });
+    sink = sink + sum.x[0] + p1.x[NPW - 1];
+
+    measure(name, "public_key", [&] { f.generate_public_key(qx, qy, sk); });
+    measure(name, "sign", [&] { f.sign(r, s, hash, sizeof(hash), ek, sk); });
+    measure(name, "verify", [&] { sink = sink + f.verify(r, s, hash, sizeof(hash), qx, qy); });
+}
+
+struct curve_entry
+{
+    const char* name;
+    void (*bench)(const char*);
+};
+
+const curve_entry CURVES[] = {
+    { "secp112r1", &bench_curve<secp112r1> },
+    { "secp112r2", &bench_curve<secp112r2> },
+    { "secp128r1", &bench_curve<secp128r1> },
+    { "secp128r2", &bench_curve<secp128r2> },
+    { "secp160k1", &bench_curve<secp160k1> },
+    { "secp160r1", &bench_curve<secp160r1> },
+    { "secp192k1", &bench_curve<secp192k1> },
+    { "secp192r1", &bench_curve<secp192r1> },
+    { "secp256k1", &bench_curve<secp256k1> },
+    { "secp256r1", &bench_curve<secp256r1> }
+};
+
+void print_json()
+{
+    lcfr::LibraryInfo info;
+    printf("{\n");
+    printf("  \"schema\": \"%s\",\n", SCHEMA);
+    printf("  \"version\": \"%s\",\n", info.getVersion());
+    printf("  \"kernels\": \"%s\",\n", info.getActiveKernels());
+    printf("  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const result& r = results[i];
+        printf("    { \"curve\": \"%s\", \"operation\": \"%s\", \"calls\": %llu, "
+            "\"ns_per_op\": %.2f, \"ops_per_s\": %.1f, \"cycles_per_op\": %.1f, "
+            "\"percentiles_ns\": { \"min\": %.2f, \"p50\": %.2f, \"p90\": %.2f, \"p99\": %.2f, \"p999\": %.2f, \"max\": %.2f } }%s\n",
+            r.curve.c_str(), r.operation.c_str(), (unsigned long long)r.calls,
+            r.ns_per_op, 1e9 / r.ns_per_op, r.cycles_per_op,
+            r.min, r.p50, r.p90, r.p99, r.p999, r.max,
+            i + 1 < results.size() ? "," : "");
+    }
+    printf("  ]\n");
+    printf("}\n");
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<const char*> curves;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--quick") == 0) min_time_ns = 20e6;
+        else curves.push_back(argv[i]);
+    }
+
+    for (const curve_entry& e : CURVES)
+    {
+        bool selected = curves.empty();
+        for (const char* name : curves) selected |= strcmp(name, e.name) == 0;
+        if (selected) e.bench(e.name);
+    }
+
+    print_json();
+    return 0;
+}
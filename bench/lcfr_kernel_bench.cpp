@@ -0,0 +1,324 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#ifdef __linux__
+#include <sched.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+#include "lcfr/crypto/mp_arithmetic.h"
+
+// Cycle counts of the mp_arithmetic kernels for every word type and word counts from 2 to 17,
+// printing one JSON document on stdout. A sample times CALLS calls with the TSC; after the warmup
+// samples, the samples beyond the Tukey fence (q3 + 1.5 * iqr) are rejected as interrupted ones.
+// The 32-bit kernels are measured for each of the multiplication and reduction kernel sets
+// supported by the cpu.
+//
+// usage: lcfr_kernel_bench [--cpu N] [--perf]
+//   --cpu N   pins the process on cpu N (default: the current one)
+//   --perf    also reads instructions and cycles through perf_event_open, when the system allows it
+
+namespace {
+
+using namespace lcfr;
+
+const char* const SCHEMA = "lcfr-kernel-bench/1";
+const size_t MIN_WORDS = 2;
+const size_t MAX_WORDS = 17;
+const size_t CALLS = 64;
+const size_t WARMUP_SAMPLES = 100;
+const size_t SAMPLES = 1000;
+
+volatile uint64_t sink;
+
+inline uint64_t read_tsc()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// hardware counters, left closed when perf_event_open is not allowed
+class perf_counters
+{
+    int cycles_ = -1;
+    int instructions_ = -1;
+
+#ifdef __linux__
+    static int open(uint64_t config, int group)
+    {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = group < 0 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+    }
+
+    static uint64_t read_counter(int fd)
+    {
+        uint64_t value = 0;
+        if (::read(fd, &value, sizeof(value)) != sizeof(value)) return 0;
+        return value;
+    }
+#endif
+
+public:
+    bool open()
+    {
+#ifdef __linux__
+        cycles_ = open(PERF_COUNT_HW_CPU_CYCLES, -1);
+        if (cycles_ < 0) return false;
+        instructions_ = open(PERF_COUNT_HW_INSTRUCTIONS, cycles_);
+        if (instructions_ < 0)
+        {
+            close(cycles_);
+            cycles_ = -1;
+            return false;
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool active() const
+    {
+        return cycles_ >= 0;
+    }
+
+    void start()
+    {
+#ifdef __linux__
+        if (!active()) return;
+        ioctl(cycles_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(cycles_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    void stop(uint64_t& cycles, uint64_t& instructions)
+    {
+        cycles = instructions = 0;
+#ifdef __linux__
+        if (!active()) return;
+        ioctl(cycles_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        cycles = read_counter(cycles_);
+        instructions = read_counter(instructions_);
+#endif
+    }
+};
+
+perf_counters perf;
+
+struct result
+{
+    const char* kernel;
+    const char* set;
+    unsigned    word_bits;
+    size_t      words;
+    double      cycles;                 // mean of the kept samples, per call
+    double      median;
+    double      min;
+    size_t      rejected;
+    double      hw_cycles;
+    double      instructions;
+};
+
+std::vector<result> results;
+
+template <class F>
+void measure(const char* kernel, const char* set, unsigned word_bits, size_t words, F&& f)
+{
+    for (size_t i = 0; i < WARMUP_SAMPLES * CALLS; i++) f();
+
+    std::vector<double> samples(SAMPLES);
+    perf.start();
+    for (size_t s = 0; s < SAMPLES; s++)
+    {
+        uint64_t c0 = read_tsc();
+        for (size_t i = 0; i < CALLS; i++) f();
+        samples[s] = double(read_tsc() - c0) / CALLS;
+    }
+    uint64_t hw_cycles, instructions;
+    perf.stop(hw_cycles, instructions);
+
+    std::vector<double> sorted(samples);
+    std::sort(sorted.begin(), sorted.end());
+    double q1 = sorted[SAMPLES / 4];
+    double q3 = sorted[3 * SAMPLES / 4];
+    double fence = q3 + 1.5 * (q3 - q1);
+    double sum = 0;
+    size_t kept = 0;
+    for (double x : samples)
+    {
+        if (x > fence) continue;
+        sum += x;
+        kept++;
+    }
+
+    result r;
+    r.kernel = kernel;
+    r.set = set;
+    r.word_bits = word_bits;
+    r.words = words;
+    r.cycles = sum / kept;
+    r.median = sorted[SAMPLES / 2];
+    r.min = sorted.front();
+    r.rejected = SAMPLES - kept;
+    r.hw_cycles = double(hw_cycles) / (SAMPLES * CALLS);
+    r.instructions = double(instructions) / (SAMPLES * CALLS);
+    results.push_back(r);
+}
+
+template <class W>
+void fill(W* x, size_t n, uint64_t& s)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+        x[i] = W(s);
+    }
+}
+
+template <class W>
+void bench_words(const char* set, size_t n)
+{
+    const unsigned WB = 8 * sizeof(W);
+    uint64_t seed = 0x9E3779B97F4A7C15ull + n;
+
+    std::vector<W> a(4 * n), b(4 * n), x(4 * n), t(6 * n);
+    fill(a.data(), 2 * n, seed);
+    fill(b.data(), 2 * n, seed);
+
+    measure("add", set, WB, n, [&] { sink = sink + add(x.data(), a.data(), b.data(), n); });
+    measure("sub", set, WB, n, [&] { sink = sink + sub(x.data(), a.data(), b.data(), n); });
+    measure("shift_right", set, WB, n, [&] { shift_right(x.data(), a.data(), 13, n); });
+    measure("mult", set, WB, n, [&] { mult(x.data(), a.data(), b.data(), n); });
+    measure("square", set, WB, n, [&] { square(x.data(), a.data(), n); });
+
+    // reduction modulo 2^(n * WB) - m of a 2n-word product, with m of one word (pseudo-Mersenne prime)
+    // and of n - 1 words, r ~ m (1 + m / 2^(n * WB)) having one more word than m
+    std::vector<W> m(n), r(n + 1);
+    for (size_t nm : { size_t(1), n - 1 })
+    {
+        fill(m.data(), nm, seed);
+        fill(r.data(), nm + 1, seed);
+        r[nm] = W(1);
+        measure(nm == 1 ? "barret_m_sparse" : "barret_m_dense", set, WB, n, [&] {
+            barret(x.data(), a.data(), m.data(), r.data(), n, nm, nm + 1, t.data());
+        });
+    }
+
+    // reduction modulo a prime of n * WB - 1 bits, r = 4^(n * WB - 1) / prime
+    std::vector<W> p(n), rp(n);
+    fill(p.data(), n, seed);
+    p[n - 1] = W(p[n - 1] | (W(1) << (WB - 2))) & W(W(-1) >> 1);
+    p[0] |= W(1);
+    fill(rp.data(), n, seed);
+    rp[n - 1] |= W(1) << (WB - 1);
+    std::vector<W> prod(2 * n);
+    fill(prod.data(), 2 * n, seed);
+    prod[2 * n - 1] &= W(-1) >> 2;
+    measure("barret_p", set, WB, n, [&] {
+        barret(x.data(), prod.data(), p.data(), rp.data(), n, n * WB - 1, t.data());
+    });
+}
+
+template <class W>
+void bench_word_inverse(const char* set)
+{
+    const unsigned WB = 8 * sizeof(W);
+    uint64_t seed = 0x9E3779B97F4A7C15ull;
+    W v[16];
+    fill(v, 16, seed);
+    for (W& w : v) w |= W(1);
+    size_t i = 0;
+    measure("inverse", set, WB, 1, [&] { sink = sink + inverse(v[i++ & 15]); });
+    measure("inverse_mod", set, WB, 1, [&] { sink = sink + inverse(v[i & 15], W(v[(i + 1) & 15] | (W(1) << (WB - 1)))); i++; });
+}
+
+template <class W>
+void bench_all(const char* set)
+{
+    for (size_t n = MIN_WORDS; n <= MAX_WORDS; n++) bench_words<W>(set, n);
+    bench_word_inverse<W>(set);
+    fprintf(stderr, "%u-bit words, %s kernels done\n", unsigned(8 * sizeof(W)), set);
+}
+
+bool pin(int cpu)
+{
+#ifdef __linux__
+    if (cpu < 0) cpu = sched_getcpu();
+    if (cpu < 0) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+void print_json(bool pinned)
+{
+    printf("{\n");
+    printf("  \"schema\": \"%s\",\n", SCHEMA);
+    printf("  \"pinned\": %s,\n", pinned ? "true" : "false");
+    printf("  \"perf_counters\": %s,\n", perf.active() ? "true" : "false");
+    printf("  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const result& r = results[i];
+        printf("    { \"kernel\": \"%s\", \"kernels\": \"%s\", \"word_bits\": %u, \"words\": %zu, "
+            "\"cycles_per_call\": %.1f, \"median\": %.1f, \"min\": %.1f, \"rejected\": %zu",
+            r.kernel, r.set, r.word_bits, r.words, r.cycles, r.median, r.min, r.rejected);
+        if (perf.active())
+            printf(", \"hw_cycles_per_call\": %.1f, \"instructions_per_call\": %.1f", r.hw_cycles, r.instructions);
+        printf(" }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    printf("  ]\n");
+    printf("}\n");
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    int cpu = -1;
+    bool use_perf = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--cpu") == 0 && i + 1 < argc) cpu = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--perf") == 0) use_perf = true;
+    }
+
+    bool pinned = pin(cpu);
+    if (!pinned) fprintf(stderr, "cannot pin the process, the results may be noisy\n");
+    if (use_perf && !perf.open()) fprintf(stderr, "perf_event_open not available, hardware counters disabled\n");
+
+    bench_all<uint16_t>("generic");
+
+    const char* selected = get_mp_kernels_name();
+    for (const char* set : { "generic", "int128", "bmi2-adx" })
+    {
+        if (!set_mp_kernels(set)) continue;
+        bench_all<uint32_t>(set);
+    }
+    set_mp_kernels(selected);
+
+    print_json(pinned);
+    return 0;
+}
@@ -46,6 +46,14 @@ public class EcCipher
         byte[] sk)
         throws java.lang.Exception;
     
+    // The ephemeral key is drawn by the library.
+    public native void generateSignatureRandom(
+        byte[] r,
+        byte[] s,
+        byte[] hash,
+        byte[] sk)
+        throws java.lang.Exception;
+    
     public native int verifySignature(
         byte[] r,
         byte[] s,
@@ -54,6 +62,412 @@ public class EcCipher
         byte[] qy)
         throws java.lang.Exception;
     
+    // Message methods: the message is hashed with SHA-256 and the digest signed or verified.
+    
+    public native void signMessage(
+        byte[] r,
+        byte[] s,
+        byte[] message,
+        byte[] ek,
+        byte[] sk)
+        throws java.lang.Exception;
+    
+    public native int verifyMessage(
+        byte[] r,
+        byte[] s,
+        byte[] message,
+        byte[] qx,
+        byte[] qy)
+        throws java.lang.Exception;
+    
+    // Direct buffer overloads: the bytes between position and limit are used in place, the positions are left unchanged.
+    
+    public void getPrime(
+        java.nio.ByteBuffer p)
+        throws java.lang.Exception
+    {
+        getPrimeDirect(
+            p, p.position(), p.remaining());
+    }
+    
+    public void generatePublicKey(
+        java.nio.ByteBuffer qx,
+        java.nio.ByteBuffer qy,
+        java.nio.ByteBuffer sk)
+        throws java.lang.Exception
+    {
+        generatePublicKeyDirect(
+            qx, qx.position(), qx.remaining(),
+            qy, qy.position(), qy.remaining(),
+            sk, sk.position(), sk.remaining());
+    }
+    
+    public void generateSignature(
+        java.nio.ByteBuffer r,
+        java.nio.ByteBuffer s,
+        java.nio.ByteBuffer hash,
+        java.nio.ByteBuffer ek,
+        java.nio.ByteBuffer sk)
+        throws java.lang.Exception
+    {
+        generateSignatureDirect(
+            r, r.position(), r.remaining(),
+            s, s.position(), s.remaining(),
+            hash, hash.position(), hash.remaining(),
+            ek, ek.position(), ek.remaining(),
+            sk, sk.position(), sk.remaining());
+    }
+    
+    public int verifySignature(
+        java.nio.ByteBuffer r,
+        java.nio.ByteBuffer s,
+        java.nio.ByteBuffer hash,
+        java.nio.ByteBuffer qx,
+        java.nio.ByteBuffer qy)
+        throws java.lang.Exception
+    {
+        return verifySignatureDirect(
+            r, r.position(), r.remaining(),
+            s, s.position(), s.remaining(),
+            hash, hash.position(), hash.remaining(),
+            qx, qx.position(), qx.remaining(),
+            qy, qy.position(), qy.remaining());
+    }
+    
+    private native void getPrimeDirect(
+        java.nio.ByteBuffer p,
+        int p_offset,
+        int p_size)
+        throws java.lang.Exception;
+    
+    private native void generatePublicKeyDirect(
+        java.nio.ByteBuffer qx,
+        int qx_offset,
+        int qx_size,
+        java.nio.ByteBuffer qy,
+        int qy_offset,
+        int qy_size,
+        java.nio.ByteBuffer sk,
+        int sk_offset,
+        int sk_size)
+        throws java.lang.Exception;
+    
+    private native void generateSignatureDirect(
+        java.nio.ByteBuffer r,
+        int r_offset,
+        int r_size,
+        java.nio.ByteBuffer s,
+        int s_offset,
+        int s_size,
+        java.nio.ByteBuffer hash,
+        int hash_offset,
+        int hash_size,
+        java.nio.ByteBuffer ek,
+        int ek_offset,
+        int ek_size,
+        java.nio.ByteBuffer sk,
+        int sk_offset,
+        int sk_size)
+        throws java.lang.Exception;
+    
+    private native int verifySignatureDirect(
+        java.nio.ByteBuffer r,
+        int r_offset,
+        int r_size,
+        java.nio.ByteBuffer s,
+        int s_offset,
+        int s_size,
+        java.nio.ByteBuffer hash,
+        int hash_offset,
+        int hash_size,
+        java.nio.ByteBuffer qx,
+        int qx_offset,
+        int qx_size,
+        java.nio.ByteBuffer qy,
+        int qy_offset,
+        int qy_size)
+        throws java.lang.Exception;
+    
+    // Batch methods: each array holds count elements of the same size one after the other,
+    // the whole batch being processed by a single native call. A direct IntBuffer of results must use the native byte order.
+    
+    public native void generateSignatures(
+        byte[] r,
+        byte[] s,
+        byte[] hash,
+        byte[] ek,
+        byte[] sk,
+        int count)
+        throws java.lang.Exception;
+    
+    public native void verifySignatures(
+        int[] results,
+        byte[] r,
+        byte[] s,
+        byte[] hash,
+        byte[] qx,
+        byte[] qy,
+        int count)
+        throws java.lang.Exception;
+    
+    // The messages of a batch are stored one after the other in messages, message_sizes giving their sizes.
+    
+    public native void signMessages(
+        byte[] r,
+        byte[] s,
+        byte[] messages,
+        int[] message_sizes,
+        byte[] ek,
+        byte[] sk,
+        int count)
+        throws java.lang.Exception;
+    
+    public native void verifyMessages(
+        int[] results,
+        byte[] r,
+        byte[] s,
+        byte[] messages,
+        int[] message_sizes,
+        byte[] qx,
+        byte[] qy,
+        int count)
+        throws java.lang.Exception;
+    
+    // SEC1 public keys: 0x02 or 0x03 and qx when compressed, 0x04, qx and qy otherwise.
+    
+    public native int encodePublicKey(
+        byte[] q,
+        byte[] qx,
+        byte[] qy,
+        boolean compressed)
+        throws java.lang.Exception;
+    
+    public native void decodePublicKey(
+        byte[] qx,
+        byte[] qy,
+        byte[] q)
+        throws java.lang.Exception;
+    
+    public native void decodePublicKeys(
+        int[] results,
+        byte[] qx,
+        byte[] qy,
+        byte[] q,
+        int count)
+        throws java.lang.Exception;
+    
+    // Recoverable signatures: the returned recovery id selects the point of the signature,
+    // so that recoverPublicKey computes the public key from the signature and the hash.
+    
+    public native int generateRecoverableSignature(
+        byte[] r,
+        byte[] s,
+        byte[] hash,
+        byte[] ek,
+        byte[] sk)
+        throws java.lang.Exception;
+    
+    public native void recoverPublicKey(
+        byte[] qx,
+        byte[] qy,
+        byte[] r,
+        byte[] s,
+        byte[] hash,
+        int v)
+        throws java.lang.Exception;
+    
+    // Signature encodings: DER, at most 2 * getPrimeByteLength() + 8 bytes, and compact, r and s on
+    // getPrimeByteLength() bytes each. A DER array is decoded whole, so it holds the encoding only.
+    
+    public native int encodeSignatureDer(
+        byte[] der,
+        byte[] r,
+        byte[] s)
+        throws java.lang.Exception;
+    
+    public native void decodeSignatureDer(
+        byte[] r,
+        byte[] s,
+        byte[] der)
+        throws java.lang.Exception;
+    
+    public native int encodeSignatureCompact(
+        byte[] c,
+        byte[] r,
+        byte[] s)
+        throws java.lang.Exception;
+    
+    public native void decodeSignatureCompact(
+        byte[] r,
+        byte[] s,
+        byte[] c)
+        throws java.lang.Exception;
+    
+    public native int encodeSignaturesDer(
+        int[] der_sizes,
+        byte[] der,
+        byte[] r,
+        byte[] s,
+        int count)
+        throws java.lang.Exception;
+    
+    public native void decodeSignaturesDer(
+        int[] results,
+        byte[] r,
+        byte[] s,
+        byte[] der,
+        int[] der_sizes,
+        int count)
+        throws java.lang.Exception;
+    
+    public native void encodeSignaturesCompact(
+        byte[] c,
+        byte[] r,
+        byte[] s,
+        int count)
+        throws java.lang.Exception;
+    
+    public native void decodeSignaturesCompact(
+        byte[] r,
+        byte[] s,
+        byte[] c,
+        int count)
+        throws java.lang.Exception;
+    
+    public native void verifySignaturesDer(
+        int[] results,
+        byte[] der,
+        int[] der_sizes,
+        byte[] hash,
+        byte[] qx,
+        byte[] qy,
+        int count)
+        throws java.lang.Exception;
+    
+    // Compressed schema: r and s with the recovery id in the top bit of s, and the key stored as a prefix
+    // of the SHA-256 digest of its SEC1 compressed encoding, k.length bytes from MIN_COMPRESSION to MAX_COMPRESSION.
+    
+    public static final int MIN_COMPRESSION = 16;
+    public static final int MAX_COMPRESSION = 32;
+    
+    public native int generateCompressedSignature(
+        byte[] c,
+        byte[] hash,
+        byte[] sk)
+        throws java.lang.Exception;
+    
+    public native int encodeCompressedSignature(
+        byte[] c,
+        byte[] r,
+        byte[] s,
+        int v)
+        throws java.lang.Exception;
+    
+    public native int decodeCompressedSignature(
+        byte[] r,
+        byte[] s,
+        byte[] c)
+        throws java.lang.Exception;
+    
+    public native void encodeCompressedKey(
+        byte[] k,
+        byte[] qx,
+        byte[] qy)
+        throws java.lang.Exception;
+    
+    public native int verifyCompressedSignature(
+        byte[] c,
+        byte[] hash,
+        byte[] k)
+        throws java.lang.Exception;
+    
+    public native void verifyCompressedSignatures(
+        int[] results,
+        byte[] c,
+        byte[] hash,
+        byte[] k,
+        int count)
+        throws java.lang.Exception;
+    
+    public void generateSignatures(
+        java.nio.ByteBuffer r,
+        java.nio.ByteBuffer s,
+        java.nio.ByteBuffer hash,
+        java.nio.ByteBuffer ek,
+        java.nio.ByteBuffer sk,
+        int count)
+        throws java.lang.Exception
+    {
+        generateSignaturesDirect(
+            r, r.position(), r.remaining(),
+            s, s.position(), s.remaining(),
+            hash, hash.position(), hash.remaining(),
+            ek, ek.position(), ek.remaining(),
+            sk, sk.position(), sk.remaining(),
+            count);
+    }
+    
+    public void verifySignatures(
+        java.nio.IntBuffer results,
+        java.nio.ByteBuffer r,
+        java.nio.ByteBuffer s,
+        java.nio.ByteBuffer hash,
+        java.nio.ByteBuffer qx,
+        java.nio.ByteBuffer qy,
+        int count)
+        throws java.lang.Exception
+    {
+        verifySignaturesDirect(
+            results, results.position(), results.remaining(),
+            r, r.position(), r.remaining(),
+            s, s.position(), s.remaining(),
+            hash, hash.position(), hash.remaining(),
+            qx, qx.position(), qx.remaining(),
+            qy, qy.position(), qy.remaining(),
+            count);
+    }
+    
+    private native void generateSignaturesDirect(
+        java.nio.ByteBuffer r,
+        int r_offset,
+        int r_size,
+        java.nio.ByteBuffer s,
+        int s_offset,
+        int s_size,
+        java.nio.ByteBuffer hash,
+        int hash_offset,
+        int hash_size,
+        java.nio.ByteBuffer ek,
+        int ek_offset,
+        int ek_size,
+        java.nio.ByteBuffer sk,
+        int sk_offset,
+        int sk_size,
+        int count)
+        throws java.lang.Exception;
+    
+    private native void verifySignaturesDirect(
+        java.nio.IntBuffer results,
+        int results_offset,
+        int results_size,
+        java.nio.ByteBuffer r,
+        int r_offset,
+        int r_size,
+        java.nio.ByteBuffer s,
+        int s_offset,
+        int s_size,
+        java.nio.ByteBuffer hash,
+        int hash_offset,
+        int hash_size,
+        java.nio.ByteBuffer qx,
+        int qx_offset,
+        int qx_size,
+        java.nio.ByteBuffer qy,
+        int qy_offset,
+        int qy_size,
+        int count)
+        throws java.lang.Exception;
+    
     public native void destroy()
         throws java.lang.Exception;
     
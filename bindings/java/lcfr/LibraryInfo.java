@@ -16,6 +16,9 @@ public class LibraryInfo
     public native java.lang.String getVersion()
         throws java.lang.Exception;
     
+    public native java.lang.String getActiveKernels()
+        throws java.lang.Exception;
+    
     public native void destroy()
         throws java.lang.Exception;
     
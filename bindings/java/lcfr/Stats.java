@@ -0,0 +1,66 @@
+package lcfr;
+
+public final class Stats
+{
+    public static final int FP_MULT = 0;
+    public static final int FP_SQUARE = 1;
+    public static final int FP_INVERSE = 2;
+    public static final int REDUCTION = 3;
+    public static final int POINT_ADD = 4;
+    public static final int POINT_DOUBLE = 5;
+    public static final int SIGN = 6;
+    public static final int VERIFY = 7;
+    public static final int COUNTER_COUNT = 8;
+    
+    public static final int CURVE_COUNT = 10;
+    
+    public static final int OPERATION_SIGN = 0;
+    public static final int OPERATION_VERIFY = 1;
+    
+    public static final int STAGE_CALL = 0;
+    public static final int STAGE_HASH = 1;
+    public static final int STAGE_INVERSE = 2;
+    public static final int STAGE_SCALAR_MULT = 3;
+    public static final int STAGE_NORMALIZE = 4;
+    public static final int STAGE_FINAL = 5;
+    
+    private Stats()
+    {
+    }
+    
+    public static native boolean isEnabled()
+        throws java.lang.Exception;
+    
+    // CURVE_COUNT * COUNTER_COUNT values, curve major
+    public static native long[] snapshot()
+        throws java.lang.Exception;
+    
+    public static native void reset()
+        throws java.lang.Exception;
+    
+    public static native void enableLatency(
+        boolean enabled)
+        throws java.lang.Exception;
+    
+    // fills values with the latencies at the quantiles in nanoseconds, returns the number of durations recorded
+    public static native long getLatency(
+        int curve,
+        int operation,
+        int stage,
+        double[] quantiles,
+        double[] values)
+        throws java.lang.Exception;
+    
+    public static native java.lang.String getCurveName(
+        int curve)
+        throws java.lang.Exception;
+    
+    public static long get(
+        long[] snapshot,
+        int curve,
+        int counter)
+    {
+        return snapshot[curve * COUNTER_COUNT + counter];
+    }
+    
+}
@@ -0,0 +1,439 @@
+package lcfr.ffm;
+
+import java.lang.foreign.Arena;
+import java.lang.foreign.FunctionDescriptor;
+import java.lang.foreign.Linker;
+import java.lang.foreign.MemoryLayout;
+import java.lang.foreign.MemorySegment;
+import java.lang.foreign.SymbolLookup;
+import java.lang.invoke.MethodHandle;
+
+import static java.lang.foreign.ValueLayout.ADDRESS;
+import static java.lang.foreign.ValueLayout.JAVA_BYTE;
+import static java.lang.foreign.ValueLayout.JAVA_INT;
+
+/**
+ * EcCipher calling the C functions of include/lcfr/i_ec_cipher.h through the Foreign Function
+ * and Memory API (JDK 22 or later), with no JNI glue in between. The JVM needs the option
+ * --enable-native-access for the module or ALL-UNNAMED.
+ *
+ * Only the getters are linked as critical: they take less than a microsecond, and byte arrays
+ * are passed to them in place. A critical call holds off the garbage collector until it returns,
+ * and the key generation, signature and verification take from a fraction of a millisecond to a
+ * few milliseconds, so they are plain downcalls like the batch calls, on native memory segments.
+ * Their byte array forms copy the arrays to and from a confined arena around the call.
+ */
+public final class EcCipher implements AutoCloseable
+{
+    private static final Linker LINKER = Linker.nativeLinker();
+    private static final SymbolLookup LOOKUP;
+
+    static
+    {
+        System.loadLibrary("lcfr");
+        LOOKUP = SymbolLookup.loaderLookup();
+    }
+
+    private static MethodHandle downcall(String name, boolean critical, MemoryLayout... args)
+    {
+        FunctionDescriptor descriptor = FunctionDescriptor.of(JAVA_INT, args);
+        MemorySegment symbol = LOOKUP.find(name).orElseThrow(() -> new UnsatisfiedLinkError(name));
+        return critical
+            ? LINKER.downcallHandle(symbol, descriptor, Linker.Option.critical(true))
+            : LINKER.downcallHandle(symbol, descriptor);
+    }
+
+    private static final MethodHandle GET_EXCEPTION_MESSAGE = downcall("lcfr_EcCipher_getExceptionMessage", false,
+        ADDRESS);
+    private static final MethodHandle CREATE = downcall("lcfr_EcCipher_create", false,
+        ADDRESS, ADDRESS);
+    private static final MethodHandle RELEASE = downcall("lcfr_EcCipher_release", false,
+        ADDRESS);
+    private static final MethodHandle GET_PRIME_BIT_LENGTH = downcall("lcfr_EcCipher_getPrimeBitLength", true,
+        ADDRESS, ADDRESS);
+    private static final MethodHandle GET_PRIME_BYTE_LENGTH = downcall("lcfr_EcCipher_getPrimeByteLength", true,
+        ADDRESS, ADDRESS);
+    private static final MethodHandle GET_PRIME = downcall("lcfr_EcCipher_getPrime", true,
+        ADDRESS, ADDRESS, JAVA_INT);
+    private static final MethodHandle GET_CURVE_POINT_COORDINATE_BIT_LENGTH = downcall("lcfr_EcCipher_getCurvePointCoordinateBitLength", true,
+        ADDRESS, ADDRESS);
+    private static final MethodHandle GET_CURVE_POINT_COORDINATE_BYTE_LENGTH = downcall("lcfr_EcCipher_getCurvePointCoordinateByteLength", true,
+        ADDRESS, ADDRESS);
+    private static final MethodHandle GENERATE_PUBLIC_KEY = downcall("lcfr_EcCipher_generatePublicKey", false,
+        ADDRESS, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT);
+    private static final MethodHandle GENERATE_SIGNATURE = downcall("lcfr_EcCipher_generateSignature", false,
+        ADDRESS, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT);
+    private static final MethodHandle VERIFY_SIGNATURE = downcall("lcfr_EcCipher_verifySignature", false,
+        ADDRESS, ADDRESS, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT);
+    private static final MethodHandle GENERATE_SIGNATURES = downcall("lcfr_EcCipher_generateSignatures", false,
+        ADDRESS, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, JAVA_INT);
+    private static final MethodHandle VERIFY_SIGNATURES = downcall("lcfr_EcCipher_verifySignatures", false,
+        ADDRESS, ADDRESS, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, ADDRESS, JAVA_INT, JAVA_INT);
+
+    private MemorySegment self;
+
+    public EcCipher(
+        java.lang.String curve)
+        throws java.lang.Exception
+    {
+        try (Arena arena = Arena.ofConfined())
+        {
+            MemorySegment result = arena.allocate(ADDRESS);
+            check((int) CREATE.invokeExact(result, arena.allocateFrom(curve)));
+            self = result.get(ADDRESS, 0);
+        }
+        catch (Throwable t)
+        {
+            throw rethrow(t);
+        }
+    }
+
+    public int getPrimeBitLength()
+        throws java.lang.Exception
+    {
+        int[] result = new int[1];
+        try
+        {
+            check((int) GET_PRIME_BIT_LENGTH.invokeExact(self, MemorySegment.ofArray(result)));
+        }
+        catch (Throwable t)
+        {
+            throw rethrow(t);
+        }
+        return result[0];
+    }
+
+    public int getPrimeByteLength()
+        throws java.lang.Exception
+    {
+        int[] result = new int[1];
+        try
+        {
+            check((int) GET_PRIME_BYTE_LENGTH.invokeExact(self, MemorySegment.ofArray(result)));
+        }
+        catch (Throwable t)
+        {
+            throw rethrow(t);
+        }
+        return result[0];
+    }
+
+    public void getPrime(
+        MemorySegment p)
+        throws java.lang.Exception
+    {
+        try
+        {
+            check((int) GET_PRIME.invokeExact(self, p, size(p)));
+        }
+        catch (Throwable t)
+        {
+            throw rethrow(t);
+        }
+    }
+
+    public int getCurvePointCoordinateBitLength()
+        throws java.lang.Exception
+    {
+        int[] result = new int[1];
+        try
+        {
+            check((int) GET_CURVE_POINT_COORDINATE_BIT_LENGTH.invokeExact(self, MemorySegment.ofArray(result)));
+        }
+        catch (Throwable t)
+        {
+            throw rethrow(t);
+        }
+        return result[0];
+    }
+
+    public int getCurvePointCoordinateByteLength()
+        throws java.lang.Exception
+    {
+        int[] result = new int[1];
+        try
+        {
+            check((int) GET_CURVE_POINT_COORDINATE_BYTE_LENGTH.invokeExact(self, MemorySegment.ofArray(result)));
+        }
+        catch (Throwable t)
+        {
+            throw rethrow(t);
+        }
+        return result[0];
+    }
+
+    public void generatePublicKey(
+        MemorySegment qx,
+        MemorySegment qy,
+        MemorySegment sk)
+        throws java.lang.Exception
+    {
+        try
+        {
+            check((int) GENERATE_PUBLIC_KEY.invokeExact(self,
+                qx, size(qx),
+                qy, size(qy),
+                sk, size(sk)));
+        }
+        catch (Throwable t)
+        {
+            throw rethrow(t);
+        }
+    }
+
+    public void generateSignature(
+        MemorySegment r,
+        MemorySegment s,
+        MemorySegment hash,
+        MemorySegment ek,
+        MemorySegment sk)
+        throws java.lang.Exception
+    {
+        try
+        {
+            check((int) GENERATE_SIGNATURE.invokeExact(self,
+                r, size(r),
+                s, size(s),
+                hash, size(hash),
+                ek, size(ek),
+                sk, size(sk)));
+        }
+        catch (Throwable t)
+        {
+            throw rethrow(t);
+        }
+    }
+
+    public int verifySignature(
+        MemorySegment r,
+        MemorySegment s,
+        MemorySegment hash,
+        MemorySegment qx,
+        MemorySegment qy)
+        throws java.lang.Exception
+    {
+        try (Arena arena = Arena.ofConfined())
+        {
+            MemorySegment result = arena.allocate(JAVA_INT);
+            check((int) VERIFY_SIGNATURE.invokeExact(self, result,
+                r, size(r),
+                s, size(s),
+                hash, size(hash),
+                qx, size(qx),
+                qy, size(qy)));
+            return result.get(JAVA_INT, 0);
+        }
+        catch (Throwable t)
+        {
+            throw rethrow(t);
+        }
+    }
+
+    public void getPrime(
+        byte[] p)
+        throws java.lang.Exception
+    {
+        getPrime(
+            MemorySegment.ofArray(p));
+    }
+
+    public void generatePublicKey(
+        byte[] qx,
+        byte[] qy,
+        byte[] sk)
+        throws java.lang.Exception
+    {
+        try (Arena arena = Arena.ofConfined())
+        {
+            MemorySegment qxs = arena.allocate(qx.length);
+            MemorySegment qys = arena.allocate(qy.length);
+            MemorySegment sks = arena.allocateFrom(JAVA_BYTE, sk);
+            try
+            {
+                generatePublicKey(
+                    qxs,
+                    qys,
+                    sks);
+                copy(qxs, qx);
+                copy(qys, qy);
+            }
+            finally
+            {
+                // the arena memory is freed, not cleared, when it closes
+                sks.fill((byte) 0);
+            }
+        }
+    }
+
+    public void generateSignature(
+        byte[] r,
+        byte[] s,
+        byte[] hash,
+        byte[] ek,
+        byte[] sk)
+        throws java.lang.Exception
+    {
+        try (Arena arena = Arena.ofConfined())
+        {
+            MemorySegment rs = arena.allocate(r.length);
+            MemorySegment ss = arena.allocate(s.length);
+            MemorySegment eks = arena.allocateFrom(JAVA_BYTE, ek);
+            MemorySegment sks = arena.allocateFrom(JAVA_BYTE, sk);
+            try
+            {
+                generateSignature(
+                    rs,
+                    ss,
+                    arena.allocateFrom(JAVA_BYTE, hash),
+                    eks,
+                    sks);
+                copy(rs, r);
+                copy(ss, s);
+            }
+            finally
+            {
+                eks.fill((byte) 0);
+                sks.fill((byte) 0);
+            }
+        }
+    }
+
+    public int verifySignature(
+        byte[] r,
+        byte[] s,
+        byte[] hash,
+        byte[] qx,
+        byte[] qy)
+        throws java.lang.Exception
+    {
+        try (Arena arena = Arena.ofConfined())
+        {
+            return verifySignature(
+                arena.allocateFrom(JAVA_BYTE, r),
+                arena.allocateFrom(JAVA_BYTE, s),
+                arena.allocateFrom(JAVA_BYTE, hash),
+                arena.allocateFrom(JAVA_BYTE, qx),
+                arena.allocateFrom(JAVA_BYTE, qy));
+        }
+    }
+
+    // Batch methods: each native segment holds count elements of the same size one after the other,
+    // results holds count native ints.
+
+    public void generateSignatures(
+        MemorySegment r,
+        MemorySegment s,
+        MemorySegment hash,
+        MemorySegment ek,
+        MemorySegment sk,
+        int count)
+        throws java.lang.Exception
+    {
+        try
+        {
+            check((int) GENERATE_SIGNATURES.invokeExact(self,
+                r, elementSize(r, count),
+                s, elementSize(s, count),
+                hash, elementSize(hash, count),
+                ek, elementSize(ek, count),
+                sk, elementSize(sk, count),
+                count));
+        }
+        catch (Throwable t)
+        {
+            throw rethrow(t);
+        }
+    }
+
+    public void verifySignatures(
+        MemorySegment results,
+        MemorySegment r,
+        MemorySegment s,
+        MemorySegment hash,
+        MemorySegment qx,
+        MemorySegment qy,
+        int count)
+        throws java.lang.Exception
+    {
+        if (results.byteSize() < (long) count * JAVA_INT.byteSize())
+            throw new java.lang.Exception("results segment too short");
+        try
+        {
+            check((int) VERIFY_SIGNATURES.invokeExact(self, results,
+                r, elementSize(r, count),
+                s, elementSize(s, count),
+                hash, elementSize(hash, count),
+                qx, elementSize(qx, count),
+                qy, elementSize(qy, count),
+                count));
+        }
+        catch (Throwable t)
+        {
+            throw rethrow(t);
+        }
+    }
+
+    public void close()
+    {
+        if (self == null || self.equals(MemorySegment.NULL)) return;
+        try
+        {
+            int code = (int) RELEASE.invokeExact(self);
+        }
+        catch (Throwable t)
+        {
+        }
+        self = MemorySegment.NULL;
+    }
+
+    private static int size(MemorySegment segment)
+        throws java.lang.Exception
+    {
+        if (segment.byteSize() > Integer.MAX_VALUE)
+            throw new java.lang.Exception("segment too large");
+        return (int) segment.byteSize();
+    }
+
+    private static void copy(MemorySegment from, byte[] to)
+    {
+        MemorySegment.copy(from, JAVA_BYTE, 0, to, 0, to.length);
+    }
+
+    private static int elementSize(MemorySegment segment, int count)
+        throws java.lang.Exception
+    {
+        if (count <= 0)
+            return 0;
+        int size = size(segment);
+        if (size % count != 0)
+            throw new java.lang.Exception("segment size is not a multiple of count");
+        return size / count;
+    }
+
+    private static void check(int code)
+        throws java.lang.Exception
+    {
+        if (code == 0) return;
+        try (Arena arena = Arena.ofConfined())
+        {
+            MemorySegment message = arena.allocate(ADDRESS);
+            int ignored = (int) GET_EXCEPTION_MESSAGE.invokeExact(message);
+            throw new java.lang.Exception(message.get(ADDRESS, 0).reinterpret(Long.MAX_VALUE).getString(0));
+        }
+        catch (java.lang.Exception e)
+        {
+            throw e;
+        }
+        catch (Throwable t)
+        {
+            throw rethrow(t);
+        }
+    }
+
+    private static java.lang.Exception rethrow(Throwable t)
+    {
+        if (t instanceof java.lang.Exception) return (java.lang.Exception) t;
+        if (t instanceof Error) throw (Error) t;
+        return new java.lang.Exception(t);
+    }
+}
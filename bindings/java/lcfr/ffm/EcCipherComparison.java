@@ -0,0 +1,93 @@
+package lcfr.ffm;
+
+/**
+ * Compares the call cost of the JNI binding (lcfr.EcCipher) and of the FFM binding (lcfr.ffm.EcCipher),
+ * in the manner of a JMH average time benchmark: warmup iterations, then measured iterations of a fixed
+ * duration, reporting the mean time per operation and its spread across the iterations.
+ *
+ * Usage: java --enable-native-access=ALL-UNNAMED -Djava.library.path=... lcfr.ffm.EcCipherComparison [curve]
+ */
+public final class EcCipherComparison
+{
+    private static final int WARMUP_ITERATIONS = 5;
+    private static final int MEASURED_ITERATIONS = 10;
+    private static final long ITERATION_NANOS = 1_000_000_000L;
+
+    private interface Operation
+    {
+        int run() throws java.lang.Exception;
+    }
+
+    private static int sink;
+
+    private static double iteration(Operation op)
+        throws java.lang.Exception
+    {
+        long count = 0;
+        long start = System.nanoTime();
+        long elapsed;
+        do
+        {
+            sink += op.run();
+            count++;
+            elapsed = System.nanoTime() - start;
+        }
+        while (elapsed < ITERATION_NANOS);
+        return (double) elapsed / count;
+    }
+
+    private static void measure(String name, Operation op)
+        throws java.lang.Exception
+    {
+        for (int i = 0; i < WARMUP_ITERATIONS; i++) iteration(op);
+        double[] samples = new double[MEASURED_ITERATIONS];
+        double mean = 0;
+        for (int i = 0; i < MEASURED_ITERATIONS; i++)
+        {
+            samples[i] = iteration(op);
+            mean += samples[i] / MEASURED_ITERATIONS;
+        }
+        double variance = 0;
+        for (double sample : samples) variance += (sample - mean) * (sample - mean) / (MEASURED_ITERATIONS - 1);
+        System.out.printf("%-28s %12.1f ns/op  +- %.1f%n", name, mean, Math.sqrt(variance));
+    }
+
+    public static void main(String[] args)
+        throws java.lang.Exception
+    {
+        String curve = args.length > 0 ? args[0] : "secp256k1";
+        lcfr.EcCipher jni = new lcfr.EcCipher(curve);
+        try (EcCipher ffm = new EcCipher(curve))
+        {
+            int n = jni.getPrimeByteLength();
+            int c = jni.getCurvePointCoordinateByteLength();
+            byte[] sk = new byte[n];
+            byte[] ek = new byte[n];
+            byte[] hash = new byte[32];
+            for (int i = 0; i < n; i++)
+            {
+                sk[i] = (byte) (i + 1);
+                ek[i] = (byte) (3 * i + 7);
+            }
+            for (int i = 0; i < hash.length; i++) hash[i] = (byte) (5 * i);
+            byte[] qx = new byte[c];
+            byte[] qy = new byte[c];
+            byte[] r = new byte[n];
+            byte[] s = new byte[n];
+            jni.generatePublicKey(qx, qy, sk);
+            jni.generateSignature(r, s, hash, ek, sk);
+            if (ffm.verifySignature(r, s, hash, qx, qy) == 0 || jni.verifySignature(r, s, hash, qx, qy) == 0)
+                throw new java.lang.Exception("signature not verified");
+
+            // the call overhead alone, then a full operation
+            measure("jni getPrimeBitLength", jni::getPrimeBitLength);
+            measure("ffm getPrimeBitLength", ffm::getPrimeBitLength);
+            measure("jni verifySignature", () -> jni.verifySignature(r, s, hash, qx, qy));
+            measure("ffm verifySignature", () -> ffm.verifySignature(r, s, hash, qx, qy));
+        }
+        finally
+        {
+            jni.dispose();
+        }
+    }
+}
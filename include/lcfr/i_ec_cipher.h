@@ -68,6 +68,29 @@ LCFR_API uint32_t lcfr_EcCipher_create(
     lcfr_EcCipher_vtable_ptr** _result,
     const char* curve);
 
+/** \brief Output the size of the memory block needed by lcfr_EcCipher_createInPlace.
+  * \param[out] _result the address of the output variable
+  * \return 0 if successful, a positive number otherwise
+  */
+LCFR_API uint32_t lcfr_EcCipher_sizeof(uint32_t* _result);
+
+/** \brief Create a Cipher in a memory block owned by the caller.
+  * \param[out] _result the address of the pointer to the cipher interface
+  * \param memory the address of the memory block, aligned to 8 bytes
+  * \param memory_size the size of the memory block, at least the one output by lcfr_EcCipher_sizeof
+  * \param curve the name of the curve
+  * \return 0 if successful, a positive number otherwise
+  *
+  * This method is the same as lcfr_EcCipher_create, without any heap allocation.
+  * The curve parameters are shared by all the ciphers of the process, so that the cipher
+  * only refers to them. lcfr_EcCipher_release destroys the cipher without freeing the memory block.
+  */
+LCFR_API uint32_t lcfr_EcCipher_createInPlace(
+    lcfr_EcCipher_vtable_ptr** _result,
+    void* memory,
+    uint32_t memory_size,
+    const char* curve);
+
 /** \brief Output the bit size of the curve points finite field prime.
   * \param this_ptr the address of the cipher interface
   * \param[out] _result the address of the output variable
@@ -199,192 +222,2427 @@ LCFR_API uint32_t lcfr_EcCipher_verifySignature(
     const uint8_t* qy,
     uint32_t qy_size);
 
-#ifdef __cplusplus
-}
-#endif
+/** \brief Generate a batch of standard ECDSA signatures.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] r the byte array to store the r components of the signatures
+  * \param r_size the byte size of each r component
+  * \param[out] s the byte array to store the s components of the signatures
+  * \param s_size the byte size of each s component
+  * \param hash the byte array storing the hashes
+  * \param h_size the byte size of each hash
+  * \param ek the byte array storing the ephemeral keys
+  * \param ek_size the byte size of each ephemeral key
+  * \param sk the byte array storing the secret keys
+  * \param sk_size the byte size of each secret key
+  * \param count the number of signatures
+  * \return 0 if successful, a positive number otherwise
+  * \remark Each array stores count consecutive numbers of the given size, with the same layout as lcfr_EcCipher_generateSignature.
+  *         The batch is split across the threads configured with lcfr_Runtime_configure, if any.
+  */
+LCFR_API uint32_t lcfr_EcCipher_generateSignatures(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* ek,
+    uint32_t ek_size,
+    const uint8_t* sk,
+    uint32_t sk_size,
+    uint32_t count);
 
-#ifdef _WIN32
-#define STDCALL __stdcall
-#else
-#define STDCALL
-#endif
+/** \brief Verify a batch of standard ECDSA signatures.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] results the array of count output variables, each being -1 if the signature is valid, 0 otherwise
+  * \param r the byte array storing the r components of the signatures
+  * \param r_size the byte size of each r component
+  * \param s the byte array storing the s components of the signatures
+  * \param s_size the byte size of each s component
+  * \param hash the byte array storing the hashes
+  * \param h_size the byte size of each hash
+  * \param qx the byte array storing the x components of the public keys
+  * \param qx_size the byte size of each qx component
+  * \param qy the byte array storing the y components of the public keys
+  * \param qy_size the byte size of each qy component
+  * \param count the number of signatures
+  * \return 0 if successful, a positive number otherwise
+  * \remark Each array stores count consecutive numbers of the given size, with the same layout as lcfr_EcCipher_verifySignature.
+  *         The batch is split across the threads configured with lcfr_Runtime_configure, if any.
+  */
+LCFR_API uint32_t lcfr_EcCipher_verifySignatures(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* results,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size,
+    uint32_t count);
 
-#ifdef __cplusplus
-#include <string>
+/** \brief Hash the message with SHA-256 and generate the standard ECDSA signature of the digest.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] r the byte array to store the r component of the signature
+  * \param r_size the r byte array size
+  * \param[out] s the byte array to store the s component of the signature
+  * \param s_size the s byte array size
+  * \param m the byte array storing the message
+  * \param m_size the m byte array size
+  * \param ek the byte array storing the ephemeral key
+  * \param ek_size the ek byte array size
+  * \param sk the byte array storing the secret key
+  * \param sk_size the sk byte array size
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+  *         The ephemeral key and secret key bit sizes must not exceed the bit size of the curve points finite field prime.
+  */
+LCFR_API uint32_t lcfr_EcCipher_signMessage(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* m,
+    uint32_t m_size,
+    const uint8_t* ek,
+    uint32_t ek_size,
+    const uint8_t* sk,
+    uint32_t sk_size);
 
-namespace lcfr {
+/** \brief Hash the message with SHA-256 and verify the standard ECDSA signature of the digest.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] _result the address of the output variable, being -1 if the signature is valid, 0 otherwise
+  * \param r the byte array storing the r component of the signature
+  * \param r_size the r byte array size
+  * \param s the byte array storing the s component of the signature
+  * \param s_size the s byte array size
+  * \param m the byte array storing the message
+  * \param m_size the m byte array size
+  * \param qx the byte array storing the x component of the public key
+  * \param qx_size the qx byte array size
+  * \param qy the byte array storing the y component of the public key
+  * \param qy_size the qy byte array size
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  */
+LCFR_API uint32_t lcfr_EcCipher_verifyMessage(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* _result,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* m,
+    uint32_t m_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size);
 
-/**
-  * \struct IEcCipher
-  *
-  * This struct is the C++ interface to a cipher
-  * for generation and verification of digital signatures, using elliptic-curve cryptography.
-  * Standard ECDSA as well as a proprietary compressed schema are supported.
+/** \brief Hash a batch of messages with SHA-256 and generate the standard ECDSA signatures of the digests.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] r the byte array to store the r components of the signatures
+  * \param r_size the byte size of each r component
+  * \param[out] s the byte array to store the s components of the signatures
+  * \param s_size the byte size of each s component
+  * \param m the byte array storing the messages one after the other
+  * \param m_sizes the array of the count message byte sizes
+  * \param ek the byte array storing the ephemeral keys
+  * \param ek_size the byte size of each ephemeral key
+  * \param sk the byte array storing the secret keys
+  * \param sk_size the byte size of each secret key
+  * \param count the number of signatures
+  * \return 0 if successful, a positive number otherwise
+  * \remark Each array but m and m_sizes stores count consecutive numbers of the given size, with the same layout as lcfr_EcCipher_generateSignature.
+  *         The messages are hashed several at a time and the batch is split across the threads configured with lcfr_Runtime_configure, if any.
   */
-struct IEcCipher
-{
-    /** \brief Destroy the cipher object.
-      * \return 0 if successful, a positive number otherwise
-      */
-    virtual uint32_t STDCALL release() = 0;
-    
-    /** \brief Initialize the cipher.
-      * \param curve the name of the curve
-      *
-      * This method is the Cipher class constructor.
-      * The following are the supported curves:
-      * - 56-bit - secp112r1, secp112r2
-      * - 64-bit - secp128r1, secp128r2
-      * - 80-bit - secp160k1, secp160r1
-      * - 96-bit - secp192k1, secp192r1
-      * - 128-bit - secp256k1, secp256r1
-      */
-    virtual uint32_t STDCALL init(
-        const char* curve) = 0;
-    
-    /** \brief Output the bit size of the curve points finite field prime.
-      * \param _result the address of the output variable
-      */
-    virtual uint32_t STDCALL getPrimeBitLength(
-        uint32_t* _result) = 0;
-    
-    /** \brief Output the byte size of the curve points finite field prime.
-      * \param _result the address of the output variable
-      */
-    virtual uint32_t STDCALL getPrimeByteLength(
-        uint32_t* _result) = 0;
-    
-    /** \brief Output the curve points finite field prime.
-      * \param[out] p the byte array to store the output prime
-      * \param p_size the byte array capacity
-      * \return 0 if successful, a positive number otherwise
-      * \remark The output prime number is written with network byte order,
-      *         if the array size exceeds required size the number is left-padded with zeros.
-      */
-    virtual uint32_t STDCALL getPrime(
-        uint8_t* p,
-        uint32_t p_size) = 0;
-    
-    /** \brief Return the bit size of the curve point coordinate finite field prime.
-      * \param[out] _result the address of the output variable
-      * \return 0 if successful, a positive number otherwise
-      */
-    virtual uint32_t STDCALL getCurvePointCoordinateBitLength(
-        uint32_t* _result) = 0;
-    
-    /** \brief Return the byte size of the curve point coordinate finite field prime.
-      * \param[out] _result the address of the output variable
-      * \return 0 if successful, a positive number otherwise
-      */
-    virtual uint32_t STDCALL getCurvePointCoordinateByteLength(
-        uint32_t* _result) = 0;
-    
-    /** \brief Output the cipher public key given the private key.
-      * \param[out] qx the byte array for the x component of the public key
-      * \param qx_size the qx byte array size
-      * \param[out] qy the byte array for the y component of the public key
-      * \param qy_size the qy byte array size
-      * \param sk the byte array storing the secret key
-      * \param sk_size the sk byte array size
-      * \return 0 if successful, a positive number otherwise
-      * \remark All in/out numbers are written with network byte order.
-      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
-      *         The secret key bit size must not exceed the bit size of the curve points finite field prime.
-      */
-    virtual uint32_t STDCALL generatePublicKey(
-        uint8_t* qx,
-        uint32_t qx_size,
-        uint8_t* qy,
-        uint32_t qy_size,
-        const uint8_t* sk,
-        uint32_t sk_size) = 0;
-    
-    /** \brief Generate the standard ECDSA signature.
-      * \param[out] r the byte array to store the r component of the signature
-      * \param r_size the r byte array size
-      * \param[out] s the byte array to store the s component of the signature
-      * \param s_size the s byte array size
-      * \param hash the byte array storing the hash
-      * \param h_size the hash byte array size
-      * \param ek the byte array storing the ephemeral key
-      * \param ek_size the ek byte array size
-      * \param sk the byte array storing the secret key
-      * \param sk_size the sk byte array size
-      * \return 0 if successful, a positive number otherwise
-      * \remark All in/out numbers are written with network byte order.
-      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
-      *         The ephemeral key and secret key bit sizes must not exceed the bit size of the curve points finite field prime.
-      */
-    virtual uint32_t STDCALL generateSignature(
-        uint8_t* r,
-        uint32_t r_size,
-        uint8_t* s,
-        uint32_t s_size,
-        const uint8_t* hash,
-        uint32_t h_size,
-        const uint8_t* ek,
-        uint32_t ek_size,
-        const uint8_t* sk,
-        uint32_t sk_size) = 0;
-    
-    /** \brief Verify the standard ECDSA signature.
-      * \param[out] _result the address of the output variable, being 0 if successful, positive number otherwise
-      * \param r the byte array storing the r component of the signature
-      * \param r_size the r byte array size
-      * \param s the byte array storing the s component of the signature
-      * \param s_size the s byte array size
-      * \param hash the byte array storing the hash
-      * \param h_size the hash byte array size
-      * \param qx the byte array storing the x component of the public key
-      * \param qx_size the qx byte array size
-      * \param qy the byte array storing the y component of the public key
-      * \param qy_size the qy byte array size
-      * \return 0 if successful, a positive number otherwise
-      * \remark All in/out numbers are written with network byte order.
-      */
-    virtual uint32_t STDCALL verifySignature(
-        int32_t* _result,
-        const uint8_t* r,
-        uint32_t r_size,
-        const uint8_t* s,
-        uint32_t s_size,
-        const uint8_t* hash,
-        uint32_t h_size,
-        const uint8_t* qx,
-        uint32_t qx_size,
-        const uint8_t* qy,
-        uint32_t qy_size) = 0;
-};
+LCFR_API uint32_t lcfr_EcCipher_signMessages(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* m,
+    const uint32_t* m_sizes,
+    const uint8_t* ek,
+    uint32_t ek_size,
+    const uint8_t* sk,
+    uint32_t sk_size,
+    uint32_t count);
 
-/**
-  * \class EcCipherProxy
-  *
-  * This class implements a cipher for generation and verification of digital signatures, using elliptic-curve cryptography.
-  * Standard ECDSA as well as a proprietary compressed schema are supported.
+/** \brief Hash a batch of messages with SHA-256 and verify the standard ECDSA signatures of the digests.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] results the array of count output variables, each being -1 if the signature is valid, 0 otherwise
+  * \param r the byte array storing the r components of the signatures
+  * \param r_size the byte size of each r component
+  * \param s the byte array storing the s components of the signatures
+  * \param s_size the byte size of each s component
+  * \param m the byte array storing the messages one after the other
+  * \param m_sizes the array of the count message byte sizes
+  * \param qx the byte array storing the x components of the public keys
+  * \param qx_size the byte size of each qx component
+  * \param qy the byte array storing the y components of the public keys
+  * \param qy_size the byte size of each qy component
+  * \param count the number of signatures
+  * \return 0 if successful, a positive number otherwise
+  * \remark Each array but m and m_sizes stores count consecutive numbers of the given size, with the same layout as lcfr_EcCipher_verifySignature.
+  *         The messages are hashed several at a time and the batch is split across the threads configured with lcfr_Runtime_configure, if any.
   */
-class EcCipherProxy
-{
-    lcfr::IEcCipher* obj_;
-    
+LCFR_API uint32_t lcfr_EcCipher_verifyMessages(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* results,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* m,
+    const uint32_t* m_sizes,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size,
+    uint32_t count);
+
+/** \brief Generate the standard ECDSA signature with an ephemeral key drawn by the library.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] r the byte array to store the r component of the signature
+  * \param r_size the r byte array size
+  * \param[out] s the byte array to store the s component of the signature
+  * \param s_size the s byte array size
+  * \param hash the byte array storing the hash
+  * \param h_size the hash byte array size
+  * \param sk the byte array storing the secret key
+  * \param sk_size the sk byte array size
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+  *         The secret key bit size must not exceed the bit size of the curve points finite field prime.
+  *         The ephemeral key is uniform between 1 and the group order - 1. It is drawn from a ChaCha20 generator of the calling thread,
+  *         seeded by the operating system and seeded again periodically and after a fork.
+  */
+LCFR_API uint32_t lcfr_EcCipher_generateSignatureRandom(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* sk,
+    uint32_t sk_size);
+
+/** \brief Encode the public key in the SEC1 format.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] _result the address of the output variable, the size of the encoded key
+  * \param[out] q the byte array to store the encoded key
+  * \param q_size the q byte array size
+  * \param qx the byte array storing the x component of the public key
+  * \param qx_size the qx byte array size
+  * \param qy the byte array storing the y component of the public key
+  * \param qy_size the qy byte array size
+  * \param compressed if not 0 the key is compressed to 0x02 or 0x03 and qx, else it is 0x04, qx and qy
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         The encoded key takes 1 + getCurvePointCoordinateByteLength bytes when compressed, 1 + 2 * getCurvePointCoordinateByteLength otherwise.
+  */
+LCFR_API uint32_t lcfr_EcCipher_encodePublicKey(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* q,
+    uint32_t q_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size,
+    uint32_t compressed);
+
+/** \brief Decode the public key from the SEC1 format.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] qx the byte array to store the x component of the public key
+  * \param qx_size the qx byte array size
+  * \param[out] qy the byte array to store the y component of the public key
+  * \param qy_size the qy byte array size
+  * \param q the byte array storing the encoded key
+  * \param q_size the q byte array size, the size of the encoded key
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+  *         The compressed (0x02 or 0x03) and the uncompressed (0x04) formats are accepted. The key must be on the curve;
+  *         for the compressed format qy is computed with a square root modulo the curve points finite field prime.
+  */
+LCFR_API uint32_t lcfr_EcCipher_decodePublicKey(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* qx,
+    uint32_t qx_size,
+    uint8_t* qy,
+    uint32_t qy_size,
+    const uint8_t* q,
+    uint32_t q_size);
+
+/** \brief Decode a batch of public keys from the SEC1 format.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] results the array of count output variables, each being -1 if the key is valid, 0 otherwise
+  * \param[out] qx the byte array to store the x components of the public keys
+  * \param qx_size the byte size of each qx component
+  * \param[out] qy the byte array to store the y components of the public keys
+  * \param qy_size the byte size of each qy component
+  * \param q the byte array storing the encoded keys
+  * \param q_size the byte size of each encoded key
+  * \param count the number of keys
+  * \return 0 if successful, a positive number otherwise
+  * \remark Each array stores count consecutive numbers of the given size, with the same layout as lcfr_EcCipher_decodePublicKey.
+  *         The malformed keys and the keys not on the curve are reported in results, they do not fail the call.
+  *         The batch is split across the threads configured with lcfr_Runtime_configure, if any.
+  */
+LCFR_API uint32_t lcfr_EcCipher_decodePublicKeys(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* results,
+    uint8_t* qx,
+    uint32_t qx_size,
+    uint8_t* qy,
+    uint32_t qy_size,
+    const uint8_t* q,
+    uint32_t q_size,
+    uint32_t count);
+
+/** \brief Generate the standard ECDSA signature and its recovery id.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] _result the address of the output variable, the recovery id of the signature
+  * \param[out] r the byte array to store the r component of the signature
+  * \param r_size the r byte array size
+  * \param[out] s the byte array to store the s component of the signature
+  * \param s_size the s byte array size
+  * \param hash the byte array storing the hash
+  * \param h_size the hash byte array size
+  * \param ek the byte array storing the ephemeral key
+  * \param ek_size the ek byte array size
+  * \param sk the byte array storing the secret key
+  * \param sk_size the sk byte array size
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+  *         The ephemeral key and secret key bit sizes must not exceed the bit size of the curve points finite field prime.
+  *         The recovery id is the parity of the y component of the point R of the signature plus twice the quotient of its
+  *         x component by the group order, R being ek * G, or -ek * G when s is replaced by the group order - s.
+  *         It is between 0 and 3, up to 9 for secp112r2 and secp128r2 whose cofactor is 4.
+  *         With it lcfr_EcCipher_recoverPublicKey computes the public key from the signature.
+  */
+LCFR_API uint32_t lcfr_EcCipher_generateRecoverableSignature(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* ek,
+    uint32_t ek_size,
+    const uint8_t* sk,
+    uint32_t sk_size);
+
+/** \brief Recover the public key of a signature from the signature, the hash and the recovery id.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] qx the byte array to store the x component of the public key
+  * \param qx_size the qx byte array size
+  * \param[out] qy the byte array to store the y component of the public key
+  * \param qy_size the qy byte array size
+  * \param r the byte array storing the r component of the signature
+  * \param r_size the r byte array size
+  * \param s the byte array storing the s component of the signature
+  * \param s_size the s byte array size
+  * \param hash the byte array storing the hash
+  * \param h_size the hash byte array size
+  * \param v the recovery id returned with the signature
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+  *         The call fails if the signature components are not between 1 and the group order - 1 or if the recovery id
+  *         does not select a point of the curve. A recovered key is the key of a valid signature: the signatures of other
+  *         keys recover other keys, so the caller still compares the recovered key with the expected one.
+  */
+LCFR_API uint32_t lcfr_EcCipher_recoverPublicKey(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* qx,
+    uint32_t qx_size,
+    uint8_t* qy,
+    uint32_t qy_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    uint32_t v);
+
+/** \brief Encode the signature in the DER format.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] _result the address of the output variable, the size of the encoded signature
+  * \param[out] der the byte array to store the encoded signature
+  * \param der_size the der byte array size
+  * \param r the byte array storing the r component of the signature
+  * \param r_size the r byte array size
+  * \param s the byte array storing the s component of the signature
+  * \param s_size the s byte array size
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         The DER encoding is the SEQUENCE of the INTEGERs r and s, at most 2 * getPrimeByteLength + 8 bytes long.
+  */
+LCFR_API uint32_t lcfr_EcCipher_encodeSignatureDer(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* der,
+    uint32_t der_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size);
+
+/** \brief Decode the signature from the DER format.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] r the byte array to store the r component of the signature
+  * \param r_size the r byte array size
+  * \param[out] s the byte array to store the s component of the signature
+  * \param s_size the s byte array size
+  * \param der the byte array storing the encoded signature
+  * \param der_size the der byte array size, the size of the encoded signature
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+  *         The DER encoding is the SEQUENCE of the INTEGERs r and s, at most 2 * getPrimeByteLength + 8 bytes long.
+  *         The encoding must be strict: minimal lengths, positive minimal integers and no trailing bytes.
+  */
+LCFR_API uint32_t lcfr_EcCipher_decodeSignatureDer(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* der,
+    uint32_t der_size);
+
+/** \brief Encode the signature in the compact format.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] _result the address of the output variable, the size of the encoded signature
+  * \param[out] c the byte array to store the encoded signature
+  * \param c_size the c byte array size
+  * \param r the byte array storing the r component of the signature
+  * \param r_size the r byte array size
+  * \param s the byte array storing the s component of the signature
+  * \param s_size the s byte array size
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         The compact encoding is r and s on getPrimeByteLength bytes each, 64 bytes for the 256-bit curves.
+  */
+LCFR_API uint32_t lcfr_EcCipher_encodeSignatureCompact(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size);
+
+/** \brief Decode the signature from the compact format.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] r the byte array to store the r component of the signature
+  * \param r_size the r byte array size
+  * \param[out] s the byte array to store the s component of the signature
+  * \param s_size the s byte array size
+  * \param c the byte array storing the encoded signature
+  * \param c_size the c byte array size, the size of the encoded signature
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+  *         The compact encoding is r and s on getPrimeByteLength bytes each, 64 bytes for the 256-bit curves.
+  */
+LCFR_API uint32_t lcfr_EcCipher_decodeSignatureCompact(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* c,
+    uint32_t c_size);
+
+/** \brief Encode a batch of signatures in the DER format.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] _result the address of the output variable, the total size of the encoded signatures
+  * \param[out] der_sizes the array of count output variables, the sizes of the encoded signatures
+  * \param[out] der the byte array to store the encoded signatures one after the other
+  * \param der_size the der byte array size
+  * \param r the byte array storing the r components of the signatures
+  * \param r_size the byte size of each r component
+  * \param s the byte array storing the s components of the signatures
+  * \param s_size the byte size of each s component
+  * \param count the number of signatures
+  * \return 0 if successful, a positive number otherwise
+  * \remark Each input array stores count consecutive numbers of the given size, with the same layout as lcfr_EcCipher_verifySignatures.
+  *         The encoded signatures are stored one after the other, der_sizes being the layout of lcfr_EcCipher_verifySignaturesDer.
+  */
+LCFR_API uint32_t lcfr_EcCipher_encodeSignaturesDer(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint32_t* der_sizes,
+    uint8_t* der,
+    uint32_t der_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    uint32_t count);
+
+/** \brief Decode a batch of signatures from the DER format.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] results the array of count output variables, each being -1 if the encoding is valid, 0 otherwise
+  * \param[out] r the byte array to store the r components of the signatures
+  * \param r_size the byte size of each r component
+  * \param[out] s the byte array to store the s components of the signatures
+  * \param s_size the byte size of each s component
+  * \param der the byte array storing the encoded signatures one after the other
+  * \param der_sizes the array of the count encoded signature byte sizes
+  * \param count the number of signatures
+  * \return 0 if successful, a positive number otherwise
+  * \remark Each output array stores count consecutive numbers of the given size, with the same layout as lcfr_EcCipher_verifySignatures.
+  *         The malformed encodings are reported in results, they do not fail the call, and their r and s are set to 0,
+  *         so that lcfr_EcCipher_verifySignatures rejects them.
+  */
+LCFR_API uint32_t lcfr_EcCipher_decodeSignaturesDer(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* results,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* der,
+    const uint32_t* der_sizes,
+    uint32_t count);
+
+/** \brief Encode a batch of signatures in the compact format.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] c the byte array to store the encoded signatures
+  * \param c_size the byte size of each encoded signature
+  * \param r the byte array storing the r components of the signatures
+  * \param r_size the byte size of each r component
+  * \param s the byte array storing the s components of the signatures
+  * \param s_size the byte size of each s component
+  * \param count the number of signatures
+  * \return 0 if successful, a positive number otherwise
+  * \remark Each array stores count consecutive numbers or encodings of the given size, with the same layout as lcfr_EcCipher_verifySignatures.
+  */
+LCFR_API uint32_t lcfr_EcCipher_encodeSignaturesCompact(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    uint32_t count);
+
+/** \brief Decode a batch of signatures from the compact format.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] r the byte array to store the r components of the signatures
+  * \param r_size the byte size of each r component
+  * \param[out] s the byte array to store the s components of the signatures
+  * \param s_size the byte size of each s component
+  * \param c the byte array storing the encoded signatures
+  * \param c_size the byte size of each encoded signature
+  * \param count the number of signatures
+  * \return 0 if successful, a positive number otherwise
+  * \remark Each array stores count consecutive numbers or encodings of the given size, with the same layout as lcfr_EcCipher_verifySignatures.
+  */
+LCFR_API uint32_t lcfr_EcCipher_decodeSignaturesCompact(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* c,
+    uint32_t c_size,
+    uint32_t count);
+
+/** \brief Verify a batch of DER encoded standard ECDSA signatures.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] results the array of count output variables, each being -1 if the signature is valid, 0 otherwise
+  * \param der the byte array storing the encoded signatures one after the other
+  * \param der_sizes the array of the count encoded signature byte sizes
+  * \param hash the byte array storing the hashes
+  * \param h_size the byte size of each hash
+  * \param qx the byte array storing the x components of the public keys
+  * \param qx_size the byte size of each qx component
+  * \param qy the byte array storing the y components of the public keys
+  * \param qy_size the byte size of each qy component
+  * \param count the number of signatures
+  * \return 0 if successful, a positive number otherwise
+  * \remark Each array but der stores count consecutive numbers of the given size, with the same layout as lcfr_EcCipher_verifySignatures.
+  *         The encoded signatures are decoded a chunk at a time on the stack of the threads, with no allocation;
+  *         the malformed encodings are reported in results as invalid signatures.
+  *         The batch is split across the threads configured with lcfr_Runtime_configure, if any.
+  */
+LCFR_API uint32_t lcfr_EcCipher_verifySignaturesDer(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* results,
+    const uint8_t* der,
+    const uint32_t* der_sizes,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size,
+    uint32_t count);
+
+/** \brief Generate the recoverable signature in the compressed format with an ephemeral key drawn by the library.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] _result the address of the output variable, the size of the compressed signature
+  * \param[out] c the byte array to store the compressed signature
+  * \param c_size the c byte array size
+  * \param hash the byte array storing the hash
+  * \param h_size the hash byte array size
+  * \param sk the byte array storing the secret key
+  * \param sk_size the sk byte array size
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         The secret key bit size must not exceed the bit size of the curve points finite field prime.
+  *         The ephemeral key is drawn as with lcfr_EcCipher_generateSignatureRandom, again while the x of its point is not below the group order,
+  *         so that the recovery id is 0 or 1. The compressed signature is r and s on 2 * getPrimeByteLength bytes, the recovery id being the top bit of s.
+  */
+LCFR_API uint32_t lcfr_EcCipher_generateCompressedSignature(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* sk,
+    uint32_t sk_size);
+
+/** \brief Encode the recoverable signature in the compressed format.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] _result the address of the output variable, the size of the compressed signature
+  * \param[out] c the byte array to store the compressed signature
+  * \param c_size the c byte array size
+  * \param r the byte array storing the r component of the signature
+  * \param r_size the r byte array size
+  * \param s the byte array storing the s component of the signature
+  * \param s_size the s byte array size
+  * \param v the recovery id returned with the signature
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         The compressed signature is r and s on 2 * getPrimeByteLength bytes, the recovery id being the top bit of s.
+  *         The recovery id is the one returned by lcfr_EcCipher_generateRecoverableSignature; it must be 0 or 1,
+  *         which lcfr_EcCipher_generateCompressedSignature guarantees, and s must be low.
+  */
+LCFR_API uint32_t lcfr_EcCipher_encodeCompressedSignature(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    uint32_t v);
+
+/** \brief Decode the recoverable signature from the compressed format.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] _result the address of the output variable, the recovery id of the signature
+  * \param[out] r the byte array to store the r component of the signature
+  * \param r_size the r byte array size
+  * \param[out] s the byte array to store the s component of the signature
+  * \param s_size the s byte array size
+  * \param c the byte array storing the compressed signature
+  * \param c_size the c byte array size, the size of the compressed signature
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+  *         The compressed signature is r and s on 2 * getPrimeByteLength bytes, the recovery id being the top bit of s.
+  */
+LCFR_API uint32_t lcfr_EcCipher_decodeCompressedSignature(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* c,
+    uint32_t c_size);
+
+/** \brief Compress the public key for the verification of the compressed signatures.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] k the byte array to store the compressed key
+  * \param k_size the k byte array size, the size of the compressed key
+  * \param qx the byte array storing the x component of the public key
+  * \param qx_size the qx byte array size
+  * \param qy the byte array storing the y component of the public key
+  * \param qy_size the qy byte array size
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         The compressed key is the first k_size bytes of the SHA-256 digest of the SEC1 compressed encoding of the key,
+  *         k_size being from MIN_COMPRESSION (16) to MAX_COMPRESSION (32). It cannot be decoded: the key is recovered from the signatures.
+  */
+LCFR_API uint32_t lcfr_EcCipher_encodeCompressedKey(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* k,
+    uint32_t k_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size);
+
+/** \brief Verify the compressed signature with the compressed key.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] _result the address of the output variable, being -1 if the signature is valid, 0 otherwise
+  * \param c the byte array storing the compressed signature
+  * \param c_size the c byte array size, the size of the compressed signature
+  * \param hash the byte array storing the hash
+  * \param h_size the hash byte array size
+  * \param k the byte array storing the compressed key
+  * \param k_size the k byte array size, the size of the compressed key
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         The key is recovered from the signature, the hash and the recovery id, then compressed and compared with k.
+  *         A forger must find a signature recovering a key with the same compressed key, about 2^(8 * k_size) recoveries,
+  *         so k_size must be from MIN_COMPRESSION (16) to MAX_COMPRESSION (32).
+  */
+LCFR_API uint32_t lcfr_EcCipher_verifyCompressedSignature(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* _result,
+    const uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* k,
+    uint32_t k_size);
+
+/** \brief Verify a batch of compressed signatures with their compressed keys.
+  * \param this_ptr the address of the cipher interface
+  * \param[out] results the array of count output variables, each being -1 if the signature is valid, 0 otherwise
+  * \param c the byte array storing the compressed signatures
+  * \param c_size the byte size of each compressed signature
+  * \param hash the byte array storing the hashes
+  * \param h_size the byte size of each hash
+  * \param k the byte array storing the compressed keys
+  * \param k_size the byte size of each compressed key
+  * \param count the number of signatures
+  * \return 0 if successful, a positive number otherwise
+  * \remark Each array stores count consecutive values of the given size, with the same layout as lcfr_EcCipher_verifyCompressedSignature.
+  *         The batch is split across the threads configured with lcfr_Runtime_configure, if any.
+  */
+LCFR_API uint32_t lcfr_EcCipher_verifyCompressedSignatures(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* results,
+    const uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* k,
+    uint32_t k_size,
+    uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef _WIN32
+#define STDCALL __stdcall
+#else
+#define STDCALL
+#endif
+
+#ifdef __cplusplus
+#include <string>
+
+namespace lcfr {
+
+/**
+  * \struct IEcCipher
+  *
+  * This struct is the C++ interface to a cipher
+  * for generation and verification of digital signatures, using elliptic-curve cryptography.
+  * Standard ECDSA as well as a proprietary compressed schema are supported.
+  */
+struct IEcCipher
+{
+    /** \brief Destroy the cipher object.
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL release() = 0;
+    
+    /** \brief Initialize the cipher.
+      * \param curve the name of the curve
+      *
+      * This method is the Cipher class constructor.
+      * The following are the supported curves:
+      * - 56-bit - secp112r1, secp112r2
+      * - 64-bit - secp128r1, secp128r2
+      * - 80-bit - secp160k1, secp160r1
+      * - 96-bit - secp192k1, secp192r1
+      * - 128-bit - secp256k1, secp256r1
+      */
+    virtual uint32_t STDCALL init(
+        const char* curve) = 0;
+    
+    /** \brief Output the bit size of the curve points finite field prime.
+      * \param _result the address of the output variable
+      */
+    virtual uint32_t STDCALL getPrimeBitLength(
+        uint32_t* _result) = 0;
+    
+    /** \brief Output the byte size of the curve points finite field prime.
+      * \param _result the address of the output variable
+      */
+    virtual uint32_t STDCALL getPrimeByteLength(
+        uint32_t* _result) = 0;
+    
+    /** \brief Output the curve points finite field prime.
+      * \param[out] p the byte array to store the output prime
+      * \param p_size the byte array capacity
+      * \return 0 if successful, a positive number otherwise
+      * \remark The output prime number is written with network byte order,
+      *         if the array size exceeds required size the number is left-padded with zeros.
+      */
+    virtual uint32_t STDCALL getPrime(
+        uint8_t* p,
+        uint32_t p_size) = 0;
+    
+    /** \brief Return the bit size of the curve point coordinate finite field prime.
+      * \param[out] _result the address of the output variable
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL getCurvePointCoordinateBitLength(
+        uint32_t* _result) = 0;
+    
+    /** \brief Return the byte size of the curve point coordinate finite field prime.
+      * \param[out] _result the address of the output variable
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL getCurvePointCoordinateByteLength(
+        uint32_t* _result) = 0;
+    
+    /** \brief Output the cipher public key given the private key.
+      * \param[out] qx the byte array for the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param[out] qy the byte array for the y component of the public key
+      * \param qy_size the qy byte array size
+      * \param sk the byte array storing the secret key
+      * \param sk_size the sk byte array size
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The secret key bit size must not exceed the bit size of the curve points finite field prime.
+      */
+    virtual uint32_t STDCALL generatePublicKey(
+        uint8_t* qx,
+        uint32_t qx_size,
+        uint8_t* qy,
+        uint32_t qy_size,
+        const uint8_t* sk,
+        uint32_t sk_size) = 0;
+    
+    /** \brief Generate the standard ECDSA signature.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \param ek the byte array storing the ephemeral key
+      * \param ek_size the ek byte array size
+      * \param sk the byte array storing the secret key
+      * \param sk_size the sk byte array size
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The ephemeral key and secret key bit sizes must not exceed the bit size of the curve points finite field prime.
+      */
+    virtual uint32_t STDCALL generateSignature(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size) = 0;
+    
+    /** \brief Verify the standard ECDSA signature.
+      * \param[out] _result the address of the output variable, being 0 if successful, positive number otherwise
+      * \param r the byte array storing the r component of the signature
+      * \param r_size the r byte array size
+      * \param s the byte array storing the s component of the signature
+      * \param s_size the s byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \param qx the byte array storing the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param qy the byte array storing the y component of the public key
+      * \param qy_size the qy byte array size
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      */
+    virtual uint32_t STDCALL verifySignature(
+        int32_t* _result,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size) = 0;
+    
+    /** \brief Generate a batch of standard ECDSA signatures.
+      * \param[out] r the byte array to store the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param[out] s the byte array to store the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param hash the byte array storing the hashes
+      * \param h_size the byte size of each hash
+      * \param ek the byte array storing the ephemeral keys
+      * \param ek_size the byte size of each ephemeral key
+      * \param sk the byte array storing the secret keys
+      * \param sk_size the byte size of each secret key
+      * \param count the number of signatures
+      * \return 0 if successful, a positive number otherwise
+      * \remark Each array stores count consecutive numbers of the given size, with the same layout as generateSignature.
+      */
+    virtual uint32_t STDCALL generateSignatures(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size,
+        uint32_t count) = 0;
+    
+    /** \brief Verify a batch of standard ECDSA signatures.
+      * \param[out] results the array of count output variables, each being -1 if the signature is valid, 0 otherwise
+      * \param r the byte array storing the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param s the byte array storing the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param hash the byte array storing the hashes
+      * \param h_size the byte size of each hash
+      * \param qx the byte array storing the x components of the public keys
+      * \param qx_size the byte size of each qx component
+      * \param qy the byte array storing the y components of the public keys
+      * \param qy_size the byte size of each qy component
+      * \param count the number of signatures
+      * \return 0 if successful, a positive number otherwise
+      * \remark Each array stores count consecutive numbers of the given size, with the same layout as verifySignature.
+      */
+    virtual uint32_t STDCALL verifySignatures(
+        int32_t* results,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size,
+        uint32_t count) = 0;
+    
+    /** \brief Hash the message with SHA-256 and generate the standard ECDSA signature of the digest.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param m the byte array storing the message
+      * \param m_size the m byte array size
+      * \param ek the byte array storing the ephemeral key
+      * \param ek_size the ek byte array size
+      * \param sk the byte array storing the secret key
+      * \param sk_size the sk byte array size
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The ephemeral key and secret key bit sizes must not exceed the bit size of the curve points finite field prime.
+      */
+    virtual uint32_t STDCALL signMessage(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        uint32_t m_size,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size) = 0;
+    
+    /** \brief Hash the message with SHA-256 and verify the standard ECDSA signature of the digest.
+      * \param[out] _result the address of the output variable, being -1 if the signature is valid, 0 otherwise
+      * \param r the byte array storing the r component of the signature
+      * \param r_size the r byte array size
+      * \param s the byte array storing the s component of the signature
+      * \param s_size the s byte array size
+      * \param m the byte array storing the message
+      * \param m_size the m byte array size
+      * \param qx the byte array storing the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param qy the byte array storing the y component of the public key
+      * \param qy_size the qy byte array size
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      */
+    virtual uint32_t STDCALL verifyMessage(
+        int32_t* _result,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        uint32_t m_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size) = 0;
+    
+    /** \brief Hash a batch of messages with SHA-256 and generate the standard ECDSA signatures of the digests.
+      * \param[out] r the byte array to store the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param[out] s the byte array to store the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param m the byte array storing the messages one after the other
+      * \param m_sizes the array of the count message byte sizes
+      * \param ek the byte array storing the ephemeral keys
+      * \param ek_size the byte size of each ephemeral key
+      * \param sk the byte array storing the secret keys
+      * \param sk_size the byte size of each secret key
+      * \param count the number of signatures
+      * \return 0 if successful, a positive number otherwise
+      * \remark Each array but m and m_sizes stores count consecutive numbers of the given size, with the same layout as generateSignature.
+      *         The messages are hashed several at a time and the batch is split across the threads configured with lcfr_Runtime_configure, if any.
+      */
+    virtual uint32_t STDCALL signMessages(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        const uint32_t* m_sizes,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size,
+        uint32_t count) = 0;
+    
+    /** \brief Hash a batch of messages with SHA-256 and verify the standard ECDSA signatures of the digests.
+      * \param[out] results the array of count output variables, each being -1 if the signature is valid, 0 otherwise
+      * \param r the byte array storing the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param s the byte array storing the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param m the byte array storing the messages one after the other
+      * \param m_sizes the array of the count message byte sizes
+      * \param qx the byte array storing the x components of the public keys
+      * \param qx_size the byte size of each qx component
+      * \param qy the byte array storing the y components of the public keys
+      * \param qy_size the byte size of each qy component
+      * \param count the number of signatures
+      * \return 0 if successful, a positive number otherwise
+      * \remark Each array but m and m_sizes stores count consecutive numbers of the given size, with the same layout as verifySignature.
+      *         The messages are hashed several at a time and the batch is split across the threads configured with lcfr_Runtime_configure, if any.
+      */
+    virtual uint32_t STDCALL verifyMessages(
+        int32_t* results,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        const uint32_t* m_sizes,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size,
+        uint32_t count) = 0;
+    
+    /** \brief Generate the standard ECDSA signature with an ephemeral key drawn by the library.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \param sk the byte array storing the secret key
+      * \param sk_size the sk byte array size
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The secret key bit size must not exceed the bit size of the curve points finite field prime.
+      *         The ephemeral key is uniform between 1 and the group order - 1. It is drawn from a ChaCha20 generator of the calling thread,
+      *         seeded by the operating system and seeded again periodically and after a fork.
+      */
+    virtual uint32_t STDCALL generateSignatureRandom(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* sk,
+        uint32_t sk_size) = 0;
+    
+    /** \brief Encode the public key in the SEC1 format.
+      * \param[out] _result the address of the output variable, the size of the encoded key
+      * \param[out] q the byte array to store the encoded key
+      * \param q_size the q byte array size
+      * \param qx the byte array storing the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param qy the byte array storing the y component of the public key
+      * \param qy_size the qy byte array size
+      * \param compressed if not 0 the key is compressed to 0x02 or 0x03 and qx, else it is 0x04, qx and qy
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         The encoded key takes 1 + getCurvePointCoordinateByteLength bytes when compressed, 1 + 2 * getCurvePointCoordinateByteLength otherwise.
+      */
+    virtual uint32_t STDCALL encodePublicKey(
+        uint32_t* _result,
+        uint8_t* q,
+        uint32_t q_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size,
+        uint32_t compressed) = 0;
+    
+    /** \brief Decode the public key from the SEC1 format.
+      * \param[out] qx the byte array to store the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param[out] qy the byte array to store the y component of the public key
+      * \param qy_size the qy byte array size
+      * \param q the byte array storing the encoded key
+      * \param q_size the q byte array size, the size of the encoded key
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The compressed (0x02 or 0x03) and the uncompressed (0x04) formats are accepted. The key must be on the curve;
+      *         for the compressed format qy is computed with a square root modulo the curve points finite field prime.
+      */
+    virtual uint32_t STDCALL decodePublicKey(
+        uint8_t* qx,
+        uint32_t qx_size,
+        uint8_t* qy,
+        uint32_t qy_size,
+        const uint8_t* q,
+        uint32_t q_size) = 0;
+    
+    /** \brief Decode a batch of public keys from the SEC1 format.
+      * \param[out] results the array of count output variables, each being -1 if the key is valid, 0 otherwise
+      * \param[out] qx the byte array to store the x components of the public keys
+      * \param qx_size the byte size of each qx component
+      * \param[out] qy the byte array to store the y components of the public keys
+      * \param qy_size the byte size of each qy component
+      * \param q the byte array storing the encoded keys
+      * \param q_size the byte size of each encoded key
+      * \param count the number of keys
+      * \return 0 if successful, a positive number otherwise
+      * \remark Each array stores count consecutive numbers of the given size, with the same layout as decodePublicKey.
+      *         The malformed keys and the keys not on the curve are reported in results, they do not fail the call.
+      *         The batch is split across the threads configured with lcfr_Runtime_configure, if any.
+      */
+    virtual uint32_t STDCALL decodePublicKeys(
+        int32_t* results,
+        uint8_t* qx,
+        uint32_t qx_size,
+        uint8_t* qy,
+        uint32_t qy_size,
+        const uint8_t* q,
+        uint32_t q_size,
+        uint32_t count) = 0;
+    
+    /** \brief Generate the standard ECDSA signature and its recovery id.
+      * \param[out] _result the address of the output variable, the recovery id of the signature
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \param ek the byte array storing the ephemeral key
+      * \param ek_size the ek byte array size
+      * \param sk the byte array storing the secret key
+      * \param sk_size the sk byte array size
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The ephemeral key and secret key bit sizes must not exceed the bit size of the curve points finite field prime.
+      *         The recovery id is the parity of the y component of the point R of the signature plus twice the quotient of its
+      *         x component by the group order, R being ek * G, or -ek * G when s is replaced by the group order - s.
+      *         It is between 0 and 3, up to 9 for secp112r2 and secp128r2 whose cofactor is 4.
+      *         With it recoverPublicKey computes the public key from the signature.
+      */
+    virtual uint32_t STDCALL generateRecoverableSignature(
+        uint32_t* _result,
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size) = 0;
+    
+    /** \brief Recover the public key of a signature from the signature, the hash and the recovery id.
+      * \param[out] qx the byte array to store the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param[out] qy the byte array to store the y component of the public key
+      * \param qy_size the qy byte array size
+      * \param r the byte array storing the r component of the signature
+      * \param r_size the r byte array size
+      * \param s the byte array storing the s component of the signature
+      * \param s_size the s byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \param v the recovery id returned with the signature
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The call fails if the signature components are not between 1 and the group order - 1 or if the recovery id
+      *         does not select a point of the curve. A recovered key is the key of a valid signature: the signatures of other
+      *         keys recover other keys, so the caller still compares the recovered key with the expected one.
+      */
+    virtual uint32_t STDCALL recoverPublicKey(
+        uint8_t* qx,
+        uint32_t qx_size,
+        uint8_t* qy,
+        uint32_t qy_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        uint32_t v) = 0;
+    
+    /** \brief Encode the signature in the DER format.
+      * \param[out] _result the address of the output variable, the size of the encoded signature
+      * \param[out] der the byte array to store the encoded signature
+      * \param der_size the der byte array size
+      * \param r the byte array storing the r component of the signature
+      * \param r_size the r byte array size
+      * \param s the byte array storing the s component of the signature
+      * \param s_size the s byte array size
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         The DER encoding is the SEQUENCE of the INTEGERs r and s, at most 2 * getPrimeByteLength + 8 bytes long.
+      */
+    virtual uint32_t STDCALL encodeSignatureDer(
+        uint32_t* _result,
+        uint8_t* der,
+        uint32_t der_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size) = 0;
+    
+    /** \brief Decode the signature from the DER format.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param der the byte array storing the encoded signature
+      * \param der_size the der byte array size, the size of the encoded signature
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The DER encoding is the SEQUENCE of the INTEGERs r and s, at most 2 * getPrimeByteLength + 8 bytes long.
+      *         The encoding must be strict: minimal lengths, positive minimal integers and no trailing bytes.
+      */
+    virtual uint32_t STDCALL decodeSignatureDer(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* der,
+        uint32_t der_size) = 0;
+    
+    /** \brief Encode the signature in the compact format.
+      * \param[out] _result the address of the output variable, the size of the encoded signature
+      * \param[out] c the byte array to store the encoded signature
+      * \param c_size the c byte array size
+      * \param r the byte array storing the r component of the signature
+      * \param r_size the r byte array size
+      * \param s the byte array storing the s component of the signature
+      * \param s_size the s byte array size
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         The compact encoding is r and s on getPrimeByteLength bytes each, 64 bytes for the 256-bit curves.
+      */
+    virtual uint32_t STDCALL encodeSignatureCompact(
+        uint32_t* _result,
+        uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size) = 0;
+    
+    /** \brief Decode the signature from the compact format.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param c the byte array storing the encoded signature
+      * \param c_size the c byte array size, the size of the encoded signature
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The compact encoding is r and s on getPrimeByteLength bytes each, 64 bytes for the 256-bit curves.
+      */
+    virtual uint32_t STDCALL decodeSignatureCompact(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* c,
+        uint32_t c_size) = 0;
+    
+    /** \brief Encode a batch of signatures in the DER format.
+      * \param[out] _result the address of the output variable, the total size of the encoded signatures
+      * \param[out] der_sizes the array of count output variables, the sizes of the encoded signatures
+      * \param[out] der the byte array to store the encoded signatures one after the other
+      * \param der_size the der byte array size
+      * \param r the byte array storing the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param s the byte array storing the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param count the number of signatures
+      * \return 0 if successful, a positive number otherwise
+      * \remark Each input array stores count consecutive numbers of the given size, with the same layout as verifySignatures.
+      *         The encoded signatures are stored one after the other, der_sizes being the layout of verifySignaturesDer.
+      */
+    virtual uint32_t STDCALL encodeSignaturesDer(
+        uint32_t* _result,
+        uint32_t* der_sizes,
+        uint8_t* der,
+        uint32_t der_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        uint32_t count) = 0;
+    
+    /** \brief Decode a batch of signatures from the DER format.
+      * \param[out] results the array of count output variables, each being -1 if the encoding is valid, 0 otherwise
+      * \param[out] r the byte array to store the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param[out] s the byte array to store the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param der the byte array storing the encoded signatures one after the other
+      * \param der_sizes the array of the count encoded signature byte sizes
+      * \param count the number of signatures
+      * \return 0 if successful, a positive number otherwise
+      * \remark Each output array stores count consecutive numbers of the given size, with the same layout as verifySignatures.
+      *         The malformed encodings are reported in results, they do not fail the call, and their r and s are set to 0,
+      *         so that verifySignatures rejects them.
+      */
+    virtual uint32_t STDCALL decodeSignaturesDer(
+        int32_t* results,
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* der,
+        const uint32_t* der_sizes,
+        uint32_t count) = 0;
+    
+    /** \brief Encode a batch of signatures in the compact format.
+      * \param[out] c the byte array to store the encoded signatures
+      * \param c_size the byte size of each encoded signature
+      * \param r the byte array storing the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param s the byte array storing the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param count the number of signatures
+      * \return 0 if successful, a positive number otherwise
+      * \remark Each array stores count consecutive numbers or encodings of the given size, with the same layout as verifySignatures.
+      */
+    virtual uint32_t STDCALL encodeSignaturesCompact(
+        uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        uint32_t count) = 0;
+    
+    /** \brief Decode a batch of signatures from the compact format.
+      * \param[out] r the byte array to store the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param[out] s the byte array to store the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param c the byte array storing the encoded signatures
+      * \param c_size the byte size of each encoded signature
+      * \param count the number of signatures
+      * \return 0 if successful, a positive number otherwise
+      * \remark Each array stores count consecutive numbers or encodings of the given size, with the same layout as verifySignatures.
+      */
+    virtual uint32_t STDCALL decodeSignaturesCompact(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* c,
+        uint32_t c_size,
+        uint32_t count) = 0;
+    
+    /** \brief Verify a batch of DER encoded standard ECDSA signatures.
+      * \param[out] results the array of count output variables, each being -1 if the signature is valid, 0 otherwise
+      * \param der the byte array storing the encoded signatures one after the other
+      * \param der_sizes the array of the count encoded signature byte sizes
+      * \param hash the byte array storing the hashes
+      * \param h_size the byte size of each hash
+      * \param qx the byte array storing the x components of the public keys
+      * \param qx_size the byte size of each qx component
+      * \param qy the byte array storing the y components of the public keys
+      * \param qy_size the byte size of each qy component
+      * \param count the number of signatures
+      * \return 0 if successful, a positive number otherwise
+      * \remark Each array but der stores count consecutive numbers of the given size, with the same layout as verifySignatures.
+      *         The encoded signatures are decoded a chunk at a time on the stack of the threads, with no allocation;
+      *         the malformed encodings are reported in results as invalid signatures.
+      *         The batch is split across the threads configured with lcfr_Runtime_configure, if any.
+      */
+    virtual uint32_t STDCALL verifySignaturesDer(
+        int32_t* results,
+        const uint8_t* der,
+        const uint32_t* der_sizes,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size,
+        uint32_t count) = 0;
+    
+    /** \brief Generate the recoverable signature in the compressed format with an ephemeral key drawn by the library.
+      * \param[out] _result the address of the output variable, the size of the compressed signature
+      * \param[out] c the byte array to store the compressed signature
+      * \param c_size the c byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \param sk the byte array storing the secret key
+      * \param sk_size the sk byte array size
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         The secret key bit size must not exceed the bit size of the curve points finite field prime.
+      *         The ephemeral key is drawn as with generateSignatureRandom, again while the x of its point is not below the group order,
+      *         so that the recovery id is 0 or 1. The compressed signature is r and s on 2 * getPrimeByteLength bytes, the recovery id being the top bit of s.
+      */
+    virtual uint32_t STDCALL generateCompressedSignature(
+        uint32_t* _result,
+        uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* sk,
+        uint32_t sk_size) = 0;
+    
+    /** \brief Encode the recoverable signature in the compressed format.
+      * \param[out] _result the address of the output variable, the size of the compressed signature
+      * \param[out] c the byte array to store the compressed signature
+      * \param c_size the c byte array size
+      * \param r the byte array storing the r component of the signature
+      * \param r_size the r byte array size
+      * \param s the byte array storing the s component of the signature
+      * \param s_size the s byte array size
+      * \param v the recovery id returned with the signature
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         The compressed signature is r and s on 2 * getPrimeByteLength bytes, the recovery id being the top bit of s.
+      *         The recovery id is the one returned by generateRecoverableSignature; it must be 0 or 1,
+      *         which generateCompressedSignature guarantees, and s must be low.
+      */
+    virtual uint32_t STDCALL encodeCompressedSignature(
+        uint32_t* _result,
+        uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        uint32_t v) = 0;
+    
+    /** \brief Decode the recoverable signature from the compressed format.
+      * \param[out] _result the address of the output variable, the recovery id of the signature
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param c the byte array storing the compressed signature
+      * \param c_size the c byte array size, the size of the compressed signature
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The compressed signature is r and s on 2 * getPrimeByteLength bytes, the recovery id being the top bit of s.
+      */
+    virtual uint32_t STDCALL decodeCompressedSignature(
+        uint32_t* _result,
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* c,
+        uint32_t c_size) = 0;
+    
+    /** \brief Compress the public key for the verification of the compressed signatures.
+      * \param[out] k the byte array to store the compressed key
+      * \param k_size the k byte array size, the size of the compressed key
+      * \param qx the byte array storing the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param qy the byte array storing the y component of the public key
+      * \param qy_size the qy byte array size
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         The compressed key is the first k_size bytes of the SHA-256 digest of the SEC1 compressed encoding of the key,
+      *         k_size being from MIN_COMPRESSION (16) to MAX_COMPRESSION (32). It cannot be decoded: the key is recovered from the signatures.
+      */
+    virtual uint32_t STDCALL encodeCompressedKey(
+        uint8_t* k,
+        uint32_t k_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size) = 0;
+    
+    /** \brief Verify the compressed signature with the compressed key.
+      * \param[out] _result the address of the output variable, being -1 if the signature is valid, 0 otherwise
+      * \param c the byte array storing the compressed signature
+      * \param c_size the c byte array size, the size of the compressed signature
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \param k the byte array storing the compressed key
+      * \param k_size the k byte array size, the size of the compressed key
+      * \return 0 if successful, a positive number otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         The key is recovered from the signature, the hash and the recovery id, then compressed and compared with k.
+      *         A forger must find a signature recovering a key with the same compressed key, about 2^(8 * k_size) recoveries,
+      *         so k_size must be from MIN_COMPRESSION (16) to MAX_COMPRESSION (32).
+      */
+    virtual uint32_t STDCALL verifyCompressedSignature(
+        int32_t* _result,
+        const uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* k,
+        uint32_t k_size) = 0;
+    
+    /** \brief Verify a batch of compressed signatures with their compressed keys.
+      * \param[out] results the array of count output variables, each being -1 if the signature is valid, 0 otherwise
+      * \param c the byte array storing the compressed signatures
+      * \param c_size the byte size of each compressed signature
+      * \param hash the byte array storing the hashes
+      * \param h_size the byte size of each hash
+      * \param k the byte array storing the compressed keys
+      * \param k_size the byte size of each compressed key
+      * \param count the number of signatures
+      * \return 0 if successful, a positive number otherwise
+      * \remark Each array stores count consecutive values of the given size, with the same layout as verifyCompressedSignature.
+      *         The batch is split across the threads configured with lcfr_Runtime_configure, if any.
+      */
+    virtual uint32_t STDCALL verifyCompressedSignatures(
+        int32_t* results,
+        const uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* k,
+        uint32_t k_size,
+        uint32_t count) = 0;
+};
+
+/**
+  * \class EcCipherProxy
+  *
+  * This class implements a cipher for generation and verification of digital signatures, using elliptic-curve cryptography.
+  * Standard ECDSA as well as a proprietary compressed schema are supported.
+  */
+class EcCipherProxy
+{
+    lcfr::IEcCipher* obj_;
+    
     public:
     
-    /** \brief Create an EcCipherProxy.
-      * \param curve the name of the curve
-      *
-      * This method is the Cipher class constructor.
-      * The following are the supported curves:
-      * - 56-bit - secp112r1, secp112r2
-      * - 64-bit - secp128r1, secp128r2
-      * - 80-bit - secp160k1, secp160r1
-      * - 96-bit - secp192k1, secp192r1
-      * - 128-bit - secp256k1, secp256r1
+    /** \brief Create an EcCipherProxy.
+      * \param curve the name of the curve
+      *
+      * This method is the Cipher class constructor.
+      * The following are the supported curves:
+      * - 56-bit - secp112r1, secp112r2
+      * - 64-bit - secp128r1, secp128r2
+      * - 80-bit - secp160k1, secp160r1
+      * - 96-bit - secp192k1, secp192r1
+      * - 128-bit - secp256k1, secp256r1
+      */
+    EcCipherProxy(
+        const std::string& curve)
+    {
+        int code = lcfr_EcCipher_create(
+            (lcfr_EcCipher_vtable_ptr**)&obj_,
+            curve.c_str());
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Return the bit size of the curve points finite field prime.
+      */
+    uint32_t getPrimeBitLength()
+    {
+        uint32_t _result;
+        int code = obj_->getPrimeBitLength(
+            &_result);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Return the byte size of the curve points finite field prime.
+      */
+    uint32_t getPrimeByteLength()
+    {
+        uint32_t _result;
+        int code = obj_->getPrimeByteLength(
+            &_result);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Output the curve points finite field prime.
+      * \param[out] p the byte array to store the output prime
+      * \param p_size the byte array capacity
+      * \remark The output prime number is written with network byte order,
+      *         if the array size exceeds required size the number is left-padded with zeros.
+      */
+    void getPrime(
+        uint8_t* p,
+        uint32_t p_size)
+    {
+        int code = obj_->getPrime(
+            p,
+            p_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Return the bit size of the curve point coordinate finite field prime.
+      */
+    uint32_t getCurvePointCoordinateBitLength()
+    {
+        uint32_t _result;
+        int code = obj_->getCurvePointCoordinateBitLength(
+            &_result);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Return the byte size of the curve point coordinate finite field prime.
+      */
+    uint32_t getCurvePointCoordinateByteLength()
+    {
+        uint32_t _result;
+        int code = obj_->getCurvePointCoordinateByteLength(
+            &_result);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Output the cipher public key given the private key.
+      * \param[out] qx the byte array for the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param[out] qy the byte array for the y component of the public key
+      * \param qy_size the qy byte array size
+      * \param sk the byte array storing the secret key
+      * \param sk_size the sk byte array size
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The secret key bit size must not exceed the bit size of the curve points finite field prime.
+      */
+    void generatePublicKey(
+        uint8_t* qx,
+        uint32_t qx_size,
+        uint8_t* qy,
+        uint32_t qy_size,
+        const uint8_t* sk,
+        uint32_t sk_size)
+    {
+        int code = obj_->generatePublicKey(
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            sk,
+            sk_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Generate the standard ECDSA signature.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \param ek the byte array storing the ephemeral key
+      * \param ek_size the ek byte array size
+      * \param sk the byte array storing the secret key
+      * \param sk_size the sk byte array size
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The ephemeral key and secret key bit sizes must not exceed the bit size of the curve points finite field prime.
+      */
+    void generateSignature(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size)
+    {
+        int code = obj_->generateSignature(
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            ek,
+            ek_size,
+            sk,
+            sk_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Verify the standard ECDSA signature.
+      * \param r the byte array storing the r component of the signature
+      * \param r_size the r byte array size
+      * \param s the byte array storing the s component of the signature
+      * \param s_size the s byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \param qx the byte array storing the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param qy the byte array storing the y component of the public key
+      * \param qy_size the qy byte array size
+      * \return -1 if the signature is valid, 0 otherwise
+      * \remark All in/out numbers are written with network byte order.
+      */
+    int32_t verifySignature(
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size)
+    {
+        int32_t _result;
+        int code = obj_->verifySignature(
+            &_result,
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            qx,
+            qx_size,
+            qy,
+            qy_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Generate a batch of standard ECDSA signatures.
+      * \param[out] r the byte array to store the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param[out] s the byte array to store the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param hash the byte array storing the hashes
+      * \param h_size the byte size of each hash
+      * \param ek the byte array storing the ephemeral keys
+      * \param ek_size the byte size of each ephemeral key
+      * \param sk the byte array storing the secret keys
+      * \param sk_size the byte size of each secret key
+      * \param count the number of signatures
+      * \remark Each array stores count consecutive numbers of the given size, with the same layout as generateSignature.
+      */
+    void generateSignatures(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size,
+        uint32_t count)
+    {
+        int code = obj_->generateSignatures(
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            ek,
+            ek_size,
+            sk,
+            sk_size,
+            count);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Verify a batch of standard ECDSA signatures.
+      * \param[out] results the array of count output variables, each being -1 if the signature is valid, 0 otherwise
+      * \param r the byte array storing the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param s the byte array storing the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param hash the byte array storing the hashes
+      * \param h_size the byte size of each hash
+      * \param qx the byte array storing the x components of the public keys
+      * \param qx_size the byte size of each qx component
+      * \param qy the byte array storing the y components of the public keys
+      * \param qy_size the byte size of each qy component
+      * \param count the number of signatures
+      * \remark Each array stores count consecutive numbers of the given size, with the same layout as verifySignature.
+      */
+    void verifySignatures(
+        int32_t* results,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size,
+        uint32_t count)
+    {
+        int code = obj_->verifySignatures(
+            results,
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            count);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Hash the message with SHA-256 and generate the standard ECDSA signature of the digest.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param m the byte array storing the message
+      * \param m_size the m byte array size
+      * \param ek the byte array storing the ephemeral key
+      * \param ek_size the ek byte array size
+      * \param sk the byte array storing the secret key
+      * \param sk_size the sk byte array size
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The ephemeral key and secret key bit sizes must not exceed the bit size of the curve points finite field prime.
+      */
+    void signMessage(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        uint32_t m_size,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size)
+    {
+        int code = obj_->signMessage(
+            r,
+            r_size,
+            s,
+            s_size,
+            m,
+            m_size,
+            ek,
+            ek_size,
+            sk,
+            sk_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Hash the message with SHA-256 and verify the standard ECDSA signature of the digest.
+      * \param r the byte array storing the r component of the signature
+      * \param r_size the r byte array size
+      * \param s the byte array storing the s component of the signature
+      * \param s_size the s byte array size
+      * \param m the byte array storing the message
+      * \param m_size the m byte array size
+      * \param qx the byte array storing the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param qy the byte array storing the y component of the public key
+      * \param qy_size the qy byte array size
+      * \return -1 if the signature is valid, 0 otherwise
+      * \remark All in/out numbers are written with network byte order.
+      */
+    int32_t verifyMessage(
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        uint32_t m_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size)
+    {
+        int32_t _result;
+        int code = obj_->verifyMessage(
+            &_result,
+            r,
+            r_size,
+            s,
+            s_size,
+            m,
+            m_size,
+            qx,
+            qx_size,
+            qy,
+            qy_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Hash a batch of messages with SHA-256 and generate the standard ECDSA signatures of the digests.
+      * \param[out] r the byte array to store the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param[out] s the byte array to store the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param m the byte array storing the messages one after the other
+      * \param m_sizes the array of the count message byte sizes
+      * \param ek the byte array storing the ephemeral keys
+      * \param ek_size the byte size of each ephemeral key
+      * \param sk the byte array storing the secret keys
+      * \param sk_size the byte size of each secret key
+      * \param count the number of signatures
+      * \remark Each array but m and m_sizes stores count consecutive numbers of the given size, with the same layout as generateSignature.
+      *         The messages are hashed several at a time and the batch is split across the threads configured with lcfr_Runtime_configure, if any.
+      */
+    void signMessages(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        const uint32_t* m_sizes,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size,
+        uint32_t count)
+    {
+        int code = obj_->signMessages(
+            r,
+            r_size,
+            s,
+            s_size,
+            m,
+            m_sizes,
+            ek,
+            ek_size,
+            sk,
+            sk_size,
+            count);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Hash a batch of messages with SHA-256 and verify the standard ECDSA signatures of the digests.
+      * \param[out] results the array of count output variables, each being -1 if the signature is valid, 0 otherwise
+      * \param r the byte array storing the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param s the byte array storing the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param m the byte array storing the messages one after the other
+      * \param m_sizes the array of the count message byte sizes
+      * \param qx the byte array storing the x components of the public keys
+      * \param qx_size the byte size of each qx component
+      * \param qy the byte array storing the y components of the public keys
+      * \param qy_size the byte size of each qy component
+      * \param count the number of signatures
+      * \remark Each array but m and m_sizes stores count consecutive numbers of the given size, with the same layout as verifySignature.
+      *         The messages are hashed several at a time and the batch is split across the threads configured with lcfr_Runtime_configure, if any.
+      */
+    void verifyMessages(
+        int32_t* results,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        const uint32_t* m_sizes,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size,
+        uint32_t count)
+    {
+        int code = obj_->verifyMessages(
+            results,
+            r,
+            r_size,
+            s,
+            s_size,
+            m,
+            m_sizes,
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            count);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Generate the standard ECDSA signature with an ephemeral key drawn by the library.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \param sk the byte array storing the secret key
+      * \param sk_size the sk byte array size
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The secret key bit size must not exceed the bit size of the curve points finite field prime.
+      *         The ephemeral key is uniform between 1 and the group order - 1. It is drawn from a ChaCha20 generator of the calling thread,
+      *         seeded by the operating system and seeded again periodically and after a fork.
       */
-    EcCipherProxy(
-        const std::string& curve)
+    void generateSignatureRandom(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* sk,
+        uint32_t sk_size)
     {
-        int code = lcfr_EcCipher_create(
-            (lcfr_EcCipher_vtable_ptr**)&obj_,
-            curve.c_str());
+        int code = obj_->generateSignatureRandom(
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            sk,
+            sk_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Encode the public key in the SEC1 format.
+      * \param[out] q the byte array to store the encoded key
+      * \param q_size the q byte array size
+      * \param qx the byte array storing the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param qy the byte array storing the y component of the public key
+      * \param qy_size the qy byte array size
+      * \param compressed if true the key is compressed to 0x02 or 0x03 and qx, else it is 0x04, qx and qy
+      * \return the size of the encoded key
+      * \remark All in/out numbers are written with network byte order.
+      *         The encoded key takes 1 + getCurvePointCoordinateByteLength bytes when compressed, 1 + 2 * getCurvePointCoordinateByteLength otherwise.
+      */
+    uint32_t encodePublicKey(
+        uint8_t* q,
+        uint32_t q_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size,
+        bool compressed)
+    {
+        uint32_t _result;
+        int code = obj_->encodePublicKey(
+            &_result,
+            q,
+            q_size,
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            compressed ? 1 : 0);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Decode the public key from the SEC1 format.
+      * \param[out] qx the byte array to store the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param[out] qy the byte array to store the y component of the public key
+      * \param qy_size the qy byte array size
+      * \param q the byte array storing the encoded key
+      * \param q_size the q byte array size, the size of the encoded key
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The compressed (0x02 or 0x03) and the uncompressed (0x04) formats are accepted. The key must be on the curve;
+      *         for the compressed format qy is computed with a square root modulo the curve points finite field prime.
+      */
+    void decodePublicKey(
+        uint8_t* qx,
+        uint32_t qx_size,
+        uint8_t* qy,
+        uint32_t qy_size,
+        const uint8_t* q,
+        uint32_t q_size)
+    {
+        int code = obj_->decodePublicKey(
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            q,
+            q_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Decode a batch of public keys from the SEC1 format.
+      * \param[out] results the array of count output variables, each being -1 if the key is valid, 0 otherwise
+      * \param[out] qx the byte array to store the x components of the public keys
+      * \param qx_size the byte size of each qx component
+      * \param[out] qy the byte array to store the y components of the public keys
+      * \param qy_size the byte size of each qy component
+      * \param q the byte array storing the encoded keys
+      * \param q_size the byte size of each encoded key
+      * \param count the number of keys
+      * \remark Each array stores count consecutive numbers of the given size, with the same layout as decodePublicKey.
+      *         The malformed keys and the keys not on the curve are reported in results, they do not fail the call.
+      *         The batch is split across the threads configured with lcfr_Runtime_configure, if any.
+      */
+    void decodePublicKeys(
+        int32_t* results,
+        uint8_t* qx,
+        uint32_t qx_size,
+        uint8_t* qy,
+        uint32_t qy_size,
+        const uint8_t* q,
+        uint32_t q_size,
+        uint32_t count)
+    {
+        int code = obj_->decodePublicKeys(
+            results,
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            q,
+            q_size,
+            count);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Generate the standard ECDSA signature and its recovery id.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \param ek the byte array storing the ephemeral key
+      * \param ek_size the ek byte array size
+      * \param sk the byte array storing the secret key
+      * \param sk_size the sk byte array size
+      * \return the recovery id of the signature
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The ephemeral key and secret key bit sizes must not exceed the bit size of the curve points finite field prime.
+      *         The recovery id is the parity of the y component of the point R of the signature plus twice the quotient of its
+      *         x component by the group order, R being ek * G, or -ek * G when s is replaced by the group order - s.
+      *         It is between 0 and 3, up to 9 for secp112r2 and secp128r2 whose cofactor is 4.
+      *         With it recoverPublicKey computes the public key from the signature.
+      */
+    uint32_t generateRecoverableSignature(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size)
+    {
+        uint32_t _result;
+        int code = obj_->generateRecoverableSignature(
+            &_result,
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            ek,
+            ek_size,
+            sk,
+            sk_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Recover the public key of a signature from the signature, the hash and the recovery id.
+      * \param[out] qx the byte array to store the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param[out] qy the byte array to store the y component of the public key
+      * \param qy_size the qy byte array size
+      * \param r the byte array storing the r component of the signature
+      * \param r_size the r byte array size
+      * \param s the byte array storing the s component of the signature
+      * \param s_size the s byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \param v the recovery id returned with the signature
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The call fails if the signature components are not between 1 and the group order - 1 or if the recovery id
+      *         does not select a point of the curve. A recovered key is the key of a valid signature: the signatures of other
+      *         keys recover other keys, so the caller still compares the recovered key with the expected one.
+      */
+    void recoverPublicKey(
+        uint8_t* qx,
+        uint32_t qx_size,
+        uint8_t* qy,
+        uint32_t qy_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        uint32_t v)
+    {
+        int code = obj_->recoverPublicKey(
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            v);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Encode the signature in the DER format.
+      * \param[out] der the byte array to store the encoded signature
+      * \param der_size the der byte array size
+      * \param r the byte array storing the r component of the signature
+      * \param r_size the r byte array size
+      * \param s the byte array storing the s component of the signature
+      * \param s_size the s byte array size
+      * \return the size of the encoded signature
+      * \remark All in/out numbers are written with network byte order.
+      *         The DER encoding is the SEQUENCE of the INTEGERs r and s, at most 2 * getPrimeByteLength + 8 bytes long.
+      */
+    uint32_t encodeSignatureDer(
+        uint8_t* der,
+        uint32_t der_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size)
+    {
+        uint32_t _result;
+        int code = obj_->encodeSignatureDer(
+            &_result,
+            der,
+            der_size,
+            r,
+            r_size,
+            s,
+            s_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Decode the signature from the DER format.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param der the byte array storing the encoded signature
+      * \param der_size the der byte array size, the size of the encoded signature
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The DER encoding is the SEQUENCE of the INTEGERs r and s, at most 2 * getPrimeByteLength + 8 bytes long.
+      *         The encoding must be strict: minimal lengths, positive minimal integers and no trailing bytes.
+      */
+    void decodeSignatureDer(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* der,
+        uint32_t der_size)
+    {
+        int code = obj_->decodeSignatureDer(
+            r,
+            r_size,
+            s,
+            s_size,
+            der,
+            der_size);
         if (code != 0)
         {
             const char* message;
@@ -393,13 +2651,34 @@ class EcCipherProxy
         }
     }
     
-    /** \brief Return the bit size of the curve points finite field prime.
+    /** \brief Encode the signature in the compact format.
+      * \param[out] c the byte array to store the encoded signature
+      * \param c_size the c byte array size
+      * \param r the byte array storing the r component of the signature
+      * \param r_size the r byte array size
+      * \param s the byte array storing the s component of the signature
+      * \param s_size the s byte array size
+      * \return the size of the encoded signature
+      * \remark All in/out numbers are written with network byte order.
+      *         The compact encoding is r and s on getPrimeByteLength bytes each, 64 bytes for the 256-bit curves.
       */
-    uint32_t getPrimeBitLength()
+    uint32_t encodeSignatureCompact(
+        uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size)
     {
         uint32_t _result;
-        int code = obj_->getPrimeBitLength(
-            &_result);
+        int code = obj_->encodeSignatureCompact(
+            &_result,
+            c,
+            c_size,
+            r,
+            r_size,
+            s,
+            s_size);
         if (code != 0)
         {
             const char* message;
@@ -409,13 +2688,74 @@ class EcCipherProxy
         return _result;
     }
     
-    /** \brief Return the byte size of the curve points finite field prime.
+    /** \brief Decode the signature from the compact format.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param c the byte array storing the encoded signature
+      * \param c_size the c byte array size, the size of the encoded signature
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The compact encoding is r and s on getPrimeByteLength bytes each, 64 bytes for the 256-bit curves.
       */
-    uint32_t getPrimeByteLength()
+    void decodeSignatureCompact(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* c,
+        uint32_t c_size)
+    {
+        int code = obj_->decodeSignatureCompact(
+            r,
+            r_size,
+            s,
+            s_size,
+            c,
+            c_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Encode a batch of signatures in the DER format.
+      * \param[out] der_sizes the array of count output variables, the sizes of the encoded signatures
+      * \param[out] der the byte array to store the encoded signatures one after the other
+      * \param der_size the der byte array size
+      * \param r the byte array storing the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param s the byte array storing the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param count the number of signatures
+      * \return the total size of the encoded signatures
+      * \remark Each input array stores count consecutive numbers of the given size, with the same layout as verifySignatures.
+      *         The encoded signatures are stored one after the other, der_sizes being the layout of verifySignaturesDer.
+      */
+    uint32_t encodeSignaturesDer(
+        uint32_t* der_sizes,
+        uint8_t* der,
+        uint32_t der_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        uint32_t count)
     {
         uint32_t _result;
-        int code = obj_->getPrimeByteLength(
-            &_result);
+        int code = obj_->encodeSignaturesDer(
+            &_result,
+            der_sizes,
+            der,
+            der_size,
+            r,
+            r_size,
+            s,
+            s_size,
+            count);
         if (code != 0)
         {
             const char* message;
@@ -425,19 +2765,38 @@ class EcCipherProxy
         return _result;
     }
     
-    /** \brief Output the curve points finite field prime.
-      * \param[out] p the byte array to store the output prime
-      * \param p_size the byte array capacity
-      * \remark The output prime number is written with network byte order,
-      *         if the array size exceeds required size the number is left-padded with zeros.
+    /** \brief Decode a batch of signatures from the DER format.
+      * \param[out] results the array of count output variables, each being -1 if the encoding is valid, 0 otherwise
+      * \param[out] r the byte array to store the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param[out] s the byte array to store the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param der the byte array storing the encoded signatures one after the other
+      * \param der_sizes the array of the count encoded signature byte sizes
+      * \param count the number of signatures
+      * \remark Each output array stores count consecutive numbers of the given size, with the same layout as verifySignatures.
+      *         The malformed encodings are reported in results, they do not fail the call, and their r and s are set to 0,
+      *         so that verifySignatures rejects them.
       */
-    void getPrime(
-        uint8_t* p,
-        uint32_t p_size)
+    void decodeSignaturesDer(
+        int32_t* results,
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* der,
+        const uint32_t* der_sizes,
+        uint32_t count)
     {
-        int code = obj_->getPrime(
-            p,
-            p_size);
+        int code = obj_->decodeSignaturesDer(
+            results,
+            r,
+            r_size,
+            s,
+            s_size,
+            der,
+            der_sizes,
+            count);
         if (code != 0)
         {
             const char* message;
@@ -446,64 +2805,115 @@ class EcCipherProxy
         }
     }
     
-    /** \brief Return the bit size of the curve point coordinate finite field prime.
+    /** \brief Encode a batch of signatures in the compact format.
+      * \param[out] c the byte array to store the encoded signatures
+      * \param c_size the byte size of each encoded signature
+      * \param r the byte array storing the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param s the byte array storing the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param count the number of signatures
+      * \remark Each array stores count consecutive numbers or encodings of the given size, with the same layout as verifySignatures.
       */
-    uint32_t getCurvePointCoordinateBitLength()
+    void encodeSignaturesCompact(
+        uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        uint32_t count)
     {
-        uint32_t _result;
-        int code = obj_->getCurvePointCoordinateBitLength(
-            &_result);
+        int code = obj_->encodeSignaturesCompact(
+            c,
+            c_size,
+            r,
+            r_size,
+            s,
+            s_size,
+            count);
         if (code != 0)
         {
             const char* message;
             lcfr_EcCipher_getExceptionMessage(&message);
             throw new std::runtime_error(message);
         }
-        return _result;
     }
     
-    /** \brief Return the byte size of the curve point coordinate finite field prime.
+    /** \brief Decode a batch of signatures from the compact format.
+      * \param[out] r the byte array to store the r components of the signatures
+      * \param r_size the byte size of each r component
+      * \param[out] s the byte array to store the s components of the signatures
+      * \param s_size the byte size of each s component
+      * \param c the byte array storing the encoded signatures
+      * \param c_size the byte size of each encoded signature
+      * \param count the number of signatures
+      * \remark Each array stores count consecutive numbers or encodings of the given size, with the same layout as verifySignatures.
       */
-    uint32_t getCurvePointCoordinateByteLength()
+    void decodeSignaturesCompact(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* c,
+        uint32_t c_size,
+        uint32_t count)
     {
-        uint32_t _result;
-        int code = obj_->getCurvePointCoordinateByteLength(
-            &_result);
+        int code = obj_->decodeSignaturesCompact(
+            r,
+            r_size,
+            s,
+            s_size,
+            c,
+            c_size,
+            count);
         if (code != 0)
         {
             const char* message;
             lcfr_EcCipher_getExceptionMessage(&message);
             throw new std::runtime_error(message);
         }
-        return _result;
     }
     
-    /** \brief Output the cipher public key given the private key.
-      * \param[out] qx the byte array for the x component of the public key
-      * \param qx_size the qx byte array size
-      * \param[out] qy the byte array for the y component of the public key
-      * \param qy_size the qy byte array size
-      * \param sk the byte array storing the secret key
-      * \param sk_size the sk byte array size
-      * \remark All in/out numbers are written with network byte order.
-      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
-      *         The secret key bit size must not exceed the bit size of the curve points finite field prime.
+    /** \brief Verify a batch of DER encoded standard ECDSA signatures.
+      * \param[out] results the array of count output variables, each being -1 if the signature is valid, 0 otherwise
+      * \param der the byte array storing the encoded signatures one after the other
+      * \param der_sizes the array of the count encoded signature byte sizes
+      * \param hash the byte array storing the hashes
+      * \param h_size the byte size of each hash
+      * \param qx the byte array storing the x components of the public keys
+      * \param qx_size the byte size of each qx component
+      * \param qy the byte array storing the y components of the public keys
+      * \param qy_size the byte size of each qy component
+      * \param count the number of signatures
+      * \remark Each array but der stores count consecutive numbers of the given size, with the same layout as verifySignatures.
+      *         The encoded signatures are decoded a chunk at a time on the stack of the threads, with no allocation;
+      *         the malformed encodings are reported in results as invalid signatures.
+      *         The batch is split across the threads configured with lcfr_Runtime_configure, if any.
       */
-    void generatePublicKey(
-        uint8_t* qx,
+    void verifySignaturesDer(
+        int32_t* results,
+        const uint8_t* der,
+        const uint32_t* der_sizes,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* qx,
         uint32_t qx_size,
-        uint8_t* qy,
+        const uint8_t* qy,
         uint32_t qy_size,
-        const uint8_t* sk,
-        uint32_t sk_size)
+        uint32_t count)
     {
-        int code = obj_->generatePublicKey(
+        int code = obj_->verifySignaturesDer(
+            results,
+            der,
+            der_sizes,
+            hash,
+            h_size,
             qx,
             qx_size,
             qy,
             qy_size,
-            sk,
-            sk_size);
+            count);
         if (code != 0)
         {
             const char* message;
@@ -512,42 +2922,34 @@ class EcCipherProxy
         }
     }
     
-    /** \brief Generate the standard ECDSA signature.
-      * \param[out] r the byte array to store the r component of the signature
-      * \param r_size the r byte array size
-      * \param[out] s the byte array to store the s component of the signature
-      * \param s_size the s byte array size
+    /** \brief Generate the recoverable signature in the compressed format with an ephemeral key drawn by the library.
+      * \param[out] c the byte array to store the compressed signature
+      * \param c_size the c byte array size
       * \param hash the byte array storing the hash
       * \param h_size the hash byte array size
-      * \param ek the byte array storing the ephemeral key
-      * \param ek_size the ek byte array size
       * \param sk the byte array storing the secret key
       * \param sk_size the sk byte array size
+      * \return the size of the compressed signature
       * \remark All in/out numbers are written with network byte order.
-      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
-      *         The ephemeral key and secret key bit sizes must not exceed the bit size of the curve points finite field prime.
+      *         The secret key bit size must not exceed the bit size of the curve points finite field prime.
+      *         The ephemeral key is drawn as with generateSignatureRandom, again while the x of its point is not below the group order,
+      *         so that the recovery id is 0 or 1. The compressed signature is r and s on 2 * getPrimeByteLength bytes, the recovery id being the top bit of s.
       */
-    void generateSignature(
-        uint8_t* r,
-        uint32_t r_size,
-        uint8_t* s,
-        uint32_t s_size,
+    uint32_t generateCompressedSignature(
+        uint8_t* c,
+        uint32_t c_size,
         const uint8_t* hash,
         uint32_t h_size,
-        const uint8_t* ek,
-        uint32_t ek_size,
         const uint8_t* sk,
         uint32_t sk_size)
     {
-        int code = obj_->generateSignature(
-            r,
-            r_size,
-            s,
-            s_size,
+        uint32_t _result;
+        int code = obj_->generateCompressedSignature(
+            &_result,
+            c,
+            c_size,
             hash,
             h_size,
-            ek,
-            ek_size,
             sk,
             sk_size);
         if (code != 0)
@@ -556,43 +2958,111 @@ class EcCipherProxy
             lcfr_EcCipher_getExceptionMessage(&message);
             throw new std::runtime_error(message);
         }
+        return _result;
     }
     
-    /** \brief Verify the standard ECDSA signature.
+    /** \brief Encode the recoverable signature in the compressed format.
+      * \param[out] c the byte array to store the compressed signature
+      * \param c_size the c byte array size
       * \param r the byte array storing the r component of the signature
       * \param r_size the r byte array size
       * \param s the byte array storing the s component of the signature
       * \param s_size the s byte array size
-      * \param hash the byte array storing the hash
-      * \param h_size the hash byte array size
-      * \param qx the byte array storing the x component of the public key
-      * \param qx_size the qx byte array size
-      * \param qy the byte array storing the y component of the public key
-      * \param qy_size the qy byte array size
-      * \return -1 if the signature is valid, 0 otherwise
+      * \param v the recovery id returned with the signature
+      * \return the size of the compressed signature
       * \remark All in/out numbers are written with network byte order.
+      *         The compressed signature is r and s on 2 * getPrimeByteLength bytes, the recovery id being the top bit of s.
+      *         The recovery id is the one returned by generateRecoverableSignature; it must be 0 or 1,
+      *         which generateCompressedSignature guarantees, and s must be low.
       */
-    int32_t verifySignature(
+    uint32_t encodeCompressedSignature(
+        uint8_t* c,
+        uint32_t c_size,
         const uint8_t* r,
         uint32_t r_size,
         const uint8_t* s,
         uint32_t s_size,
-        const uint8_t* hash,
-        uint32_t h_size,
-        const uint8_t* qx,
-        uint32_t qx_size,
-        const uint8_t* qy,
-        uint32_t qy_size)
+        uint32_t v)
     {
-        int32_t _result;
-        int code = obj_->verifySignature(
+        uint32_t _result;
+        int code = obj_->encodeCompressedSignature(
             &_result,
+            c,
+            c_size,
             r,
             r_size,
             s,
             s_size,
-            hash,
-            h_size,
+            v);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Decode the recoverable signature from the compressed format.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param c the byte array storing the compressed signature
+      * \param c_size the c byte array size, the size of the compressed signature
+      * \return the recovery id of the signature
+      * \remark All in/out numbers are written with network byte order.
+      *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+      *         The compressed signature is r and s on 2 * getPrimeByteLength bytes, the recovery id being the top bit of s.
+      */
+    uint32_t decodeCompressedSignature(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* c,
+        uint32_t c_size)
+    {
+        uint32_t _result;
+        int code = obj_->decodeCompressedSignature(
+            &_result,
+            r,
+            r_size,
+            s,
+            s_size,
+            c,
+            c_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Compress the public key for the verification of the compressed signatures.
+      * \param[out] k the byte array to store the compressed key
+      * \param k_size the k byte array size, the size of the compressed key
+      * \param qx the byte array storing the x component of the public key
+      * \param qx_size the qx byte array size
+      * \param qy the byte array storing the y component of the public key
+      * \param qy_size the qy byte array size
+      * \remark All in/out numbers are written with network byte order.
+      *         The compressed key is the first k_size bytes of the SHA-256 digest of the SEC1 compressed encoding of the key,
+      *         k_size being from MIN_COMPRESSION (16) to MAX_COMPRESSION (32). It cannot be decoded: the key is recovered from the signatures.
+      */
+    void encodeCompressedKey(
+        uint8_t* k,
+        uint32_t k_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size)
+    {
+        int code = obj_->encodeCompressedKey(
+            k,
+            k_size,
             qx,
             qx_size,
             qy,
@@ -603,8 +3073,85 @@ class EcCipherProxy
             lcfr_EcCipher_getExceptionMessage(&message);
             throw new std::runtime_error(message);
         }
+    }
+    
+    /** \brief Verify the compressed signature with the compressed key.
+      * \param c the byte array storing the compressed signature
+      * \param c_size the c byte array size, the size of the compressed signature
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \param k the byte array storing the compressed key
+      * \param k_size the k byte array size, the size of the compressed key
+      * \return -1 if the signature is valid, 0 otherwise
+      * \remark All in/out numbers are written with network byte order.
+      *         The key is recovered from the signature, the hash and the recovery id, then compressed and compared with k.
+      *         A forger must find a signature recovering a key with the same compressed key, about 2^(8 * k_size) recoveries,
+      *         so k_size must be from MIN_COMPRESSION (16) to MAX_COMPRESSION (32).
+      */
+    int32_t verifyCompressedSignature(
+        const uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* k,
+        uint32_t k_size)
+    {
+        int32_t _result;
+        int code = obj_->verifyCompressedSignature(
+            &_result,
+            c,
+            c_size,
+            hash,
+            h_size,
+            k,
+            k_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
         return _result;
     }
+    
+    /** \brief Verify a batch of compressed signatures with their compressed keys.
+      * \param[out] results the array of count output variables, each being -1 if the signature is valid, 0 otherwise
+      * \param c the byte array storing the compressed signatures
+      * \param c_size the byte size of each compressed signature
+      * \param hash the byte array storing the hashes
+      * \param h_size the byte size of each hash
+      * \param k the byte array storing the compressed keys
+      * \param k_size the byte size of each compressed key
+      * \param count the number of signatures
+      * \remark Each array stores count consecutive values of the given size, with the same layout as verifyCompressedSignature.
+      *         The batch is split across the threads configured with lcfr_Runtime_configure, if any.
+      */
+    void verifyCompressedSignatures(
+        int32_t* results,
+        const uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* k,
+        uint32_t k_size,
+        uint32_t count)
+    {
+        int code = obj_->verifyCompressedSignatures(
+            results,
+            c,
+            c_size,
+            hash,
+            h_size,
+            k,
+            k_size,
+            count);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipher_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
         
     ~EcCipherProxy()
     {
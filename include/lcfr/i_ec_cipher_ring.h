@@ -0,0 +1,376 @@
+/** \file i_ec_cipher_ring.h
+  * The file includes the lcfr library asynchronous cipher ring C/C++ interface.
+  */
+#pragma once
+
+#include <stdint.h>
+#include "lcfr/i_ec_cipher.h"
+
+#ifdef LCFR_API
+#undef LCFR_API
+#endif
+
+#ifdef __BUILD_LCFR_LIBRARY__
+#ifdef _WIN32
+#define LCFR_API __declspec(dllexport)
+#else
+#define LCFR_API
+#endif
+#else
+#ifdef _WIN32
+#define LCFR_API __declspec(dllimport)
+#else
+#define LCFR_API
+#endif
+#endif
+
+/** Opcode of a signature generation request. */
+#define LCFR_EC_CIPHER_RING_SIGN   1
+/** Opcode of a signature verification request. */
+#define LCFR_EC_CIPHER_RING_VERIFY 2
+
+/**
+  * \struct lcfr_EcCipherRing_vtable_ptr_
+  *
+  * This struct is the C representation of an interface to an asynchronous queue of requests
+  * for generation and verification of digital signatures, executed by library threads.
+  */
+typedef struct lcfr_EcCipherRing_vtable_ptr_
+{
+    void* vtable_;
+} lcfr_EcCipherRing_vtable_ptr;
+
+/**
+  * \struct lcfr_EcCipherRing_request_
+  *
+  * This struct describes a request submitted to a cipher ring.
+  * The arrays are not copied: they are owned by the caller and must stay valid until the request completes.
+  * The arguments have the meaning of the ones of lcfr_EcCipher_generateSignature and lcfr_EcCipher_verifySignature:
+  * - LCFR_EC_CIPHER_RING_SIGN - r and s are written, k1 is the ephemeral key and k2 the secret key
+  * - LCFR_EC_CIPHER_RING_VERIFY - r and s are read, k1 is the x and k2 the y component of the public key
+  */
+typedef struct lcfr_EcCipherRing_request_
+{
+    uint64_t       user_data;
+    uint32_t       opcode;
+    uint32_t       r_size;
+    uint32_t       s_size;
+    uint32_t       h_size;
+    uint32_t       k1_size;
+    uint32_t       k2_size;
+    uint8_t*       r;
+    uint8_t*       s;
+    const uint8_t* hash;
+    const uint8_t* k1;
+    const uint8_t* k2;
+} lcfr_EcCipherRing_request;
+
+/**
+  * \struct lcfr_EcCipherRing_completion_
+  *
+  * This struct describes a completed request.
+  * The result is the one of lcfr_EcCipher_verifySignature for verification requests, 0 otherwise;
+  * the status is 0 if the request was executed, a positive number otherwise.
+  */
+typedef struct lcfr_EcCipherRing_completion_
+{
+    uint64_t user_data;
+    int32_t  result;
+    uint32_t status;
+} lcfr_EcCipherRing_completion;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \brief Output the message of the last error occurred using the lcfr api, in the calling thread.
+  * \param[out] _result the address of the pointer to the output string
+  * \return 0 if successful, a positive number otherwise
+  */
+LCFR_API uint32_t lcfr_EcCipherRing_getExceptionMessage(char const ** _result);
+
+/** \brief Destroy the ring whose interface is passed to the function.
+  * \param this_ptr the address of the ring interface
+  * \return 0 if successful, a positive number otherwise
+  * \remark The requests not yet started are discarded.
+  */
+LCFR_API uint32_t lcfr_EcCipherRing_release(lcfr_EcCipherRing_vtable_ptr* this_ptr);
+
+/** \brief Create a ring executing requests on a cipher.
+  * \param[out] _result the address of the pointer to the ring interface
+  * \param cipher the address of the cipher interface, which must outlive the ring
+  * \param entries the maximum number of requests submitted and not yet polled
+  * \return 0 if successful, a positive number otherwise
+  * \remark A library thread takes every pending request at once and groups them by opcode and array sizes.
+  *         Each group runs as one batch, as lcfr_EcCipher_generateSignatures or lcfr_EcCipher_verifySignatures
+  *         would, on the arrays of the requests themselves and on the threads configured with lcfr_Runtime_configure,
+  *         if any. A group failing as a whole,
+  *         for example on a malformed request, runs again request by request to report the failed ones.
+  */
+LCFR_API uint32_t lcfr_EcCipherRing_create(
+    lcfr_EcCipherRing_vtable_ptr** _result,
+    lcfr_EcCipher_vtable_ptr* cipher,
+    uint32_t entries);
+
+/** \brief Submit requests to the ring.
+  * \param this_ptr the address of the ring interface
+  * \param[out] _result the address of the output variable, the number of accepted requests
+  * \param requests the array of requests
+  * \param count the number of requests
+  * \return 0 if successful, a positive number otherwise
+  * \remark Requests are accepted in order while the ring has free entries; the call never blocks.
+  */
+LCFR_API uint32_t lcfr_EcCipherRing_submit(
+    lcfr_EcCipherRing_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    const lcfr_EcCipherRing_request* requests,
+    uint32_t count);
+
+/** \brief Output the completed requests without blocking.
+  * \param this_ptr the address of the ring interface
+  * \param[out] _result the address of the output variable, the number of output completions
+  * \param[out] completions the array to store the completions
+  * \param capacity the completions array size
+  * \return 0 if successful, a positive number otherwise
+  */
+LCFR_API uint32_t lcfr_EcCipherRing_poll(
+    lcfr_EcCipherRing_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    lcfr_EcCipherRing_completion* completions,
+    uint32_t capacity);
+
+/** \brief Output the completed requests, waiting for a minimum number of them.
+  * \param this_ptr the address of the ring interface
+  * \param[out] _result the address of the output variable, the number of output completions
+  * \param[out] completions the array to store the completions
+  * \param capacity the completions array size
+  * \param min_complete the number of completions to wait for, bounded by capacity and by the requests in flight
+  * \return 0 if successful, a positive number otherwise
+  */
+LCFR_API uint32_t lcfr_EcCipherRing_wait(
+    lcfr_EcCipherRing_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    lcfr_EcCipherRing_completion* completions,
+    uint32_t capacity,
+    uint32_t min_complete);
+
+/** \brief Output the eventfd descriptor signalled when requests complete.
+  * \param this_ptr the address of the ring interface
+  * \param[out] _result the address of the output variable, -1 if the platform does not support eventfd
+  * \return 0 if successful, a positive number otherwise
+  * \remark The descriptor is non blocking and owned by the ring; its counter is increased
+  *         by the number of requests completed, the caller reads it to reset it.
+  */
+LCFR_API uint32_t lcfr_EcCipherRing_getEventFd(
+    lcfr_EcCipherRing_vtable_ptr* this_ptr,
+    int32_t* _result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef _WIN32
+#define STDCALL __stdcall
+#else
+#define STDCALL
+#endif
+
+#ifdef __cplusplus
+#include <string>
+#include <stdexcept>
+
+namespace lcfr {
+
+/**
+  * \struct IEcCipherRing
+  *
+  * This struct is the C++ interface to an asynchronous queue of requests
+  * for generation and verification of digital signatures, executed by library threads.
+  */
+struct IEcCipherRing
+{
+    /** \brief Destroy the ring object.
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL release() = 0;
+    
+    /** \brief Initialize the ring.
+      * \param cipher the address of the cipher interface, which must outlive the ring
+      * \param entries the maximum number of requests submitted and not yet polled
+      */
+    virtual uint32_t STDCALL init(
+        IEcCipher* cipher,
+        uint32_t entries) = 0;
+    
+    /** \brief Submit requests to the ring.
+      * \param[out] _result the address of the output variable, the number of accepted requests
+      * \param requests the array of requests
+      * \param count the number of requests
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL submit(
+        uint32_t* _result,
+        const lcfr_EcCipherRing_request* requests,
+        uint32_t count) = 0;
+    
+    /** \brief Output the completed requests without blocking.
+      * \param[out] _result the address of the output variable, the number of output completions
+      * \param[out] completions the array to store the completions
+      * \param capacity the completions array size
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL poll(
+        uint32_t* _result,
+        lcfr_EcCipherRing_completion* completions,
+        uint32_t capacity) = 0;
+    
+    /** \brief Output the completed requests, waiting for a minimum number of them.
+      * \param[out] _result the address of the output variable, the number of output completions
+      * \param[out] completions the array to store the completions
+      * \param capacity the completions array size
+      * \param min_complete the number of completions to wait for
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL wait(
+        uint32_t* _result,
+        lcfr_EcCipherRing_completion* completions,
+        uint32_t capacity,
+        uint32_t min_complete) = 0;
+    
+    /** \brief Output the eventfd descriptor signalled when requests complete.
+      * \param[out] _result the address of the output variable, -1 if the platform does not support eventfd
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL getEventFd(
+        int32_t* _result) = 0;
+};
+
+/**
+  * \class EcCipherRingProxy
+  *
+  * This class implements an asynchronous queue of requests
+  * for generation and verification of digital signatures, executed by library threads.
+  */
+class EcCipherRingProxy
+{
+    lcfr::IEcCipherRing* obj_;
+    
+    public:
+    
+    /** \brief Create an EcCipherRingProxy.
+      * \param cipher the address of the cipher interface, which must outlive the ring
+      * \param entries the maximum number of requests submitted and not yet polled
+      * \remark The pending requests are grouped by opcode and array sizes, each group running as one batch.
+      */
+    EcCipherRingProxy(
+        lcfr_EcCipher_vtable_ptr* cipher,
+        uint32_t entries)
+    {
+        int code = lcfr_EcCipherRing_create(
+            (lcfr_EcCipherRing_vtable_ptr**)&obj_,
+            cipher,
+            entries);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipherRing_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Submit requests to the ring, returning the number of accepted requests.
+      * \param requests the array of requests
+      * \param count the number of requests
+      */
+    uint32_t submit(
+        const lcfr_EcCipherRing_request* requests,
+        uint32_t count)
+    {
+        uint32_t _result;
+        int code = obj_->submit(
+            &_result,
+            requests,
+            count);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipherRing_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Output the completed requests without blocking, returning their number.
+      * \param[out] completions the array to store the completions
+      * \param capacity the completions array size
+      */
+    uint32_t poll(
+        lcfr_EcCipherRing_completion* completions,
+        uint32_t capacity)
+    {
+        uint32_t _result;
+        int code = obj_->poll(
+            &_result,
+            completions,
+            capacity);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipherRing_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Output the completed requests waiting for a minimum number of them, returning their number.
+      * \param[out] completions the array to store the completions
+      * \param capacity the completions array size
+      * \param min_complete the number of completions to wait for
+      */
+    uint32_t wait(
+        lcfr_EcCipherRing_completion* completions,
+        uint32_t capacity,
+        uint32_t min_complete)
+    {
+        uint32_t _result;
+        int code = obj_->wait(
+            &_result,
+            completions,
+            capacity,
+            min_complete);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipherRing_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Return the eventfd descriptor signalled when requests complete, -1 if not supported.
+      */
+    int32_t getEventFd()
+    {
+        int32_t _result;
+        int code = obj_->getEventFd(
+            &_result);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcCipherRing_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    ~EcCipherRingProxy()
+    {
+        obj_->release();
+    }
+};
+
+#ifndef __BUILD_LCFR_LIBRARY__
+typedef EcCipherRingProxy EcCipherRing;
+#endif
+}
+#endif
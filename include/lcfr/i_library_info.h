@@ -63,6 +63,16 @@ LCFR_API uint32_t lcfr_LibraryInfo_getVersion(
     lcfr_LibraryInfo_vtable_ptr* this_ptr,
     char const ** _result);
 
+/** \brief Output the names of the arithmetic kernels selected for the running cpu.
+  * The string lists the multiprecision kernels (mult), the multi-lane field kernels (lanes)
+  * and the SHA-256 kernels (sha256), for instance "mult=bmi2-adx lanes=avx512f sha256=sha-ni".
+  * \param[out] _result the address of the pointer to the output string
+  * \return 0 if successful, a positive number otherwise
+  */
+LCFR_API uint32_t lcfr_LibraryInfo_getActiveKernels(
+    lcfr_LibraryInfo_vtable_ptr* this_ptr,
+    char const ** _result);
+
 #ifdef __cplusplus
 }
 #endif
@@ -74,6 +84,7 @@ LCFR_API uint32_t lcfr_LibraryInfo_getVersion(
 #endif
 
 #ifdef __cplusplus
+#include <stdexcept>
 #include <string>
 
 namespace lcfr {
@@ -96,6 +107,13 @@ struct ILibraryInfo
     virtual uint32_t STDCALL getVersion(
         char const ** _result) = 0;
     
+    /** \brief Output the names of the arithmetic kernels selected for the running cpu.
+      * \param[out] _result the address of the pointer to the output string
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL getActiveKernels(
+        char const ** _result) = 0;
+    
 };
 
 /**
@@ -139,6 +157,22 @@ class LibraryInfoProxy
         return std::string(_result);
     }
     
+    /** \brief Return the names of the arithmetic kernels selected for the running cpu.
+      */
+    std::string getActiveKernels()
+    {
+        const char* _result;
+        int code = obj_->getActiveKernels(
+            &_result);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_LibraryInfo_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return std::string(_result);
+    }
+    
     ~LibraryInfoProxy()
     {
         obj_->release();
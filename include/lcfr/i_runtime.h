@@ -0,0 +1,215 @@
+/** \file i_runtime.h
+  * The file includes the lcfr library runtime configuration C/C++ interface.
+  */
+#pragma once
+
+#include <stdint.h>
+
+#ifdef LCFR_API
+#undef LCFR_API
+#endif
+
+#ifdef __BUILD_LCFR_LIBRARY__
+#ifdef _WIN32
+#define LCFR_API __declspec(dllexport)
+#else
+#define LCFR_API
+#endif
+#else
+#ifdef _WIN32
+#define LCFR_API __declspec(dllimport)
+#else
+#define LCFR_API
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \brief Output the message of the last error occurred using the lcfr runtime api, in the calling thread.
+  * \param[out] _result the address of the pointer to the output string
+  * \return 0 if successful, a positive number otherwise
+  */
+LCFR_API uint32_t lcfr_Runtime_getExceptionMessage(char const ** _result);
+
+/** \brief Configure the threads processing the batch operations of the library.
+  * \param threadCount the number of threads processing a batch, the calling thread included
+  * \param pinning if not 0 each worker thread is bound to a distinct cpu
+  * \return 0 if successful, a positive number otherwise
+  * \remark By default batches are processed serially by the calling thread;
+  *         a thread count lower than 2 restores the default.
+  *         Batches in progress complete on the threads they were started with.
+  */
+LCFR_API uint32_t lcfr_Runtime_configure(
+    uint32_t threadCount,
+    uint32_t pinning);
+
+/** \brief Configure the helper threads speeding up single signature verifications.
+  * \param helperCount the number of helper threads, 0 disables the parallel verification
+  * \param pinning if not 0 each helper thread is bound to a distinct cpu
+  * \return 0 if successful, a positive number otherwise
+  * \remark A verification computes two independent scalar multiplications: when a helper is idle
+  *         one of them is handed over to it, roughly halving the latency of the call.
+  *         A helper serves one verification at a time, so helperCount bounds the number of calls
+  *         accelerated concurrently; the others run serially.
+  *         The helper count is bounded by the number of cpus minus one.
+  *         Helpers busy-wait for new work for a while after each job, trading cpu time for latency.
+  */
+LCFR_API uint32_t lcfr_Runtime_configureParallelVerify(
+    uint32_t helperCount,
+    uint32_t pinning);
+
+/** \brief Tune the parameters of every curve for the running cpu, or load the tuning saved by a previous run.
+  * \param configPath the tuning file, null or empty to tune without saving
+  * \param[out] _result 1 if the tuning ran, 0 if it was loaded from the file
+  * \return 0 if successful, a positive number otherwise
+  * \remark The tuning benchmarks the window width of the scalar multiplications and the number of signatures
+  *         from which the batches use the vector lanes, a few scalar multiplications per candidate and curve.
+  *         The file is loaded only if it was written with the same kernels (see lcfr_LibraryInfo_getActiveKernels),
+  *         else the tuning runs and overwrites it. Without a tuning the library uses static defaults.
+  *         The call may run while signatures are computed, which then use the old or the new parameters.
+  */
+LCFR_API uint32_t lcfr_Runtime_autotune(
+    const char* configPath,
+    uint32_t* _result);
+
+/** \brief Output the tuned parameters of a curve.
+  * \param curve the curve name
+  * \param[out] window the window width of the scalar multiplications, 1 for the binary method
+  * \param[out] minLanes the number of signatures from which batches use the vector lanes, 9 for never
+  * \return 0 if successful, a positive number otherwise
+  */
+LCFR_API uint32_t lcfr_Runtime_getTuning(
+    const char* curve,
+    uint32_t* window,
+    uint32_t* minLanes);
+
+/** \brief Run the known-answer tests of the library.
+  * \return 0 if successful, a positive number otherwise
+  * \remark The tests check SHA-256, then on P-256 the public key, the RFC 6979 nonces and signatures of RFC 6979 A.2.5,
+  *         their verification, DER encoding and decoding, the public key recovery and the SEC1 encoding of the key.
+  *         The library signs with the low s, so n - s is expected where the RFC gives a high s.
+  *         On failure the exception message names the first failed check.
+  */
+LCFR_API uint32_t lcfr_Runtime_selfTest();
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef __cplusplus
+#include <string>
+#include <stdexcept>
+
+namespace lcfr {
+
+/**
+  * \class RuntimeProxy
+  *
+  * This class configures the lcfr library runtime.
+  */
+class RuntimeProxy
+{
+    public:
+    
+    /** \brief Configure the threads processing the batch operations of the library.
+      * \param threadCount the number of threads processing a batch, the calling thread included
+      * \param pinning if true each worker thread is bound to a distinct cpu
+      */
+    static void configure(
+        uint32_t threadCount,
+        bool pinning)
+    {
+        int code = lcfr_Runtime_configure(
+            threadCount,
+            pinning ? 1 : 0);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_Runtime_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Configure the helper threads speeding up single signature verifications.
+      * \param helperCount the number of helper threads, 0 disables the parallel verification
+      * \param pinning if true each helper thread is bound to a distinct cpu
+      */
+    static void configureParallelVerify(
+        uint32_t helperCount,
+        bool pinning)
+    {
+        int code = lcfr_Runtime_configureParallelVerify(
+            helperCount,
+            pinning ? 1 : 0);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_Runtime_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Tune the parameters of every curve for the running cpu, or load the tuning saved by a previous run.
+      * \param configPath the tuning file, null or empty to tune without saving
+      * \return true if the tuning ran, false if it was loaded from the file
+      */
+    static bool autotune(
+        const char* configPath)
+    {
+        uint32_t _result;
+        int code = lcfr_Runtime_autotune(
+            configPath,
+            &_result);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_Runtime_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result != 0;
+    }
+    
+    /** \brief Output the tuned parameters of a curve.
+      * \param curve the curve name
+      * \param window the window width of the scalar multiplications
+      * \param minLanes the number of signatures from which batches use the vector lanes
+      */
+    static void getTuning(
+        const char* curve,
+        uint32_t& window,
+        uint32_t& minLanes)
+    {
+        int code = lcfr_Runtime_getTuning(
+            curve,
+            &window,
+            &minLanes);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_Runtime_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Run the known-answer tests of the library.
+      * \remark On failure the exception message names the first failed check.
+      */
+    static void selfTest()
+    {
+        int code = lcfr_Runtime_selfTest();
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_Runtime_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+};
+
+#ifndef __BUILD_LCFR_LIBRARY__
+typedef RuntimeProxy Runtime;
+#endif
+}
+#endif
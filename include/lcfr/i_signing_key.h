@@ -0,0 +1,423 @@
+/** \file i_signing_key.h
+  * The file includes the lcfr library deterministic signing key C/C++ interface.
+  */
+#pragma once
+
+#include <stdint.h>
+#include "lcfr/i_ec_cipher.h"
+
+#ifdef LCFR_API
+#undef LCFR_API
+#endif
+
+#ifdef __BUILD_LCFR_LIBRARY__
+#ifdef _WIN32
+#define LCFR_API __declspec(dllexport)
+#else
+#define LCFR_API
+#endif
+#else
+#ifdef _WIN32
+#define LCFR_API __declspec(dllimport)
+#else
+#define LCFR_API
+#endif
+#endif
+
+/**
+  * \struct lcfr_EcSigningKey_vtable_ptr_
+  *
+  * This struct is the C representation of an interface to a secret key bound to a cipher,
+  * generating ECDSA signatures with the deterministic ephemeral keys of RFC 6979 (HMAC-SHA-256).
+  */
+typedef struct lcfr_EcSigningKey_vtable_ptr_
+{
+    void* vtable_;
+} lcfr_EcSigningKey_vtable_ptr;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \brief Output the message of the last error occurred using the lcfr api, in the calling thread.
+  * \param[out] _result the address of the pointer to the output string
+  * \return 0 if successful, a positive number otherwise
+  */
+LCFR_API uint32_t lcfr_EcSigningKey_getExceptionMessage(char const ** _result);
+
+/** \brief Destroy the signing key whose interface is passed to the function.
+  * \param this_ptr the address of the signing key interface
+  * \return 0 if successful, a positive number otherwise
+  * \remark The copy of the secret key held by the object is overwritten.
+  */
+LCFR_API uint32_t lcfr_EcSigningKey_release(lcfr_EcSigningKey_vtable_ptr* this_ptr);
+
+/** \brief Create a signing key.
+  * \param[out] _result the address of the pointer to the signing key interface
+  * \param cipher the address of the cipher interface
+  * \param sk the byte array storing the secret key
+  * \param sk_size the sk byte array size
+  * \return 0 if successful, a positive number otherwise
+  * \remark The secret key is written with network byte order and must be between 1 and the group order - 1.
+  *         The cipher is only used while the function runs.
+  */
+LCFR_API uint32_t lcfr_EcSigningKey_create(
+    lcfr_EcSigningKey_vtable_ptr** _result,
+    lcfr_EcCipher_vtable_ptr* cipher,
+    const uint8_t* sk,
+    uint32_t sk_size);
+
+/** \brief Generate the RFC 6979 ephemeral key of a hash.
+  * \param this_ptr the address of the signing key interface
+  * \param[out] k the byte array to store the ephemeral key
+  * \param k_size the k byte array size
+  * \param hash the byte array storing the hash
+  * \param h_size the hash byte array size
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         If the k array size exceeds the byte size of the group order the key is left-padded with zeros.
+  */
+LCFR_API uint32_t lcfr_EcSigningKey_generateNonce(
+    lcfr_EcSigningKey_vtable_ptr* this_ptr,
+    uint8_t* k,
+    uint32_t k_size,
+    const uint8_t* hash,
+    uint32_t h_size);
+
+/** \brief Generate the standard ECDSA signature with the RFC 6979 ephemeral key.
+  * \param this_ptr the address of the signing key interface
+  * \param[out] r the byte array to store the r component of the signature
+  * \param r_size the r byte array size
+  * \param[out] s the byte array to store the s component of the signature
+  * \param s_size the s byte array size
+  * \param hash the byte array storing the hash
+  * \param h_size the hash byte array size
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+  */
+LCFR_API uint32_t lcfr_EcSigningKey_generateSignature(
+    lcfr_EcSigningKey_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size);
+
+/** \brief Hash the message with SHA-256 and generate the standard ECDSA signature of the digest with the RFC 6979 ephemeral key.
+  * \param this_ptr the address of the signing key interface
+  * \param[out] r the byte array to store the r component of the signature
+  * \param r_size the r byte array size
+  * \param[out] s the byte array to store the s component of the signature
+  * \param s_size the s byte array size
+  * \param m the byte array storing the message
+  * \param m_size the m byte array size
+  * \return 0 if successful, a positive number otherwise
+  * \remark All in/out numbers are written with network byte order.
+  *         For each output number if the relative array size exceeds required size the number is left-padded with zeros.
+  */
+LCFR_API uint32_t lcfr_EcSigningKey_signMessage(
+    lcfr_EcSigningKey_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* m,
+    uint32_t m_size);
+
+/** \brief Generate count standard ECDSA signatures with the RFC 6979 ephemeral keys, on the library threads.
+  * \param this_ptr the address of the signing key interface
+  * \param[out] r the byte array to store the r components, r_size bytes each
+  * \param r_size the byte size of each r component
+  * \param[out] s the byte array to store the s components, s_size bytes each
+  * \param s_size the byte size of each s component
+  * \param hash the byte array storing the hashes, h_size bytes each
+  * \param h_size the byte size of each hash
+  * \param count the number of signatures
+  * \return 0 if successful, a positive number otherwise
+  * \remark Each signature is the one generated by lcfr_EcSigningKey_generateSignature.
+  */
+LCFR_API uint32_t lcfr_EcSigningKey_generateSignatures(
+    lcfr_EcSigningKey_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef _WIN32
+#define STDCALL __stdcall
+#else
+#define STDCALL
+#endif
+
+#ifdef __cplusplus
+#include <string>
+#include <stdexcept>
+
+namespace lcfr {
+
+/**
+  * \struct IEcSigningKey
+  *
+  * This struct is the C++ interface to a secret key bound to a cipher,
+  * generating ECDSA signatures with the deterministic ephemeral keys of RFC 6979 (HMAC-SHA-256).
+  */
+struct IEcSigningKey
+{
+    /** \brief Destroy the signing key object.
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL release() = 0;
+
+    /** \brief Initialize the signing key.
+      * \param cipher the address of the cipher interface
+      * \param sk the byte array storing the secret key
+      * \param sk_size the sk byte array size
+      */
+    virtual uint32_t STDCALL init(
+        IEcCipher* cipher,
+        const uint8_t* sk,
+        uint32_t sk_size) = 0;
+
+    /** \brief Generate the RFC 6979 ephemeral key of a hash.
+      * \param[out] k the byte array to store the ephemeral key
+      * \param k_size the k byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL generateNonce(
+        uint8_t* k,
+        uint32_t k_size,
+        const uint8_t* hash,
+        uint32_t h_size) = 0;
+
+    /** \brief Generate the standard ECDSA signature with the RFC 6979 ephemeral key.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL generateSignature(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size) = 0;
+
+    /** \brief Hash the message with SHA-256 and generate the standard ECDSA signature of the digest with the RFC 6979 ephemeral key.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param m the byte array storing the message
+      * \param m_size the m byte array size
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL signMessage(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        uint32_t m_size) = 0;
+
+    /** \brief Generate count standard ECDSA signatures with the RFC 6979 ephemeral keys, on the library threads.
+      * \param[out] r the byte array to store the r components, r_size bytes each
+      * \param r_size the byte size of each r component
+      * \param[out] s the byte array to store the s components, s_size bytes each
+      * \param s_size the byte size of each s component
+      * \param hash the byte array storing the hashes, h_size bytes each
+      * \param h_size the byte size of each hash
+      * \param count the number of signatures
+      * \return 0 if successful, a positive number otherwise
+      */
+    virtual uint32_t STDCALL generateSignatures(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        uint32_t count) = 0;
+};
+
+/**
+  * \class EcSigningKeyProxy
+  *
+  * This class implements a secret key bound to a cipher,
+  * generating ECDSA signatures with the deterministic ephemeral keys of RFC 6979 (HMAC-SHA-256).
+  */
+class EcSigningKeyProxy
+{
+    lcfr::IEcSigningKey* obj_;
+
+    public:
+
+    /** \brief Create an EcSigningKeyProxy.
+      * \param cipher the address of the cipher interface
+      * \param sk the byte array storing the secret key
+      * \param sk_size the sk byte array size
+      */
+    EcSigningKeyProxy(
+        lcfr_EcCipher_vtable_ptr* cipher,
+        const uint8_t* sk,
+        uint32_t sk_size)
+    {
+        int code = lcfr_EcSigningKey_create(
+            (lcfr_EcSigningKey_vtable_ptr**)&obj_,
+            cipher,
+            sk,
+            sk_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcSigningKey_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+
+    /** \brief Generate the RFC 6979 ephemeral key of a hash.
+      * \param[out] k the byte array to store the ephemeral key
+      * \param k_size the k byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      */
+    void generateNonce(
+        uint8_t* k,
+        uint32_t k_size,
+        const uint8_t* hash,
+        uint32_t h_size)
+    {
+        int code = obj_->generateNonce(
+            k,
+            k_size,
+            hash,
+            h_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcSigningKey_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+
+    /** \brief Generate the standard ECDSA signature with the RFC 6979 ephemeral key.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param hash the byte array storing the hash
+      * \param h_size the hash byte array size
+      */
+    void generateSignature(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size)
+    {
+        int code = obj_->generateSignature(
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcSigningKey_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+
+    /** \brief Hash the message with SHA-256 and generate the standard ECDSA signature of the digest with the RFC 6979 ephemeral key.
+      * \param[out] r the byte array to store the r component of the signature
+      * \param r_size the r byte array size
+      * \param[out] s the byte array to store the s component of the signature
+      * \param s_size the s byte array size
+      * \param m the byte array storing the message
+      * \param m_size the m byte array size
+      */
+    void signMessage(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        uint32_t m_size)
+    {
+        int code = obj_->signMessage(
+            r,
+            r_size,
+            s,
+            s_size,
+            m,
+            m_size);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcSigningKey_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+
+    /** \brief Generate count standard ECDSA signatures with the RFC 6979 ephemeral keys, on the library threads.
+      * \param[out] r the byte array to store the r components, r_size bytes each
+      * \param r_size the byte size of each r component
+      * \param[out] s the byte array to store the s components, s_size bytes each
+      * \param s_size the byte size of each s component
+      * \param hash the byte array storing the hashes, h_size bytes each
+      * \param h_size the byte size of each hash
+      * \param count the number of signatures
+      */
+    void generateSignatures(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        uint32_t count)
+    {
+        int code = obj_->generateSignatures(
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            count);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_EcSigningKey_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+
+    ~EcSigningKeyProxy()
+    {
+        obj_->release();
+    }
+};
+
+#ifndef __BUILD_LCFR_LIBRARY__
+typedef EcSigningKeyProxy EcSigningKey;
+#endif
+}
+#endif
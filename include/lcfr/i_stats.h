@@ -0,0 +1,285 @@
+/** \file i_stats.h
+  * The file includes the lcfr library operation counters and latency histograms C/C++ interface.
+  */
+#pragma once
+
+#include <stdint.h>
+
+#ifdef LCFR_API
+#undef LCFR_API
+#endif
+
+#ifdef __BUILD_LCFR_LIBRARY__
+#ifdef _WIN32
+#define LCFR_API __declspec(dllexport)
+#else
+#define LCFR_API
+#endif
+#else
+#ifdef _WIN32
+#define LCFR_API __declspec(dllimport)
+#else
+#define LCFR_API
+#endif
+#endif
+
+/** Indexes of the counters of a curve in a snapshot.
+  * Field operations are counted in both the coordinate and the scalar field,
+  * reductions being the modular reductions of the products.
+  */
+#define LCFR_STATS_FP_MULT          0
+#define LCFR_STATS_FP_SQUARE        1
+#define LCFR_STATS_FP_INVERSE       2
+#define LCFR_STATS_REDUCTION        3
+#define LCFR_STATS_POINT_ADD        4
+#define LCFR_STATS_POINT_DOUBLE     5
+#define LCFR_STATS_SIGN             6
+#define LCFR_STATS_VERIFY           7
+#define LCFR_STATS_COUNTER_COUNT    8
+
+/** Number of curves in a snapshot, in the order of their names from secp112r1 to secp256r1.
+  */
+#define LCFR_STATS_CURVE_COUNT      10
+
+/** Operations and stages of the latency histograms.
+  * CALL is the whole library call; HASH is the conversion of the hash to an integer,
+  * INVERSE the inversion of s in a verification, SCALAR_MULT the scalar multiplications,
+  * NORMALIZE the conversion of the resulting point to affine coordinates
+  * and FINAL the remaining modular arithmetic, the inversion of the nonce of a signature included.
+  */
+#define LCFR_STATS_OPERATION_SIGN   0
+#define LCFR_STATS_OPERATION_VERIFY 1
+#define LCFR_STATS_OPERATION_COUNT  2
+
+#define LCFR_STATS_STAGE_CALL        0
+#define LCFR_STATS_STAGE_HASH        1
+#define LCFR_STATS_STAGE_INVERSE     2
+#define LCFR_STATS_STAGE_SCALAR_MULT 3
+#define LCFR_STATS_STAGE_NORMALIZE   4
+#define LCFR_STATS_STAGE_FINAL       5
+#define LCFR_STATS_STAGE_COUNT       6
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \brief Output the message of the last error occurred using the lcfr stats api, in the calling thread.
+  * \param[out] _result the address of the pointer to the output string
+  * \return 0 if successful, a positive number otherwise
+  */
+LCFR_API uint32_t lcfr_Stats_getExceptionMessage(char const ** _result);
+
+/** \brief Tell whether the operations are counted.
+  * \param[out] _result 1 if the library was built with the LCFR_STATS option, 0 otherwise
+  * \return 0 if successful, a positive number otherwise
+  * \remark Without the option the counters cost nothing and stay at zero.
+  */
+LCFR_API uint32_t lcfr_Stats_isEnabled(
+    uint32_t* _result);
+
+/** \brief Copy the operation counters summed over all the threads since the last reset.
+  * \param[out] counters the counters, the value of counter k of curve c at index c * LCFR_STATS_COUNTER_COUNT + k
+  * \param counters_size the capacity of counters, in values
+  * \param[out] _result the number of values of a full snapshot, LCFR_STATS_CURVE_COUNT * LCFR_STATS_COUNTER_COUNT
+  * \return 0 if successful, a positive number otherwise
+  * \remark The counters of the threads that exited are included.
+  *         Each thread counts on its own cache lines, a snapshot reads them without stopping the threads,
+  *         so the counts of the operations in progress may be partially included.
+  */
+LCFR_API uint32_t lcfr_Stats_snapshot(
+    uint64_t* counters,
+    uint32_t counters_size,
+    uint32_t* _result);
+
+/** \brief Restart the operation counters and the latency histograms from zero.
+  * \return 0 if successful, a positive number otherwise
+  */
+LCFR_API uint32_t lcfr_Stats_reset();
+
+/** \brief Start or stop recording the latency histograms of the sign and verify stages.
+  * \param enabled if not 0 the durations are recorded, else the recording stops
+  * \return 0 if successful, a positive number otherwise
+  * \remark The recording is available in every build and disabled by default.
+  *         The durations are read from the time stamp counter and counted in log-linear histograms
+  *         of about 6% resolution, one per curve, operation and stage.
+  */
+LCFR_API uint32_t lcfr_Stats_enableLatency(
+    uint32_t enabled);
+
+/** \brief Compute the latencies of a stage at the given quantiles.
+  * \param curve the index of the curve, lower than LCFR_STATS_CURVE_COUNT
+  * \param operation LCFR_STATS_OPERATION_SIGN or LCFR_STATS_OPERATION_VERIFY
+  * \param stage one of the LCFR_STATS_STAGE_ values
+  * \param quantiles the quantiles, from 0 to 1 (e.g. 0.5, 0.99, 0.999)
+  * \param[out] values the latencies at the quantiles, in nanoseconds
+  * \param count the number of quantiles
+  * \param[out] _result the number of durations recorded
+  * \return 0 if successful, a positive number otherwise
+  * \remark The first call after the recording started may wait up to 10 ms,
+  *         the time needed to calibrate the time stamp counter.
+  */
+LCFR_API uint32_t lcfr_Stats_getLatency(
+    uint32_t curve,
+    uint32_t operation,
+    uint32_t stage,
+    const double* quantiles,
+    double* values,
+    uint32_t count,
+    uint64_t* _result);
+
+/** \brief Output the name of a curve of the snapshots.
+  * \param curve the index of the curve, lower than LCFR_STATS_CURVE_COUNT
+  * \param[out] _result the address of the pointer to the curve name
+  * \return 0 if successful, a positive number otherwise
+  */
+LCFR_API uint32_t lcfr_Stats_getCurveName(
+    uint32_t curve,
+    char const ** _result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef __cplusplus
+#include <string>
+#include <stdexcept>
+
+namespace lcfr {
+
+/**
+  * \class StatsProxy
+  *
+  * This class reads the operation counters and the latency histograms of the lcfr library.
+  */
+class StatsProxy
+{
+    public:
+    
+    /** \brief Tell whether the library was built with the LCFR_STATS option.
+      */
+    static bool isEnabled()
+    {
+        uint32_t _result;
+        int code = lcfr_Stats_isEnabled(
+            &_result);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_Stats_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result != 0;
+    }
+    
+    /** \brief Copy the operation counters summed over all the threads since the last reset.
+      * \param counters the counters, the value of counter k of curve c at index c * LCFR_STATS_COUNTER_COUNT + k
+      * \param countersSize the capacity of counters, in values
+      * \return the number of values of a full snapshot
+      */
+    static uint32_t snapshot(
+        uint64_t* counters,
+        uint32_t countersSize)
+    {
+        uint32_t _result;
+        int code = lcfr_Stats_snapshot(
+            counters,
+            countersSize,
+            &_result);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_Stats_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Restart the operation counters from zero.
+      */
+    static void reset()
+    {
+        int code = lcfr_Stats_reset();
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_Stats_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Start or stop recording the latency histograms of the sign and verify stages.
+      * \param enabled if true the durations are recorded
+      */
+    static void enableLatency(
+        bool enabled)
+    {
+        int code = lcfr_Stats_enableLatency(
+            enabled ? 1 : 0);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_Stats_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+    }
+    
+    /** \brief Compute the latencies of a stage at the given quantiles.
+      * \param curve the index of the curve
+      * \param operation LCFR_STATS_OPERATION_SIGN or LCFR_STATS_OPERATION_VERIFY
+      * \param stage one of the LCFR_STATS_STAGE_ values
+      * \param quantiles the quantiles, from 0 to 1
+      * \param values the latencies at the quantiles, in nanoseconds
+      * \param count the number of quantiles
+      * \return the number of durations recorded
+      */
+    static uint64_t getLatency(
+        uint32_t curve,
+        uint32_t operation,
+        uint32_t stage,
+        const double* quantiles,
+        double* values,
+        uint32_t count)
+    {
+        uint64_t _result;
+        int code = lcfr_Stats_getLatency(
+            curve,
+            operation,
+            stage,
+            quantiles,
+            values,
+            count,
+            &_result);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_Stats_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return _result;
+    }
+    
+    /** \brief Return the name of a curve of the snapshots.
+      * \param curve the index of the curve, lower than LCFR_STATS_CURVE_COUNT
+      */
+    static std::string getCurveName(
+        uint32_t curve)
+    {
+        const char* _result;
+        int code = lcfr_Stats_getCurveName(
+            curve,
+            &_result);
+        if (code != 0)
+        {
+            const char* message;
+            lcfr_Stats_getExceptionMessage(&message);
+            throw new std::runtime_error(message);
+        }
+        return std::string(_result);
+    }
+};
+
+#ifndef __BUILD_LCFR_LIBRARY__
+typedef StatsProxy Stats;
+#endif
+}
+#endif
@@ -1,2 +1,6 @@
 #include "lcfr/i_library_info.h"
 #include "lcfr/i_ec_cipher.h"
+#include "lcfr/i_ec_cipher_ring.h"
+#include "lcfr/i_signing_key.h"
+#include "lcfr/i_runtime.h"
+#include "lcfr/i_stats.h"
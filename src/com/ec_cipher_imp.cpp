@@ -1,20 +1,35 @@
 #include <memory.h>
+#include <new>
 #include "com/ec_cipher_imp.h"
+#include "lcfr/stats/latency.h"
 
 namespace lcfr {
 
 thread_local std::string EcCipherImp::exceptionMessage_;
 
 EcCipherImp::EcCipherImp()
+    : inPlace_(false)
 {}
 
 EcCipherImp::EcCipherImp(std::unique_ptr<EcCipher>&& obj)
-    : object_(std::move(obj))
+    : object_(std::move(obj)),
+      inPlace_(false)
+{}
+
+EcCipherImp::EcCipherImp(bool inPlace)
+    : inPlace_(inPlace)
 {}
 
 uint32_t STDCALL EcCipherImp::release()
 {
-    delete(this); return 0;
+    if (!inPlace_)
+    {
+        delete(this); return 0;
+    }
+    EcCipher* object = object_.release();
+    if (object) object->~EcCipher();
+    this->~EcCipherImp();
+    return 0;
 }
 
 void* STDCALL EcCipherImp::getObject()
@@ -27,8 +42,18 @@ uint32_t STDCALL EcCipherImp::init(
 {
     try
     {
-        object_ = std::make_unique<EcCipher>(
-            curve);
+        if (inPlace_)
+        {
+            EcCipher* object = object_.release();
+            if (object) object->~EcCipher();
+            object_.reset(new(storage_) EcCipher(
+                curve));
+        }
+        else
+        {
+            object_ = std::make_unique<EcCipher>(
+                curve);
+        }
         return 0;
     }
     catch (const std::exception& e)
@@ -160,6 +185,7 @@ uint32_t STDCALL EcCipherImp::generateSignature(
 {
     try
     {
+        stats::latency::stage_timer timer(object_->getCurveIndex(), stats::latency::SIGN);
         object_->generateSignature(
             r,
             r_size,
@@ -171,6 +197,7 @@ uint32_t STDCALL EcCipherImp::generateSignature(
             ek_size,
             sk,
             sk_size);
+        timer.lap(stats::latency::CALL);
         return 0;
     }
     catch (const std::exception& e)
@@ -195,6 +222,7 @@ uint32_t STDCALL EcCipherImp::verifySignature(
 {
     try
     {
+        stats::latency::stage_timer timer(object_->getCurveIndex(), stats::latency::VERIFY);
         *_result = 
         object_->verifySignature(
             r,
@@ -207,6 +235,7 @@ uint32_t STDCALL EcCipherImp::verifySignature(
             qx_size,
             qy,
             qy_size);
+        timer.lap(stats::latency::CALL);
         return 0;
     }
     catch (const std::exception& e)
@@ -216,135 +245,1592 @@ uint32_t STDCALL EcCipherImp::verifySignature(
     }
 }
 
-}
-extern "C" LCFR_API uint32_t lcfr_EcCipher_release(lcfr_EcCipher_vtable_ptr* this_ptr)
-{
-    return ((lcfr::IEcCipher*)this_ptr)->release();
-}
-extern "C" LCFR_API uint32_t lcfr_EcCipher_getExceptionMessage(char const ** _result)
-{
-    *_result = lcfr::EcCipherImp::exceptionMessage_.c_str();
-    return 0;
-}
-extern "C" LCFR_API uint32_t lcfr_EcCipher_create(
-    lcfr_EcCipher_vtable_ptr** _result,
-    const char* curve)
+uint32_t STDCALL EcCipherImp::generateSignatures(
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* ek,
+    uint32_t ek_size,
+    const uint8_t* sk,
+    uint32_t sk_size,
+    uint32_t count)
 {
     try
     {
-        *_result = (lcfr_EcCipher_vtable_ptr*) new lcfr::EcCipherImp();
+        object_->generateSignatures(
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            ek,
+            ek_size,
+            sk,
+            sk_size,
+            count);
+        return 0;
     }
     catch (const std::exception& e)
     {
-        lcfr::EcCipherImp::exceptionMessage_ = e.what();
+        exceptionMessage_ = e.what();
         return -1;
     }
-    return ((lcfr::EcCipherImp*)*_result)->init(
-        curve);
-}
-extern "C" LCFR_API uint32_t lcfr_EcCipher_getPrimeBitLength(
-    lcfr_EcCipher_vtable_ptr* this_ptr,
-    uint32_t* _result)
-{
-    return ((lcfr::EcCipherImp*)this_ptr)->getPrimeBitLength(
-        _result);
-}
-extern "C" LCFR_API uint32_t lcfr_EcCipher_getPrimeByteLength(
-    lcfr_EcCipher_vtable_ptr* this_ptr,
-    uint32_t* _result)
-{
-    return ((lcfr::EcCipherImp*)this_ptr)->getPrimeByteLength(
-        _result);
-}
-extern "C" LCFR_API uint32_t lcfr_EcCipher_getPrime(
-    lcfr_EcCipher_vtable_ptr* this_ptr,
-    uint8_t* p,
-    uint32_t p_size)
-{
-    return ((lcfr::EcCipherImp*)this_ptr)->getPrime(
-        p,
-        p_size);
-}
-extern "C" LCFR_API uint32_t lcfr_EcCipher_getCurvePointCoordinateBitLength(
-    lcfr_EcCipher_vtable_ptr* this_ptr,
-    uint32_t* _result)
-{
-    return ((lcfr::EcCipherImp*)this_ptr)->getCurvePointCoordinateBitLength(
-        _result);
 }
-extern "C" LCFR_API uint32_t lcfr_EcCipher_getCurvePointCoordinateByteLength(
-    lcfr_EcCipher_vtable_ptr* this_ptr,
-    uint32_t* _result)
-{
-    return ((lcfr::EcCipherImp*)this_ptr)->getCurvePointCoordinateByteLength(
-        _result);
-}
-extern "C" LCFR_API uint32_t lcfr_EcCipher_generatePublicKey(
-    lcfr_EcCipher_vtable_ptr* this_ptr,
-    uint8_t* qx,
+
+uint32_t STDCALL EcCipherImp::verifySignatures(
+    int32_t* results,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* qx,
     uint32_t qx_size,
-    uint8_t* qy,
+    const uint8_t* qy,
     uint32_t qy_size,
-    const uint8_t* sk,
-    uint32_t sk_size)
+    uint32_t count)
 {
-    return ((lcfr::EcCipherImp*)this_ptr)->generatePublicKey(
-        qx,
-        qx_size,
-        qy,
-        qy_size,
-        sk,
-        sk_size);
+    try
+    {
+        object_->verifySignatures(
+            results,
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            count);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
 }
-extern "C" LCFR_API uint32_t lcfr_EcCipher_generateSignature(
-    lcfr_EcCipher_vtable_ptr* this_ptr,
+
+uint32_t STDCALL EcCipherImp::signMessage(
     uint8_t* r,
     uint32_t r_size,
     uint8_t* s,
     uint32_t s_size,
-    const uint8_t* hash,
-    uint32_t h_size,
+    const uint8_t* m,
+    uint32_t m_size,
     const uint8_t* ek,
     uint32_t ek_size,
     const uint8_t* sk,
     uint32_t sk_size)
 {
-    return ((lcfr::EcCipherImp*)this_ptr)->generateSignature(
-        r,
-        r_size,
-        s,
-        s_size,
-        hash,
-        h_size,
-        ek,
-        ek_size,
-        sk,
-        sk_size);
+    try
+    {
+        object_->signMessage(
+            r,
+            r_size,
+            s,
+            s_size,
+            m,
+            m_size,
+            ek,
+            ek_size,
+            sk,
+            sk_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
 }
-extern "C" LCFR_API uint32_t lcfr_EcCipher_verifySignature(
-    lcfr_EcCipher_vtable_ptr* this_ptr,
+
+uint32_t STDCALL EcCipherImp::verifyMessage(
     int32_t* _result,
     const uint8_t* r,
     uint32_t r_size,
     const uint8_t* s,
     uint32_t s_size,
-    const uint8_t* hash,
-    uint32_t h_size,
+    const uint8_t* m,
+    uint32_t m_size,
     const uint8_t* qx,
     uint32_t qx_size,
     const uint8_t* qy,
     uint32_t qy_size)
 {
-    return ((lcfr::EcCipherImp*)this_ptr)->verifySignature(
-        _result,
-        r,
-        r_size,
-        s,
-        s_size,
-        hash,
-        h_size,
-        qx,
-        qx_size,
-        qy,
-        qy_size);
+    try
+    {
+        *_result = 
+        object_->verifyMessage(
+            r,
+            r_size,
+            s,
+            s_size,
+            m,
+            m_size,
+            qx,
+            qx_size,
+            qy,
+            qy_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::signMessages(
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* m,
+    const uint32_t* m_sizes,
+    const uint8_t* ek,
+    uint32_t ek_size,
+    const uint8_t* sk,
+    uint32_t sk_size,
+    uint32_t count)
+{
+    try
+    {
+        object_->signMessages(
+            r,
+            r_size,
+            s,
+            s_size,
+            m,
+            m_sizes,
+            ek,
+            ek_size,
+            sk,
+            sk_size,
+            count);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::verifyMessages(
+    int32_t* results,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* m,
+    const uint32_t* m_sizes,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size,
+    uint32_t count)
+{
+    try
+    {
+        object_->verifyMessages(
+            results,
+            r,
+            r_size,
+            s,
+            s_size,
+            m,
+            m_sizes,
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            count);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::generateSignatureRandom(
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* sk,
+    uint32_t sk_size)
+{
+    try
+    {
+        object_->generateSignatureRandom(
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            sk,
+            sk_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::encodePublicKey(
+    uint32_t* _result,
+    uint8_t* q,
+    uint32_t q_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size,
+    uint32_t compressed)
+{
+    try
+    {
+        *_result = 
+        object_->encodePublicKey(
+            q,
+            q_size,
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            compressed != 0);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::decodePublicKey(
+    uint8_t* qx,
+    uint32_t qx_size,
+    uint8_t* qy,
+    uint32_t qy_size,
+    const uint8_t* q,
+    uint32_t q_size)
+{
+    try
+    {
+        object_->decodePublicKey(
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            q,
+            q_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::decodePublicKeys(
+    int32_t* results,
+    uint8_t* qx,
+    uint32_t qx_size,
+    uint8_t* qy,
+    uint32_t qy_size,
+    const uint8_t* q,
+    uint32_t q_size,
+    uint32_t count)
+{
+    try
+    {
+        object_->decodePublicKeys(
+            results,
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            q,
+            q_size,
+            count);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::generateRecoverableSignature(
+    uint32_t* _result,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* ek,
+    uint32_t ek_size,
+    const uint8_t* sk,
+    uint32_t sk_size)
+{
+    try
+    {
+        *_result = 
+        object_->generateRecoverableSignature(
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            ek,
+            ek_size,
+            sk,
+            sk_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::recoverPublicKey(
+    uint8_t* qx,
+    uint32_t qx_size,
+    uint8_t* qy,
+    uint32_t qy_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    uint32_t v)
+{
+    try
+    {
+        object_->recoverPublicKey(
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            v);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::encodeSignatureDer(
+    uint32_t* _result,
+    uint8_t* der,
+    uint32_t der_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size)
+{
+    try
+    {
+        *_result = 
+        object_->encodeSignatureDer(
+            der,
+            der_size,
+            r,
+            r_size,
+            s,
+            s_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::decodeSignatureDer(
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* der,
+    uint32_t der_size)
+{
+    try
+    {
+        object_->decodeSignatureDer(
+            r,
+            r_size,
+            s,
+            s_size,
+            der,
+            der_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::encodeSignatureCompact(
+    uint32_t* _result,
+    uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size)
+{
+    try
+    {
+        *_result = 
+        object_->encodeSignatureCompact(
+            c,
+            c_size,
+            r,
+            r_size,
+            s,
+            s_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::decodeSignatureCompact(
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* c,
+    uint32_t c_size)
+{
+    try
+    {
+        object_->decodeSignatureCompact(
+            r,
+            r_size,
+            s,
+            s_size,
+            c,
+            c_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::encodeSignaturesDer(
+    uint32_t* _result,
+    uint32_t* der_sizes,
+    uint8_t* der,
+    uint32_t der_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    uint32_t count)
+{
+    try
+    {
+        *_result = 
+        object_->encodeSignaturesDer(
+            der_sizes,
+            der,
+            der_size,
+            r,
+            r_size,
+            s,
+            s_size,
+            count);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::decodeSignaturesDer(
+    int32_t* results,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* der,
+    const uint32_t* der_sizes,
+    uint32_t count)
+{
+    try
+    {
+        object_->decodeSignaturesDer(
+            results,
+            r,
+            r_size,
+            s,
+            s_size,
+            der,
+            der_sizes,
+            count);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::encodeSignaturesCompact(
+    uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    uint32_t count)
+{
+    try
+    {
+        object_->encodeSignaturesCompact(
+            c,
+            c_size,
+            r,
+            r_size,
+            s,
+            s_size,
+            count);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::decodeSignaturesCompact(
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* c,
+    uint32_t c_size,
+    uint32_t count)
+{
+    try
+    {
+        object_->decodeSignaturesCompact(
+            r,
+            r_size,
+            s,
+            s_size,
+            c,
+            c_size,
+            count);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::verifySignaturesDer(
+    int32_t* results,
+    const uint8_t* der,
+    const uint32_t* der_sizes,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size,
+    uint32_t count)
+{
+    try
+    {
+        object_->verifySignaturesDer(
+            results,
+            der,
+            der_sizes,
+            hash,
+            h_size,
+            qx,
+            qx_size,
+            qy,
+            qy_size,
+            count);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::generateCompressedSignature(
+    uint32_t* _result,
+    uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* sk,
+    uint32_t sk_size)
+{
+    try
+    {
+        *_result = 
+        object_->generateCompressedSignature(
+            c,
+            c_size,
+            hash,
+            h_size,
+            sk,
+            sk_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::encodeCompressedSignature(
+    uint32_t* _result,
+    uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    uint32_t v)
+{
+    try
+    {
+        *_result = 
+        object_->encodeCompressedSignature(
+            c,
+            c_size,
+            r,
+            r_size,
+            s,
+            s_size,
+            v);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::decodeCompressedSignature(
+    uint32_t* _result,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* c,
+    uint32_t c_size)
+{
+    try
+    {
+        *_result = 
+        object_->decodeCompressedSignature(
+            r,
+            r_size,
+            s,
+            s_size,
+            c,
+            c_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::encodeCompressedKey(
+    uint8_t* k,
+    uint32_t k_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size)
+{
+    try
+    {
+        object_->encodeCompressedKey(
+            k,
+            k_size,
+            qx,
+            qx_size,
+            qy,
+            qy_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::verifyCompressedSignature(
+    int32_t* _result,
+    const uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* k,
+    uint32_t k_size)
+{
+    try
+    {
+        *_result = 
+        object_->verifyCompressedSignature(
+            c,
+            c_size,
+            hash,
+            h_size,
+            k,
+            k_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherImp::verifyCompressedSignatures(
+    int32_t* results,
+    const uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* k,
+    uint32_t k_size,
+    uint32_t count)
+{
+    try
+    {
+        object_->verifyCompressedSignatures(
+            results,
+            c,
+            c_size,
+            hash,
+            h_size,
+            k,
+            k_size,
+            count);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_release(lcfr_EcCipher_vtable_ptr* this_ptr)
+{
+    return ((lcfr::IEcCipher*)this_ptr)->release();
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_getExceptionMessage(char const ** _result)
+{
+    *_result = lcfr::EcCipherImp::exceptionMessage_.c_str();
+    return 0;
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_create(
+    lcfr_EcCipher_vtable_ptr** _result,
+    const char* curve)
+{
+    try
+    {
+        *_result = (lcfr_EcCipher_vtable_ptr*) new lcfr::EcCipherImp();
+    }
+    catch (const std::exception& e)
+    {
+        lcfr::EcCipherImp::exceptionMessage_ = e.what();
+        return -1;
+    }
+    return ((lcfr::EcCipherImp*)*_result)->init(
+        curve);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_sizeof(uint32_t* _result)
+{
+    *_result = sizeof(lcfr::EcCipherImp);
+    return 0;
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_createInPlace(
+    lcfr_EcCipher_vtable_ptr** _result,
+    void* memory,
+    uint32_t memory_size,
+    const char* curve)
+{
+    static_assert(alignof(lcfr::EcCipherImp) <= 8, "the memory block alignment is not enough");
+    if (memory == nullptr || memory_size < sizeof(lcfr::EcCipherImp) || reinterpret_cast<uintptr_t>(memory) % 8 != 0)
+    {
+        lcfr::EcCipherImp::exceptionMessage_ = "invalid memory block";
+        return -1;
+    }
+    lcfr::EcCipherImp* imp = new(memory) lcfr::EcCipherImp(true);
+    uint32_t code = imp->init(
+        curve);
+    if (code != 0)
+    {
+        imp->release();
+        return code;
+    }
+    *_result = (lcfr_EcCipher_vtable_ptr*) imp;
+    return 0;
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_getPrimeBitLength(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->getPrimeBitLength(
+        _result);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_getPrimeByteLength(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->getPrimeByteLength(
+        _result);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_getPrime(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* p,
+    uint32_t p_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->getPrime(
+        p,
+        p_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_getCurvePointCoordinateBitLength(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->getCurvePointCoordinateBitLength(
+        _result);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_getCurvePointCoordinateByteLength(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->getCurvePointCoordinateByteLength(
+        _result);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_generatePublicKey(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* qx,
+    uint32_t qx_size,
+    uint8_t* qy,
+    uint32_t qy_size,
+    const uint8_t* sk,
+    uint32_t sk_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->generatePublicKey(
+        qx,
+        qx_size,
+        qy,
+        qy_size,
+        sk,
+        sk_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_generateSignature(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* ek,
+    uint32_t ek_size,
+    const uint8_t* sk,
+    uint32_t sk_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->generateSignature(
+        r,
+        r_size,
+        s,
+        s_size,
+        hash,
+        h_size,
+        ek,
+        ek_size,
+        sk,
+        sk_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_verifySignature(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* _result,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->verifySignature(
+        _result,
+        r,
+        r_size,
+        s,
+        s_size,
+        hash,
+        h_size,
+        qx,
+        qx_size,
+        qy,
+        qy_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_generateSignatures(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* ek,
+    uint32_t ek_size,
+    const uint8_t* sk,
+    uint32_t sk_size,
+    uint32_t count)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->generateSignatures(
+        r,
+        r_size,
+        s,
+        s_size,
+        hash,
+        h_size,
+        ek,
+        ek_size,
+        sk,
+        sk_size,
+        count);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_verifySignatures(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* results,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size,
+    uint32_t count)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->verifySignatures(
+        results,
+        r,
+        r_size,
+        s,
+        s_size,
+        hash,
+        h_size,
+        qx,
+        qx_size,
+        qy,
+        qy_size,
+        count);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_signMessage(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* m,
+    uint32_t m_size,
+    const uint8_t* ek,
+    uint32_t ek_size,
+    const uint8_t* sk,
+    uint32_t sk_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->signMessage(
+        r,
+        r_size,
+        s,
+        s_size,
+        m,
+        m_size,
+        ek,
+        ek_size,
+        sk,
+        sk_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_verifyMessage(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* _result,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* m,
+    uint32_t m_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->verifyMessage(
+        _result,
+        r,
+        r_size,
+        s,
+        s_size,
+        m,
+        m_size,
+        qx,
+        qx_size,
+        qy,
+        qy_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_signMessages(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* m,
+    const uint32_t* m_sizes,
+    const uint8_t* ek,
+    uint32_t ek_size,
+    const uint8_t* sk,
+    uint32_t sk_size,
+    uint32_t count)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->signMessages(
+        r,
+        r_size,
+        s,
+        s_size,
+        m,
+        m_sizes,
+        ek,
+        ek_size,
+        sk,
+        sk_size,
+        count);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_verifyMessages(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* results,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* m,
+    const uint32_t* m_sizes,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size,
+    uint32_t count)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->verifyMessages(
+        results,
+        r,
+        r_size,
+        s,
+        s_size,
+        m,
+        m_sizes,
+        qx,
+        qx_size,
+        qy,
+        qy_size,
+        count);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_generateSignatureRandom(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* sk,
+    uint32_t sk_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->generateSignatureRandom(
+        r,
+        r_size,
+        s,
+        s_size,
+        hash,
+        h_size,
+        sk,
+        sk_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_encodePublicKey(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* q,
+    uint32_t q_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size,
+    uint32_t compressed)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->encodePublicKey(
+        _result,
+        q,
+        q_size,
+        qx,
+        qx_size,
+        qy,
+        qy_size,
+        compressed);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_decodePublicKey(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* qx,
+    uint32_t qx_size,
+    uint8_t* qy,
+    uint32_t qy_size,
+    const uint8_t* q,
+    uint32_t q_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->decodePublicKey(
+        qx,
+        qx_size,
+        qy,
+        qy_size,
+        q,
+        q_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_decodePublicKeys(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* results,
+    uint8_t* qx,
+    uint32_t qx_size,
+    uint8_t* qy,
+    uint32_t qy_size,
+    const uint8_t* q,
+    uint32_t q_size,
+    uint32_t count)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->decodePublicKeys(
+        results,
+        qx,
+        qx_size,
+        qy,
+        qy_size,
+        q,
+        q_size,
+        count);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_generateRecoverableSignature(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* ek,
+    uint32_t ek_size,
+    const uint8_t* sk,
+    uint32_t sk_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->generateRecoverableSignature(
+        _result,
+        r,
+        r_size,
+        s,
+        s_size,
+        hash,
+        h_size,
+        ek,
+        ek_size,
+        sk,
+        sk_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_recoverPublicKey(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* qx,
+    uint32_t qx_size,
+    uint8_t* qy,
+    uint32_t qy_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    uint32_t v)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->recoverPublicKey(
+        qx,
+        qx_size,
+        qy,
+        qy_size,
+        r,
+        r_size,
+        s,
+        s_size,
+        hash,
+        h_size,
+        v);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_encodeSignatureDer(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* der,
+    uint32_t der_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->encodeSignatureDer(
+        _result,
+        der,
+        der_size,
+        r,
+        r_size,
+        s,
+        s_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_decodeSignatureDer(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* der,
+    uint32_t der_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->decodeSignatureDer(
+        r,
+        r_size,
+        s,
+        s_size,
+        der,
+        der_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_encodeSignatureCompact(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->encodeSignatureCompact(
+        _result,
+        c,
+        c_size,
+        r,
+        r_size,
+        s,
+        s_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_decodeSignatureCompact(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* c,
+    uint32_t c_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->decodeSignatureCompact(
+        r,
+        r_size,
+        s,
+        s_size,
+        c,
+        c_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_encodeSignaturesDer(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint32_t* der_sizes,
+    uint8_t* der,
+    uint32_t der_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    uint32_t count)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->encodeSignaturesDer(
+        _result,
+        der_sizes,
+        der,
+        der_size,
+        r,
+        r_size,
+        s,
+        s_size,
+        count);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_decodeSignaturesDer(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* results,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* der,
+    const uint32_t* der_sizes,
+    uint32_t count)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->decodeSignaturesDer(
+        results,
+        r,
+        r_size,
+        s,
+        s_size,
+        der,
+        der_sizes,
+        count);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_encodeSignaturesCompact(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    uint32_t count)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->encodeSignaturesCompact(
+        c,
+        c_size,
+        r,
+        r_size,
+        s,
+        s_size,
+        count);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_decodeSignaturesCompact(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* c,
+    uint32_t c_size,
+    uint32_t count)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->decodeSignaturesCompact(
+        r,
+        r_size,
+        s,
+        s_size,
+        c,
+        c_size,
+        count);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_verifySignaturesDer(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* results,
+    const uint8_t* der,
+    const uint32_t* der_sizes,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size,
+    uint32_t count)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->verifySignaturesDer(
+        results,
+        der,
+        der_sizes,
+        hash,
+        h_size,
+        qx,
+        qx_size,
+        qy,
+        qy_size,
+        count);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_generateCompressedSignature(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* sk,
+    uint32_t sk_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->generateCompressedSignature(
+        _result,
+        c,
+        c_size,
+        hash,
+        h_size,
+        sk,
+        sk_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_encodeCompressedSignature(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* r,
+    uint32_t r_size,
+    const uint8_t* s,
+    uint32_t s_size,
+    uint32_t v)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->encodeCompressedSignature(
+        _result,
+        c,
+        c_size,
+        r,
+        r_size,
+        s,
+        s_size,
+        v);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_decodeCompressedSignature(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* c,
+    uint32_t c_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->decodeCompressedSignature(
+        _result,
+        r,
+        r_size,
+        s,
+        s_size,
+        c,
+        c_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_encodeCompressedKey(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    uint8_t* k,
+    uint32_t k_size,
+    const uint8_t* qx,
+    uint32_t qx_size,
+    const uint8_t* qy,
+    uint32_t qy_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->encodeCompressedKey(
+        k,
+        k_size,
+        qx,
+        qx_size,
+        qy,
+        qy_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_verifyCompressedSignature(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* _result,
+    const uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* k,
+    uint32_t k_size)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->verifyCompressedSignature(
+        _result,
+        c,
+        c_size,
+        hash,
+        h_size,
+        k,
+        k_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipher_verifyCompressedSignatures(
+    lcfr_EcCipher_vtable_ptr* this_ptr,
+    int32_t* results,
+    const uint8_t* c,
+    uint32_t c_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    const uint8_t* k,
+    uint32_t k_size,
+    uint32_t count)
+{
+    return ((lcfr::EcCipherImp*)this_ptr)->verifyCompressedSignatures(
+        results,
+        c,
+        c_size,
+        hash,
+        h_size,
+        k,
+        k_size,
+        count);
 }
@@ -15,8 +15,13 @@ struct EcCipherImp : public IEcCipher
     static thread_local std::string exceptionMessage_;
     std::unique_ptr<EcCipher> object_;
     
+    // created by lcfr_EcCipher_createInPlace, the object lives in storage_ and the memory belongs to the caller
+    bool inPlace_;
+    alignas(EcCipher) uint8_t storage_[sizeof(EcCipher)];
+    
     EcCipherImp();
     EcCipherImp(std::unique_ptr<EcCipher>&& obj);
+    EcCipherImp(bool inPlace);
     
     virtual uint32_t STDCALL release();
     
@@ -72,7 +77,290 @@ struct EcCipherImp : public IEcCipher
         const uint8_t* qx,
         uint32_t qx_size,
         const uint8_t* qy,
-        uint32_t qy_size);  
+        uint32_t qy_size);
+    
+    virtual uint32_t STDCALL generateSignatures(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size,
+        uint32_t count);
+    
+    virtual uint32_t STDCALL verifySignatures(
+        int32_t* results,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size,
+        uint32_t count);
+    
+    virtual uint32_t STDCALL signMessage(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        uint32_t m_size,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size);
+    
+    virtual uint32_t STDCALL verifyMessage(
+        int32_t* _result,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        uint32_t m_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size);
+    
+    virtual uint32_t STDCALL signMessages(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        const uint32_t* m_sizes,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size,
+        uint32_t count);
+    
+    virtual uint32_t STDCALL verifyMessages(
+        int32_t* results,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        const uint32_t* m_sizes,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size,
+        uint32_t count);
+    
+    virtual uint32_t STDCALL generateSignatureRandom(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* sk,
+        uint32_t sk_size);
+    
+    virtual uint32_t STDCALL encodePublicKey(
+        uint32_t* _result,
+        uint8_t* q,
+        uint32_t q_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size,
+        uint32_t compressed);
+    
+    virtual uint32_t STDCALL decodePublicKey(
+        uint8_t* qx,
+        uint32_t qx_size,
+        uint8_t* qy,
+        uint32_t qy_size,
+        const uint8_t* q,
+        uint32_t q_size);
+    
+    virtual uint32_t STDCALL decodePublicKeys(
+        int32_t* results,
+        uint8_t* qx,
+        uint32_t qx_size,
+        uint8_t* qy,
+        uint32_t qy_size,
+        const uint8_t* q,
+        uint32_t q_size,
+        uint32_t count);
+    
+    virtual uint32_t STDCALL generateRecoverableSignature(
+        uint32_t* _result,
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* ek,
+        uint32_t ek_size,
+        const uint8_t* sk,
+        uint32_t sk_size);
+    
+    virtual uint32_t STDCALL recoverPublicKey(
+        uint8_t* qx,
+        uint32_t qx_size,
+        uint8_t* qy,
+        uint32_t qy_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        uint32_t v);
+    
+    virtual uint32_t STDCALL encodeSignatureDer(
+        uint32_t* _result,
+        uint8_t* der,
+        uint32_t der_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size);
+    
+    virtual uint32_t STDCALL decodeSignatureDer(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* der,
+        uint32_t der_size);
+    
+    virtual uint32_t STDCALL encodeSignatureCompact(
+        uint32_t* _result,
+        uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size);
+    
+    virtual uint32_t STDCALL decodeSignatureCompact(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* c,
+        uint32_t c_size);
+    
+    virtual uint32_t STDCALL encodeSignaturesDer(
+        uint32_t* _result,
+        uint32_t* der_sizes,
+        uint8_t* der,
+        uint32_t der_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        uint32_t count);
+    
+    virtual uint32_t STDCALL decodeSignaturesDer(
+        int32_t* results,
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* der,
+        const uint32_t* der_sizes,
+        uint32_t count);
+    
+    virtual uint32_t STDCALL encodeSignaturesCompact(
+        uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        uint32_t count);
+    
+    virtual uint32_t STDCALL decodeSignaturesCompact(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* c,
+        uint32_t c_size,
+        uint32_t count);
+    
+    virtual uint32_t STDCALL verifySignaturesDer(
+        int32_t* results,
+        const uint8_t* der,
+        const uint32_t* der_sizes,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size,
+        uint32_t count);
+    
+    virtual uint32_t STDCALL generateCompressedSignature(
+        uint32_t* _result,
+        uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* sk,
+        uint32_t sk_size);
+    
+    virtual uint32_t STDCALL encodeCompressedSignature(
+        uint32_t* _result,
+        uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* r,
+        uint32_t r_size,
+        const uint8_t* s,
+        uint32_t s_size,
+        uint32_t v);
+    
+    virtual uint32_t STDCALL decodeCompressedSignature(
+        uint32_t* _result,
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* c,
+        uint32_t c_size);
+    
+    virtual uint32_t STDCALL encodeCompressedKey(
+        uint8_t* k,
+        uint32_t k_size,
+        const uint8_t* qx,
+        uint32_t qx_size,
+        const uint8_t* qy,
+        uint32_t qy_size);
+    
+    virtual uint32_t STDCALL verifyCompressedSignature(
+        int32_t* _result,
+        const uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* k,
+        uint32_t k_size);
+    
+    virtual uint32_t STDCALL verifyCompressedSignatures(
+        int32_t* results,
+        const uint8_t* c,
+        uint32_t c_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        const uint8_t* k,
+        uint32_t k_size,
+        uint32_t count);
 };
 
 }
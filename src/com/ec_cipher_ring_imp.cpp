@@ -0,0 +1,202 @@
+#include <stddef.h>
+#include "com/ec_cipher_ring_imp.h"
+#include "com/ec_cipher_imp.h"
+
+namespace lcfr {
+
+static_assert(sizeof(lcfr_EcCipherRing_request) == sizeof(EcCipherRing::Request), "request layout mismatch");
+static_assert(offsetof(lcfr_EcCipherRing_request, k2) == offsetof(EcCipherRing::Request, k2), "request layout mismatch");
+static_assert(sizeof(lcfr_EcCipherRing_completion) == sizeof(EcCipherRing::Completion), "completion layout mismatch");
+static_assert(offsetof(lcfr_EcCipherRing_completion, status) == offsetof(EcCipherRing::Completion, status), "completion layout mismatch");
+
+thread_local std::string EcCipherRingImp::exceptionMessage_;
+
+EcCipherRingImp::EcCipherRingImp()
+{}
+
+EcCipherRingImp::EcCipherRingImp(std::unique_ptr<EcCipherRing>&& obj)
+    : object_(std::move(obj))
+{}
+
+uint32_t STDCALL EcCipherRingImp::release()
+{
+    delete(this); return 0;
+}
+
+void* STDCALL EcCipherRingImp::getObject()
+{
+    return &object_;
+}
+
+uint32_t STDCALL EcCipherRingImp::init(
+    IEcCipher* cipher,
+    uint32_t entries)
+{
+    try
+    {
+        object_ = std::make_unique<EcCipherRing>(
+            static_cast<EcCipherImp*>(cipher)->object_.get(),
+            entries);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherRingImp::submit(
+    uint32_t* _result,
+    const lcfr_EcCipherRing_request* requests,
+    uint32_t count)
+{
+    try
+    {
+        *_result = 
+        object_->submit(
+            reinterpret_cast<const EcCipherRing::Request*>(requests),
+            count);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherRingImp::poll(
+    uint32_t* _result,
+    lcfr_EcCipherRing_completion* completions,
+    uint32_t capacity)
+{
+    try
+    {
+        *_result = 
+        object_->poll(
+            reinterpret_cast<EcCipherRing::Completion*>(completions),
+            capacity);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherRingImp::wait(
+    uint32_t* _result,
+    lcfr_EcCipherRing_completion* completions,
+    uint32_t capacity,
+    uint32_t min_complete)
+{
+    try
+    {
+        *_result = 
+        object_->wait(
+            reinterpret_cast<EcCipherRing::Completion*>(completions),
+            capacity,
+            min_complete);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcCipherRingImp::getEventFd(
+    int32_t* _result)
+{
+    try
+    {
+        *_result = 
+        object_->getEventFd();
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipherRing_release(lcfr_EcCipherRing_vtable_ptr* this_ptr)
+{
+    return ((lcfr::IEcCipherRing*)this_ptr)->release();
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipherRing_getExceptionMessage(char const ** _result)
+{
+    *_result = lcfr::EcCipherRingImp::exceptionMessage_.c_str();
+    return 0;
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipherRing_create(
+    lcfr_EcCipherRing_vtable_ptr** _result,
+    lcfr_EcCipher_vtable_ptr* cipher,
+    uint32_t entries)
+{
+    try
+    {
+        *_result = (lcfr_EcCipherRing_vtable_ptr*) new lcfr::EcCipherRingImp();
+    }
+    catch (const std::exception& e)
+    {
+        lcfr::EcCipherRingImp::exceptionMessage_ = e.what();
+        return -1;
+    }
+    uint32_t code = ((lcfr::EcCipherRingImp*)*_result)->init(
+        (lcfr::IEcCipher*)cipher,
+        entries);
+    if (code != 0)
+    {
+        ((lcfr::EcCipherRingImp*)*_result)->release();
+        *_result = nullptr;
+    }
+    return code;
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipherRing_submit(
+    lcfr_EcCipherRing_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    const lcfr_EcCipherRing_request* requests,
+    uint32_t count)
+{
+    return ((lcfr::EcCipherRingImp*)this_ptr)->submit(
+        _result,
+        requests,
+        count);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipherRing_poll(
+    lcfr_EcCipherRing_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    lcfr_EcCipherRing_completion* completions,
+    uint32_t capacity)
+{
+    return ((lcfr::EcCipherRingImp*)this_ptr)->poll(
+        _result,
+        completions,
+        capacity);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipherRing_wait(
+    lcfr_EcCipherRing_vtable_ptr* this_ptr,
+    uint32_t* _result,
+    lcfr_EcCipherRing_completion* completions,
+    uint32_t capacity,
+    uint32_t min_complete)
+{
+    return ((lcfr::EcCipherRingImp*)this_ptr)->wait(
+        _result,
+        completions,
+        capacity,
+        min_complete);
+}
+extern "C" LCFR_API uint32_t lcfr_EcCipherRing_getEventFd(
+    lcfr_EcCipherRing_vtable_ptr* this_ptr,
+    int32_t* _result)
+{
+    return ((lcfr::EcCipherRingImp*)this_ptr)->getEventFd(
+        _result);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <exception>
+#include "lcfr/cipher_ring.h"
+#include "lcfr/i_ec_cipher_ring.h"
+
+namespace lcfr {
+
+struct EcCipherRingImp : public IEcCipherRing
+{
+    static thread_local std::string exceptionMessage_;
+    std::unique_ptr<EcCipherRing> object_;
+    
+    EcCipherRingImp();
+    EcCipherRingImp(std::unique_ptr<EcCipherRing>&& obj);
+    
+    virtual uint32_t STDCALL release();
+    
+    void* STDCALL getObject();
+    
+    virtual uint32_t STDCALL init(
+        IEcCipher* cipher,
+        uint32_t entries);
+    
+    virtual uint32_t STDCALL submit(
+        uint32_t* _result,
+        const lcfr_EcCipherRing_request* requests,
+        uint32_t count);
+    
+    virtual uint32_t STDCALL poll(
+        uint32_t* _result,
+        lcfr_EcCipherRing_completion* completions,
+        uint32_t capacity);
+    
+    virtual uint32_t STDCALL wait(
+        uint32_t* _result,
+        lcfr_EcCipherRing_completion* completions,
+        uint32_t capacity,
+        uint32_t min_complete);
+    
+    virtual uint32_t STDCALL getEventFd(
+        int32_t* _result);
+};
+
+}
@@ -52,6 +52,22 @@ uint32_t STDCALL LibraryInfoImp::getVersion(
     }
 }
 
+uint32_t STDCALL LibraryInfoImp::getActiveKernels(
+    char const ** _result)
+{
+    try
+    {
+        *_result = 
+        object_->getActiveKernels();
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
 }
 extern "C" LCFR_API uint32_t lcfr_LibraryInfo_release(lcfr_LibraryInfo_vtable_ptr* this_ptr)
 {
@@ -83,3 +99,10 @@ extern "C" LCFR_API uint32_t lcfr_LibraryInfo_getVersion(
     return ((lcfr::LibraryInfoImp*)this_ptr)->getVersion(
         _result);
 }
+extern "C" LCFR_API uint32_t lcfr_LibraryInfo_getActiveKernels(
+    lcfr_LibraryInfo_vtable_ptr* this_ptr,
+    char const ** _result)
+{
+    return ((lcfr::LibraryInfoImp*)this_ptr)->getActiveKernels(
+        _result);
+}
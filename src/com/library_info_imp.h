@@ -27,6 +27,9 @@ struct LibraryInfoImp : public ILibraryInfo
     virtual uint32_t STDCALL getVersion(
         char const ** _result);
     
+    virtual uint32_t STDCALL getActiveKernels(
+        char const ** _result);
+    
 };
 
 }
@@ -0,0 +1,137 @@
+#include "com/runtime_imp.h"
+
+namespace lcfr {
+
+thread_local std::string RuntimeImp::exceptionMessage_;
+
+uint32_t RuntimeImp::configure(
+    uint32_t threadCount,
+    uint32_t pinning)
+{
+    try
+    {
+        Runtime::configure(
+            threadCount,
+            pinning);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t RuntimeImp::configureParallelVerify(
+    uint32_t helperCount,
+    uint32_t pinning)
+{
+    try
+    {
+        Runtime::configureParallelVerify(
+            helperCount,
+            pinning);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t RuntimeImp::autotune(
+    const char* configPath,
+    uint32_t* _result)
+{
+    try
+    {
+        *_result = Runtime::autotune(
+            configPath) ? 1 : 0;
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t RuntimeImp::getTuning(
+    const char* curve,
+    uint32_t* window,
+    uint32_t* minLanes)
+{
+    try
+    {
+        Runtime::getTuning(
+            curve,
+            *window,
+            *minLanes);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t RuntimeImp::selfTest()
+{
+    try
+    {
+        Runtime::selfTest();
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+}
+extern "C" LCFR_API uint32_t lcfr_Runtime_getExceptionMessage(char const ** _result)
+{
+    *_result = lcfr::RuntimeImp::exceptionMessage_.c_str();
+    return 0;
+}
+extern "C" LCFR_API uint32_t lcfr_Runtime_configure(
+    uint32_t threadCount,
+    uint32_t pinning)
+{
+    return lcfr::RuntimeImp::configure(
+        threadCount,
+        pinning);
+}
+extern "C" LCFR_API uint32_t lcfr_Runtime_configureParallelVerify(
+    uint32_t helperCount,
+    uint32_t pinning)
+{
+    return lcfr::RuntimeImp::configureParallelVerify(
+        helperCount,
+        pinning);
+}
+extern "C" LCFR_API uint32_t lcfr_Runtime_autotune(
+    const char* configPath,
+    uint32_t* _result)
+{
+    return lcfr::RuntimeImp::autotune(
+        configPath,
+        _result);
+}
+extern "C" LCFR_API uint32_t lcfr_Runtime_getTuning(
+    const char* curve,
+    uint32_t* window,
+    uint32_t* minLanes)
+{
+    return lcfr::RuntimeImp::getTuning(
+        curve,
+        window,
+        minLanes);
+}
+extern "C" LCFR_API uint32_t lcfr_Runtime_selfTest()
+{
+    return lcfr::RuntimeImp::selfTest();
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <exception>
+#include "lcfr/i_runtime.h"
+#include "lcfr/runtime.h"
+
+namespace lcfr {
+
+struct RuntimeImp
+{
+    static thread_local std::string exceptionMessage_;
+    
+    static uint32_t configure(
+        uint32_t threadCount,
+        uint32_t pinning);
+    
+    static uint32_t configureParallelVerify(
+        uint32_t helperCount,
+        uint32_t pinning);
+    
+    static uint32_t autotune(
+        const char* configPath,
+        uint32_t* _result);
+    
+    static uint32_t getTuning(
+        const char* curve,
+        uint32_t* window,
+        uint32_t* minLanes);
+    
+    static uint32_t selfTest();
+};
+
+}
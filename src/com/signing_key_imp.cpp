@@ -0,0 +1,248 @@
+#include "com/signing_key_imp.h"
+#include "com/ec_cipher_imp.h"
+
+namespace lcfr {
+
+thread_local std::string EcSigningKeyImp::exceptionMessage_;
+
+EcSigningKeyImp::EcSigningKeyImp()
+{}
+
+EcSigningKeyImp::EcSigningKeyImp(std::unique_ptr<EcSigningKey>&& obj)
+    : object_(std::move(obj))
+{}
+
+uint32_t STDCALL EcSigningKeyImp::release()
+{
+    delete(this); return 0;
+}
+
+void* STDCALL EcSigningKeyImp::getObject()
+{
+    return &object_;
+}
+
+uint32_t STDCALL EcSigningKeyImp::init(
+    IEcCipher* cipher,
+    const uint8_t* sk,
+    uint32_t sk_size)
+{
+    try
+    {
+        object_ = std::make_unique<EcSigningKey>(
+            static_cast<EcCipherImp*>(cipher)->object_.get(),
+            sk,
+            sk_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcSigningKeyImp::generateNonce(
+    uint8_t* k,
+    uint32_t k_size,
+    const uint8_t* hash,
+    uint32_t h_size)
+{
+    try
+    {
+        object_->generateNonce(
+            k,
+            k_size,
+            hash,
+            h_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcSigningKeyImp::generateSignature(
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size)
+{
+    try
+    {
+        object_->generateSignature(
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcSigningKeyImp::signMessage(
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* m,
+    uint32_t m_size)
+{
+    try
+    {
+        object_->signMessage(
+            r,
+            r_size,
+            s,
+            s_size,
+            m,
+            m_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t STDCALL EcSigningKeyImp::generateSignatures(
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    uint32_t count)
+{
+    try
+    {
+        object_->generateSignatures(
+            r,
+            r_size,
+            s,
+            s_size,
+            hash,
+            h_size,
+            count);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+}
+extern "C" LCFR_API uint32_t lcfr_EcSigningKey_release(lcfr_EcSigningKey_vtable_ptr* this_ptr)
+{
+    return ((lcfr::IEcSigningKey*)this_ptr)->release();
+}
+extern "C" LCFR_API uint32_t lcfr_EcSigningKey_getExceptionMessage(char const ** _result)
+{
+    *_result = lcfr::EcSigningKeyImp::exceptionMessage_.c_str();
+    return 0;
+}
+extern "C" LCFR_API uint32_t lcfr_EcSigningKey_create(
+    lcfr_EcSigningKey_vtable_ptr** _result,
+    lcfr_EcCipher_vtable_ptr* cipher,
+    const uint8_t* sk,
+    uint32_t sk_size)
+{
+    try
+    {
+        *_result = (lcfr_EcSigningKey_vtable_ptr*) new lcfr::EcSigningKeyImp();
+    }
+    catch (const std::exception& e)
+    {
+        lcfr::EcSigningKeyImp::exceptionMessage_ = e.what();
+        return -1;
+    }
+    uint32_t code = ((lcfr::EcSigningKeyImp*)*_result)->init(
+        (lcfr::IEcCipher*)cipher,
+        sk,
+        sk_size);
+    if (code != 0)
+    {
+        ((lcfr::EcSigningKeyImp*)*_result)->release();
+        *_result = nullptr;
+    }
+    return code;
+}
+extern "C" LCFR_API uint32_t lcfr_EcSigningKey_generateNonce(
+    lcfr_EcSigningKey_vtable_ptr* this_ptr,
+    uint8_t* k,
+    uint32_t k_size,
+    const uint8_t* hash,
+    uint32_t h_size)
+{
+    return ((lcfr::EcSigningKeyImp*)this_ptr)->generateNonce(
+        k,
+        k_size,
+        hash,
+        h_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcSigningKey_generateSignature(
+    lcfr_EcSigningKey_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size)
+{
+    return ((lcfr::EcSigningKeyImp*)this_ptr)->generateSignature(
+        r,
+        r_size,
+        s,
+        s_size,
+        hash,
+        h_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcSigningKey_signMessage(
+    lcfr_EcSigningKey_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* m,
+    uint32_t m_size)
+{
+    return ((lcfr::EcSigningKeyImp*)this_ptr)->signMessage(
+        r,
+        r_size,
+        s,
+        s_size,
+        m,
+        m_size);
+}
+extern "C" LCFR_API uint32_t lcfr_EcSigningKey_generateSignatures(
+    lcfr_EcSigningKey_vtable_ptr* this_ptr,
+    uint8_t* r,
+    uint32_t r_size,
+    uint8_t* s,
+    uint32_t s_size,
+    const uint8_t* hash,
+    uint32_t h_size,
+    uint32_t count)
+{
+    return ((lcfr::EcSigningKeyImp*)this_ptr)->generateSignatures(
+        r,
+        r_size,
+        s,
+        s_size,
+        hash,
+        h_size,
+        count);
+}
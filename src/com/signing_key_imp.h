@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <exception>
+#include "lcfr/signing_key.h"
+#include "lcfr/i_signing_key.h"
+
+namespace lcfr {
+
+struct EcSigningKeyImp : public IEcSigningKey
+{
+    static thread_local std::string exceptionMessage_;
+    std::unique_ptr<EcSigningKey> object_;
+
+    EcSigningKeyImp();
+    EcSigningKeyImp(std::unique_ptr<EcSigningKey>&& obj);
+
+    virtual uint32_t STDCALL release();
+
+    void* STDCALL getObject();
+
+    virtual uint32_t STDCALL init(
+        IEcCipher* cipher,
+        const uint8_t* sk,
+        uint32_t sk_size);
+
+    virtual uint32_t STDCALL generateNonce(
+        uint8_t* k,
+        uint32_t k_size,
+        const uint8_t* hash,
+        uint32_t h_size);
+
+    virtual uint32_t STDCALL generateSignature(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size);
+
+    virtual uint32_t STDCALL signMessage(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* m,
+        uint32_t m_size);
+
+    virtual uint32_t STDCALL generateSignatures(
+        uint8_t* r,
+        uint32_t r_size,
+        uint8_t* s,
+        uint32_t s_size,
+        const uint8_t* hash,
+        uint32_t h_size,
+        uint32_t count);
+};
+
+}
@@ -0,0 +1,179 @@
+#include "com/stats_imp.h"
+
+namespace lcfr {
+
+thread_local std::string StatsImp::exceptionMessage_;
+
+static_assert(Stats::COUNTER_COUNT == LCFR_STATS_COUNTER_COUNT && Stats::CURVE_COUNT == LCFR_STATS_CURVE_COUNT,
+    "snapshot layout mismatch");
+static_assert(stats::FP_MULT == LCFR_STATS_FP_MULT && stats::VERIFY == LCFR_STATS_VERIFY,
+    "counter index mismatch");
+static_assert(Stats::OPERATION_COUNT == LCFR_STATS_OPERATION_COUNT && Stats::STAGE_COUNT == LCFR_STATS_STAGE_COUNT,
+    "latency layout mismatch");
+
+uint32_t StatsImp::isEnabled(
+    uint32_t* _result)
+{
+    try
+    {
+        *_result = Stats::isEnabled() ? 1 : 0;
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t StatsImp::snapshot(
+    uint64_t* counters,
+    uint32_t counters_size,
+    uint32_t* _result)
+{
+    try
+    {
+        *_result = Stats::snapshot(
+            counters,
+            counters_size);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t StatsImp::reset()
+{
+    try
+    {
+        Stats::reset();
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t StatsImp::enableLatency(
+    uint32_t enabled)
+{
+    try
+    {
+        Stats::enableLatency(
+            enabled != 0);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t StatsImp::getLatency(
+    uint32_t curve,
+    uint32_t operation,
+    uint32_t stage,
+    const double* quantiles,
+    double* values,
+    uint32_t count,
+    uint64_t* _result)
+{
+    try
+    {
+        *_result = Stats::getLatency(
+            curve,
+            operation,
+            stage,
+            quantiles,
+            values,
+            count);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+uint32_t StatsImp::getCurveName(
+    uint32_t curve,
+    char const ** _result)
+{
+    try
+    {
+        *_result = Stats::getCurveName(
+            curve);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        exceptionMessage_ = e.what();
+        return -1;
+    }
+}
+
+}
+extern "C" LCFR_API uint32_t lcfr_Stats_getExceptionMessage(char const ** _result)
+{
+    *_result = lcfr::StatsImp::exceptionMessage_.c_str();
+    return 0;
+}
+extern "C" LCFR_API uint32_t lcfr_Stats_isEnabled(
+    uint32_t* _result)
+{
+    return lcfr::StatsImp::isEnabled(
+        _result);
+}
+extern "C" LCFR_API uint32_t lcfr_Stats_snapshot(
+    uint64_t* counters,
+    uint32_t counters_size,
+    uint32_t* _result)
+{
+    return lcfr::StatsImp::snapshot(
+        counters,
+        counters_size,
+        _result);
+}
+extern "C" LCFR_API uint32_t lcfr_Stats_reset()
+{
+    return lcfr::StatsImp::reset();
+}
+extern "C" LCFR_API uint32_t lcfr_Stats_enableLatency(
+    uint32_t enabled)
+{
+    return lcfr::StatsImp::enableLatency(
+        enabled);
+}
+extern "C" LCFR_API uint32_t lcfr_Stats_getLatency(
+    uint32_t curve,
+    uint32_t operation,
+    uint32_t stage,
+    const double* quantiles,
+    double* values,
+    uint32_t count,
+    uint64_t* _result)
+{
+    return lcfr::StatsImp::getLatency(
+        curve,
+        operation,
+        stage,
+        quantiles,
+        values,
+        count,
+        _result);
+}
+extern "C" LCFR_API uint32_t lcfr_Stats_getCurveName(
+    uint32_t curve,
+    char const ** _result)
+{
+    return lcfr::StatsImp::getCurveName(
+        curve,
+        _result);
+}
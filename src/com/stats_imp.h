@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <exception>
+#include "lcfr/i_stats.h"
+#include "lcfr/stats.h"
+
+namespace lcfr {
+
+struct StatsImp
+{
+    static thread_local std::string exceptionMessage_;
+    
+    static uint32_t isEnabled(
+        uint32_t* _result);
+    
+    static uint32_t snapshot(
+        uint64_t* counters,
+        uint32_t counters_size,
+        uint32_t* _result);
+    
+    static uint32_t reset();
+    
+    static uint32_t enableLatency(
+        uint32_t enabled);
+    
+    static uint32_t getLatency(
+        uint32_t curve,
+        uint32_t operation,
+        uint32_t stage,
+        const double* quantiles,
+        double* values,
+        uint32_t count,
+        uint64_t* _result);
+    
+    static uint32_t getCurveName(
+        uint32_t curve,
+        char const ** _result);
+};
+
+}
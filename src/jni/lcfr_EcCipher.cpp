@@ -1,7 +1,11 @@
 #include <jni.h>
 #include <memory>
 #include <exception>
+#include <vector>
 #include "lcfr/cipher.h"
+#include "jni/lcfr_jni.h"
+
+using lcfr::jni::cached_ids;
 
 extern "C" {
 
@@ -16,11 +20,11 @@ JNIEXPORT void JNICALL Java_lcfr_EcCipher_init__Ljava_lang_String_2(
         std::unique_ptr<const char[], decltype(_curve_deleter)> _curve(env->GetStringUTFChars(curve, nullptr), _curve_deleter);
         lcfr::EcCipher* cpp_this = new lcfr::EcCipher(
             _curve.get());
-        env->SetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"), (jlong)cpp_this);
+        env->SetLongField(obj, cached_ids.ecCipherThis, (jlong)cpp_this);
     }
     catch(const std::exception& e)
     {
-        env->ThrowNew(env->FindClass("java/lang/Exception"), e.what());
+        lcfr::jni::throw_exception(env, e);
     }
 }
 
@@ -30,14 +34,13 @@ JNIEXPORT jint JNICALL Java_lcfr_EcCipher_getPrimeBitLength__(
 {
     try
     {
-        lcfr::EcCipher* cpp_this = (lcfr::EcCipher*)
-            env->GetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"));
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
         auto _result = cpp_this->getPrimeBitLength();
         return _result;
     }
     catch(const std::exception& e)
     {
-        env->ThrowNew(env->FindClass("java/lang/Exception"), e.what());
+        lcfr::jni::throw_exception(env, e);
     }
     return jint(); // to suppress warning
 }
@@ -48,14 +51,13 @@ JNIEXPORT jint JNICALL Java_lcfr_EcCipher_getPrimeByteLength__(
 {
     try
     {
-        lcfr::EcCipher* cpp_this = (lcfr::EcCipher*)
-            env->GetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"));
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
         auto _result = cpp_this->getPrimeByteLength();
         return _result;
     }
     catch(const std::exception& e)
     {
-        env->ThrowNew(env->FindClass("java/lang/Exception"), e.what());
+        lcfr::jni::throw_exception(env, e);
     }
     return jint(); // to suppress warning
 }
@@ -67,17 +69,15 @@ JNIEXPORT void JNICALL Java_lcfr_EcCipher_getPrime___3B(
 {
     try
     {
-        auto _p_deleter = [&env, &p](uint8_t* _ptr){ env->ReleaseByteArrayElements(p, (jbyte*)_ptr, 0); };
-        std::unique_ptr<uint8_t[], decltype(_p_deleter)> _p((uint8_t*)env->GetByteArrayElements(p, nullptr), _p_deleter);
-        lcfr::EcCipher* cpp_this = (lcfr::EcCipher*)
-            env->GetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"));
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::critical_bytes _p(env, p, 0);
         cpp_this->getPrime(
             _p.get(),
-            (uint32_t)env->GetArrayLength(p));
+            _p.size());
     }
     catch(const std::exception& e)
     {
-        env->ThrowNew(env->FindClass("java/lang/Exception"), e.what());
+        lcfr::jni::throw_exception(env, e);
     }
 }
 
@@ -87,14 +87,13 @@ JNIEXPORT jint JNICALL Java_lcfr_EcCipher_getCurvePointCoordinateBitLength__(
 {
     try
     {
-        lcfr::EcCipher* cpp_this = (lcfr::EcCipher*)
-            env->GetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"));
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
         auto _result = cpp_this->getCurvePointCoordinateBitLength();
         return _result;
     }
     catch(const std::exception& e)
     {
-        env->ThrowNew(env->FindClass("java/lang/Exception"), e.what());
+        lcfr::jni::throw_exception(env, e);
     }
     return jint(); // to suppress warning
 }
@@ -105,14 +104,13 @@ JNIEXPORT jint JNICALL Java_lcfr_EcCipher_getCurvePointCoordinateByteLength__(
 {
     try
     {
-        lcfr::EcCipher* cpp_this = (lcfr::EcCipher*)
-            env->GetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"));
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
         auto _result = cpp_this->getCurvePointCoordinateByteLength();
         return _result;
     }
     catch(const std::exception& e)
     {
-        env->ThrowNew(env->FindClass("java/lang/Exception"), e.what());
+        lcfr::jni::throw_exception(env, e);
     }
     return jint(); // to suppress warning
 }
@@ -126,25 +124,21 @@ JNIEXPORT void JNICALL Java_lcfr_EcCipher_generatePublicKey___3B_3B_3B(
 {
     try
     {
-        auto _qx_deleter = [&env, &qx](uint8_t* _ptr){ env->ReleaseByteArrayElements(qx, (jbyte*)_ptr, 0); };
-        std::unique_ptr<uint8_t[], decltype(_qx_deleter)> _qx((uint8_t*)env->GetByteArrayElements(qx, nullptr), _qx_deleter);
-        auto _qy_deleter = [&env, &qy](uint8_t* _ptr){ env->ReleaseByteArrayElements(qy, (jbyte*)_ptr, 0); };
-        std::unique_ptr<uint8_t[], decltype(_qy_deleter)> _qy((uint8_t*)env->GetByteArrayElements(qy, nullptr), _qy_deleter);
-        auto _sk_deleter = [&env, &sk](uint8_t* _ptr){ env->ReleaseByteArrayElements(sk, (jbyte*)_ptr, JNI_ABORT); };
-        std::unique_ptr<uint8_t[], decltype(_sk_deleter)> _sk((uint8_t*)env->GetByteArrayElements(sk, nullptr), _sk_deleter);
-        lcfr::EcCipher* cpp_this = (lcfr::EcCipher*)
-            env->GetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"));
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::region_bytes _qx(env, qx, 0);
+        lcfr::jni::region_bytes _qy(env, qy, 0);
+        lcfr::jni::region_bytes _sk(env, sk, JNI_ABORT);
         cpp_this->generatePublicKey(
             _qx.get(),
-            (uint32_t)env->GetArrayLength(qx),
+            _qx.size(),
             _qy.get(),
-            (uint32_t)env->GetArrayLength(qy),
+            _qy.size(),
             _sk.get(),
-            (uint32_t)env->GetArrayLength(sk));
+            _sk.size());
     }
     catch(const std::exception& e)
     {
-        env->ThrowNew(env->FindClass("java/lang/Exception"), e.what());
+        lcfr::jni::throw_exception(env, e);
     }
 }
 
@@ -159,33 +153,58 @@ JNIEXPORT void JNICALL Java_lcfr_EcCipher_generateSignature___3B_3B_3B_3B_3B(
 {
     try
     {
-        auto _r_deleter = [&env, &r](uint8_t* _ptr){ env->ReleaseByteArrayElements(r, (jbyte*)_ptr, 0); };
-        std::unique_ptr<uint8_t[], decltype(_r_deleter)> _r((uint8_t*)env->GetByteArrayElements(r, nullptr), _r_deleter);
-        auto _s_deleter = [&env, &s](uint8_t* _ptr){ env->ReleaseByteArrayElements(s, (jbyte*)_ptr, 0); };
-        std::unique_ptr<uint8_t[], decltype(_s_deleter)> _s((uint8_t*)env->GetByteArrayElements(s, nullptr), _s_deleter);
-        auto _hash_deleter = [&env, &hash](uint8_t* _ptr){ env->ReleaseByteArrayElements(hash, (jbyte*)_ptr, JNI_ABORT); };
-        std::unique_ptr<uint8_t[], decltype(_hash_deleter)> _hash((uint8_t*)env->GetByteArrayElements(hash, nullptr), _hash_deleter);
-        auto _ek_deleter = [&env, &ek](uint8_t* _ptr){ env->ReleaseByteArrayElements(ek, (jbyte*)_ptr, JNI_ABORT); };
-        std::unique_ptr<uint8_t[], decltype(_ek_deleter)> _ek((uint8_t*)env->GetByteArrayElements(ek, nullptr), _ek_deleter);
-        auto _sk_deleter = [&env, &sk](uint8_t* _ptr){ env->ReleaseByteArrayElements(sk, (jbyte*)_ptr, JNI_ABORT); };
-        std::unique_ptr<uint8_t[], decltype(_sk_deleter)> _sk((uint8_t*)env->GetByteArrayElements(sk, nullptr), _sk_deleter);
-        lcfr::EcCipher* cpp_this = (lcfr::EcCipher*)
-            env->GetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"));
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::region_bytes _r(env, r, 0);
+        lcfr::jni::region_bytes _s(env, s, 0);
+        lcfr::jni::region_bytes _hash(env, hash, JNI_ABORT);
+        lcfr::jni::region_bytes _ek(env, ek, JNI_ABORT);
+        lcfr::jni::region_bytes _sk(env, sk, JNI_ABORT);
         cpp_this->generateSignature(
             _r.get(),
-            (uint32_t)env->GetArrayLength(r),
+            _r.size(),
             _s.get(),
-            (uint32_t)env->GetArrayLength(s),
+            _s.size(),
             _hash.get(),
-            (uint32_t)env->GetArrayLength(hash),
+            _hash.size(),
             _ek.get(),
-            (uint32_t)env->GetArrayLength(ek),
+            _ek.size(),
+            _sk.get(),
+            _sk.size());
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_generateSignatureRandom___3B_3B_3B_3B(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray hash,
+    jbyteArray sk)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::region_bytes _r(env, r, 0);
+        lcfr::jni::region_bytes _s(env, s, 0);
+        lcfr::jni::region_bytes _hash(env, hash, JNI_ABORT);
+        lcfr::jni::region_bytes _sk(env, sk, JNI_ABORT);
+        cpp_this->generateSignatureRandom(
+            _r.get(),
+            _r.size(),
+            _s.get(),
+            _s.size(),
+            _hash.get(),
+            _hash.size(),
             _sk.get(),
-            (uint32_t)env->GetArrayLength(sk));
+            _sk.size());
     }
     catch(const std::exception& e)
     {
-        env->ThrowNew(env->FindClass("java/lang/Exception"), e.what());
+        lcfr::jni::throw_exception(env, e);
     }
 }
 
@@ -200,54 +219,1129 @@ JNIEXPORT jint JNICALL Java_lcfr_EcCipher_verifySignature___3B_3B_3B_3B_3B(
 {
     try
     {
-        auto _r_deleter = [&env, &r](uint8_t* _ptr){ env->ReleaseByteArrayElements(r, (jbyte*)_ptr, JNI_ABORT); };
-        std::unique_ptr<uint8_t[], decltype(_r_deleter)> _r((uint8_t*)env->GetByteArrayElements(r, nullptr), _r_deleter);
-        auto _s_deleter = [&env, &s](uint8_t* _ptr){ env->ReleaseByteArrayElements(s, (jbyte*)_ptr, JNI_ABORT); };
-        std::unique_ptr<uint8_t[], decltype(_s_deleter)> _s((uint8_t*)env->GetByteArrayElements(s, nullptr), _s_deleter);
-        auto _hash_deleter = [&env, &hash](uint8_t* _ptr){ env->ReleaseByteArrayElements(hash, (jbyte*)_ptr, JNI_ABORT); };
-        std::unique_ptr<uint8_t[], decltype(_hash_deleter)> _hash((uint8_t*)env->GetByteArrayElements(hash, nullptr), _hash_deleter);
-        auto _qx_deleter = [&env, &qx](uint8_t* _ptr){ env->ReleaseByteArrayElements(qx, (jbyte*)_ptr, JNI_ABORT); };
-        std::unique_ptr<uint8_t[], decltype(_qx_deleter)> _qx((uint8_t*)env->GetByteArrayElements(qx, nullptr), _qx_deleter);
-        auto _qy_deleter = [&env, &qy](uint8_t* _ptr){ env->ReleaseByteArrayElements(qy, (jbyte*)_ptr, JNI_ABORT); };
-        std::unique_ptr<uint8_t[], decltype(_qy_deleter)> _qy((uint8_t*)env->GetByteArrayElements(qy, nullptr), _qy_deleter);
-        lcfr::EcCipher* cpp_this = (lcfr::EcCipher*)
-            env->GetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"));
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::region_bytes _r(env, r, JNI_ABORT);
+        lcfr::jni::region_bytes _s(env, s, JNI_ABORT);
+        lcfr::jni::region_bytes _hash(env, hash, JNI_ABORT);
+        lcfr::jni::region_bytes _qx(env, qx, JNI_ABORT);
+        lcfr::jni::region_bytes _qy(env, qy, JNI_ABORT);
+        auto _result = cpp_this->verifySignature(
+            _r.get(),
+            _r.size(),
+            _s.get(),
+            _s.size(),
+            _hash.get(),
+            _hash.size(),
+            _qx.get(),
+            _qx.size(),
+            _qy.get(),
+            _qy.size());
+        return _result;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jint(); // to suppress warning
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_signMessage___3B_3B_3B_3B_3B(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray message,
+    jbyteArray ek,
+    jbyteArray sk)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::region_bytes _r(env, r, 0);
+        lcfr::jni::region_bytes _s(env, s, 0);
+        lcfr::jni::region_bytes _message(env, message, JNI_ABORT);
+        lcfr::jni::region_bytes _ek(env, ek, JNI_ABORT);
+        lcfr::jni::region_bytes _sk(env, sk, JNI_ABORT);
+        cpp_this->signMessage(
+            _r.get(),
+            _r.size(),
+            _s.get(),
+            _s.size(),
+            _message.get(),
+            _message.size(),
+            _ek.get(),
+            _ek.size(),
+            _sk.get(),
+            _sk.size());
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT jint JNICALL Java_lcfr_EcCipher_verifyMessage___3B_3B_3B_3B_3B(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray message,
+    jbyteArray qx,
+    jbyteArray qy)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::region_bytes _r(env, r, JNI_ABORT);
+        lcfr::jni::region_bytes _s(env, s, JNI_ABORT);
+        lcfr::jni::region_bytes _message(env, message, JNI_ABORT);
+        lcfr::jni::region_bytes _qx(env, qx, JNI_ABORT);
+        lcfr::jni::region_bytes _qy(env, qy, JNI_ABORT);
+        auto _result = cpp_this->verifyMessage(
+            _r.get(),
+            _r.size(),
+            _s.get(),
+            _s.size(),
+            _message.get(),
+            _message.size(),
+            _qx.get(),
+            _qx.size(),
+            _qy.get(),
+            _qy.size());
+        return _result;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jint(); // to suppress warning
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_getPrimeDirect__Ljava_nio_ByteBuffer_2II(
+    JNIEnv *env,
+    jobject obj,
+    jobject p,
+    jint p_offset,
+    jint p_size)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        cpp_this->getPrime(
+            lcfr::jni::direct_address(env, p, p_offset),
+            (uint32_t)p_size);
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_generatePublicKeyDirect__Ljava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2II(
+    JNIEnv *env,
+    jobject obj,
+    jobject qx,
+    jint qx_offset,
+    jint qx_size,
+    jobject qy,
+    jint qy_offset,
+    jint qy_size,
+    jobject sk,
+    jint sk_offset,
+    jint sk_size)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        cpp_this->generatePublicKey(
+            lcfr::jni::direct_address(env, qx, qx_offset),
+            (uint32_t)qx_size,
+            lcfr::jni::direct_address(env, qy, qy_offset),
+            (uint32_t)qy_size,
+            lcfr::jni::direct_address(env, sk, sk_offset),
+            (uint32_t)sk_size);
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_generateSignatureDirect__Ljava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2II(
+    JNIEnv *env,
+    jobject obj,
+    jobject r,
+    jint r_offset,
+    jint r_size,
+    jobject s,
+    jint s_offset,
+    jint s_size,
+    jobject hash,
+    jint hash_offset,
+    jint hash_size,
+    jobject ek,
+    jint ek_offset,
+    jint ek_size,
+    jobject sk,
+    jint sk_offset,
+    jint sk_size)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        cpp_this->generateSignature(
+            lcfr::jni::direct_address(env, r, r_offset),
+            (uint32_t)r_size,
+            lcfr::jni::direct_address(env, s, s_offset),
+            (uint32_t)s_size,
+            lcfr::jni::direct_address(env, hash, hash_offset),
+            (uint32_t)hash_size,
+            lcfr::jni::direct_address(env, ek, ek_offset),
+            (uint32_t)ek_size,
+            lcfr::jni::direct_address(env, sk, sk_offset),
+            (uint32_t)sk_size);
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT jint JNICALL Java_lcfr_EcCipher_verifySignatureDirect__Ljava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2II(
+    JNIEnv *env,
+    jobject obj,
+    jobject r,
+    jint r_offset,
+    jint r_size,
+    jobject s,
+    jint s_offset,
+    jint s_size,
+    jobject hash,
+    jint hash_offset,
+    jint hash_size,
+    jobject qx,
+    jint qx_offset,
+    jint qx_size,
+    jobject qy,
+    jint qy_offset,
+    jint qy_size)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
         auto _result = cpp_this->verifySignature(
+            lcfr::jni::direct_address(env, r, r_offset),
+            (uint32_t)r_size,
+            lcfr::jni::direct_address(env, s, s_offset),
+            (uint32_t)s_size,
+            lcfr::jni::direct_address(env, hash, hash_offset),
+            (uint32_t)hash_size,
+            lcfr::jni::direct_address(env, qx, qx_offset),
+            (uint32_t)qx_size,
+            lcfr::jni::direct_address(env, qy, qy_offset),
+            (uint32_t)qy_size);
+        return _result;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jint(); // to suppress warning
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_generateSignatures___3B_3B_3B_3B_3BI(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray hash,
+    jbyteArray ek,
+    jbyteArray sk,
+    jint count)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::array_bytes _r(env, r, 0);
+        lcfr::jni::array_bytes _s(env, s, 0);
+        lcfr::jni::array_bytes _hash(env, hash, JNI_ABORT);
+        lcfr::jni::array_bytes _ek(env, ek, JNI_ABORT);
+        lcfr::jni::array_bytes _sk(env, sk, JNI_ABORT);
+        cpp_this->generateSignatures(
+            _r.get(),
+            lcfr::jni::element_size(_r.size(), count),
+            _s.get(),
+            lcfr::jni::element_size(_s.size(), count),
+            _hash.get(),
+            lcfr::jni::element_size(_hash.size(), count),
+            _ek.get(),
+            lcfr::jni::element_size(_ek.size(), count),
+            _sk.get(),
+            lcfr::jni::element_size(_sk.size(), count),
+            (uint32_t)count);
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_verifySignatures___3I_3B_3B_3B_3B_3BI(
+    JNIEnv *env,
+    jobject obj,
+    jintArray results,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray hash,
+    jbyteArray qx,
+    jbyteArray qy,
+    jint count)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        if (env->GetArrayLength(results) < count) throw std::runtime_error("results array too short");
+        std::vector<int32_t> _results(count > 0 ? count : 0);
+        lcfr::jni::array_bytes _r(env, r, JNI_ABORT);
+        lcfr::jni::array_bytes _s(env, s, JNI_ABORT);
+        lcfr::jni::array_bytes _hash(env, hash, JNI_ABORT);
+        lcfr::jni::array_bytes _qx(env, qx, JNI_ABORT);
+        lcfr::jni::array_bytes _qy(env, qy, JNI_ABORT);
+        cpp_this->verifySignatures(
+            _results.data(),
             _r.get(),
-            (uint32_t)env->GetArrayLength(r),
+            lcfr::jni::element_size(_r.size(), count),
             _s.get(),
-            (uint32_t)env->GetArrayLength(s),
+            lcfr::jni::element_size(_s.size(), count),
             _hash.get(),
-            (uint32_t)env->GetArrayLength(hash),
+            lcfr::jni::element_size(_hash.size(), count),
+            _qx.get(),
+            lcfr::jni::element_size(_qx.size(), count),
+            _qy.get(),
+            lcfr::jni::element_size(_qy.size(), count),
+            (uint32_t)count);
+        env->SetIntArrayRegion(results, 0, count, (const jint*)_results.data());
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_signMessages___3B_3B_3B_3I_3B_3BI(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray messages,
+    jintArray message_sizes,
+    jbyteArray ek,
+    jbyteArray sk,
+    jint count)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::array_bytes _r(env, r, 0);
+        lcfr::jni::array_bytes _s(env, s, 0);
+        lcfr::jni::array_bytes _messages(env, messages, JNI_ABORT);
+        std::vector<uint32_t> _message_sizes = lcfr::jni::message_sizes(env, message_sizes, _messages.size(), count);
+        lcfr::jni::array_bytes _ek(env, ek, JNI_ABORT);
+        lcfr::jni::array_bytes _sk(env, sk, JNI_ABORT);
+        cpp_this->signMessages(
+            _r.get(),
+            lcfr::jni::element_size(_r.size(), count),
+            _s.get(),
+            lcfr::jni::element_size(_s.size(), count),
+            _messages.get(),
+            _message_sizes.data(),
+            _ek.get(),
+            lcfr::jni::element_size(_ek.size(), count),
+            _sk.get(),
+            lcfr::jni::element_size(_sk.size(), count),
+            (uint32_t)count);
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_verifyMessages___3I_3B_3B_3B_3I_3B_3BI(
+    JNIEnv *env,
+    jobject obj,
+    jintArray results,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray messages,
+    jintArray message_sizes,
+    jbyteArray qx,
+    jbyteArray qy,
+    jint count)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        if (env->GetArrayLength(results) < count) throw std::runtime_error("results array too short");
+        std::vector<int32_t> _results(count > 0 ? count : 0);
+        lcfr::jni::array_bytes _r(env, r, JNI_ABORT);
+        lcfr::jni::array_bytes _s(env, s, JNI_ABORT);
+        lcfr::jni::array_bytes _messages(env, messages, JNI_ABORT);
+        std::vector<uint32_t> _message_sizes = lcfr::jni::message_sizes(env, message_sizes, _messages.size(), count);
+        lcfr::jni::array_bytes _qx(env, qx, JNI_ABORT);
+        lcfr::jni::array_bytes _qy(env, qy, JNI_ABORT);
+        cpp_this->verifyMessages(
+            _results.data(),
+            _r.get(),
+            lcfr::jni::element_size(_r.size(), count),
+            _s.get(),
+            lcfr::jni::element_size(_s.size(), count),
+            _messages.get(),
+            _message_sizes.data(),
+            _qx.get(),
+            lcfr::jni::element_size(_qx.size(), count),
+            _qy.get(),
+            lcfr::jni::element_size(_qy.size(), count),
+            (uint32_t)count);
+        env->SetIntArrayRegion(results, 0, count, (const jint*)_results.data());
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT jint JNICALL Java_lcfr_EcCipher_encodePublicKey___3B_3B_3BZ(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray q,
+    jbyteArray qx,
+    jbyteArray qy,
+    jboolean compressed)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::critical_bytes _q(env, q, 0);
+        lcfr::jni::critical_bytes _qx(env, qx, JNI_ABORT);
+        lcfr::jni::critical_bytes _qy(env, qy, JNI_ABORT);
+        auto _result = cpp_this->encodePublicKey(
+            _q.get(),
+            _q.size(),
             _qx.get(),
-            (uint32_t)env->GetArrayLength(qx),
+            _qx.size(),
             _qy.get(),
-            (uint32_t)env->GetArrayLength(qy));
+            _qy.size(),
+            compressed != JNI_FALSE);
         return _result;
     }
     catch(const std::exception& e)
     {
-        env->ThrowNew(env->FindClass("java/lang/Exception"), e.what());
+        lcfr::jni::throw_exception(env, e);
     }
     return jint(); // to suppress warning
 }
 
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_decodePublicKey___3B_3B_3B(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray qx,
+    jbyteArray qy,
+    jbyteArray q)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::region_bytes _qx(env, qx, 0);
+        lcfr::jni::region_bytes _qy(env, qy, 0);
+        lcfr::jni::region_bytes _q(env, q, JNI_ABORT);
+        cpp_this->decodePublicKey(
+            _qx.get(),
+            _qx.size(),
+            _qy.get(),
+            _qy.size(),
+            _q.get(),
+            _q.size());
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_decodePublicKeys___3I_3B_3B_3BI(
+    JNIEnv *env,
+    jobject obj,
+    jintArray results,
+    jbyteArray qx,
+    jbyteArray qy,
+    jbyteArray q,
+    jint count)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        if (env->GetArrayLength(results) < count) throw std::runtime_error("results array too short");
+        std::vector<int32_t> _results(count > 0 ? count : 0);
+        lcfr::jni::array_bytes _qx(env, qx, 0);
+        lcfr::jni::array_bytes _qy(env, qy, 0);
+        lcfr::jni::array_bytes _q(env, q, JNI_ABORT);
+        cpp_this->decodePublicKeys(
+            _results.data(),
+            _qx.get(),
+            lcfr::jni::element_size(_qx.size(), count),
+            _qy.get(),
+            lcfr::jni::element_size(_qy.size(), count),
+            _q.get(),
+            lcfr::jni::element_size(_q.size(), count),
+            (uint32_t)count);
+        env->SetIntArrayRegion(results, 0, count, (const jint*)_results.data());
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT jint JNICALL Java_lcfr_EcCipher_generateRecoverableSignature___3B_3B_3B_3B_3B(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray hash,
+    jbyteArray ek,
+    jbyteArray sk)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::region_bytes _r(env, r, 0);
+        lcfr::jni::region_bytes _s(env, s, 0);
+        lcfr::jni::region_bytes _hash(env, hash, JNI_ABORT);
+        lcfr::jni::region_bytes _ek(env, ek, JNI_ABORT);
+        lcfr::jni::region_bytes _sk(env, sk, JNI_ABORT);
+        auto _result = cpp_this->generateRecoverableSignature(
+            _r.get(),
+            _r.size(),
+            _s.get(),
+            _s.size(),
+            _hash.get(),
+            _hash.size(),
+            _ek.get(),
+            _ek.size(),
+            _sk.get(),
+            _sk.size());
+        return _result;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jint(); // to suppress warning
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_recoverPublicKey___3B_3B_3B_3B_3BI(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray qx,
+    jbyteArray qy,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray hash,
+    jint v)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::region_bytes _qx(env, qx, 0);
+        lcfr::jni::region_bytes _qy(env, qy, 0);
+        lcfr::jni::region_bytes _r(env, r, JNI_ABORT);
+        lcfr::jni::region_bytes _s(env, s, JNI_ABORT);
+        lcfr::jni::region_bytes _hash(env, hash, JNI_ABORT);
+        cpp_this->recoverPublicKey(
+            _qx.get(),
+            _qx.size(),
+            _qy.get(),
+            _qy.size(),
+            _r.get(),
+            _r.size(),
+            _s.get(),
+            _s.size(),
+            _hash.get(),
+            _hash.size(),
+            (uint32_t)v);
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT jint JNICALL Java_lcfr_EcCipher_encodeSignatureDer___3B_3B_3B(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray der,
+    jbyteArray r,
+    jbyteArray s)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::critical_bytes _der(env, der, 0);
+        lcfr::jni::critical_bytes _r(env, r, JNI_ABORT);
+        lcfr::jni::critical_bytes _s(env, s, JNI_ABORT);
+        auto _result = cpp_this->encodeSignatureDer(
+            _der.get(),
+            _der.size(),
+            _r.get(),
+            _r.size(),
+            _s.get(),
+            _s.size());
+        return _result;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jint(); // to suppress warning
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_decodeSignatureDer___3B_3B_3B(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray der)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::critical_bytes _r(env, r, 0);
+        lcfr::jni::critical_bytes _s(env, s, 0);
+        lcfr::jni::critical_bytes _der(env, der, JNI_ABORT);
+        cpp_this->decodeSignatureDer(
+            _r.get(),
+            _r.size(),
+            _s.get(),
+            _s.size(),
+            _der.get(),
+            _der.size());
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT jint JNICALL Java_lcfr_EcCipher_encodeSignatureCompact___3B_3B_3B(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray c,
+    jbyteArray r,
+    jbyteArray s)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::critical_bytes _c(env, c, 0);
+        lcfr::jni::critical_bytes _r(env, r, JNI_ABORT);
+        lcfr::jni::critical_bytes _s(env, s, JNI_ABORT);
+        auto _result = cpp_this->encodeSignatureCompact(
+            _c.get(),
+            _c.size(),
+            _r.get(),
+            _r.size(),
+            _s.get(),
+            _s.size());
+        return _result;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jint(); // to suppress warning
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_decodeSignatureCompact___3B_3B_3B(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray c)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::critical_bytes _r(env, r, 0);
+        lcfr::jni::critical_bytes _s(env, s, 0);
+        lcfr::jni::critical_bytes _c(env, c, JNI_ABORT);
+        cpp_this->decodeSignatureCompact(
+            _r.get(),
+            _r.size(),
+            _s.get(),
+            _s.size(),
+            _c.get(),
+            _c.size());
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT jint JNICALL Java_lcfr_EcCipher_encodeSignaturesDer___3I_3B_3B_3BI(
+    JNIEnv *env,
+    jobject obj,
+    jintArray der_sizes,
+    jbyteArray der,
+    jbyteArray r,
+    jbyteArray s,
+    jint count)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        if (env->GetArrayLength(der_sizes) < count) throw std::runtime_error("der sizes array too short");
+        std::vector<uint32_t> _der_sizes(count > 0 ? count : 0);
+        lcfr::jni::array_bytes _der(env, der, 0);
+        lcfr::jni::array_bytes _r(env, r, JNI_ABORT);
+        lcfr::jni::array_bytes _s(env, s, JNI_ABORT);
+        auto _result = cpp_this->encodeSignaturesDer(
+            _der_sizes.data(),
+            _der.get(),
+            _der.size(),
+            _r.get(),
+            lcfr::jni::element_size(_r.size(), count),
+            _s.get(),
+            lcfr::jni::element_size(_s.size(), count),
+            (uint32_t)count);
+        env->SetIntArrayRegion(der_sizes, 0, count, (const jint*)_der_sizes.data());
+        return _result;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jint(); // to suppress warning
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_decodeSignaturesDer___3I_3B_3B_3B_3II(
+    JNIEnv *env,
+    jobject obj,
+    jintArray results,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray der,
+    jintArray der_sizes,
+    jint count)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        if (env->GetArrayLength(results) < count) throw std::runtime_error("results array too short");
+        std::vector<int32_t> _results(count > 0 ? count : 0);
+        lcfr::jni::array_bytes _r(env, r, 0);
+        lcfr::jni::array_bytes _s(env, s, 0);
+        lcfr::jni::array_bytes _der(env, der, JNI_ABORT);
+        std::vector<uint32_t> _der_sizes = lcfr::jni::message_sizes(env, der_sizes, _der.size(), count);
+        cpp_this->decodeSignaturesDer(
+            _results.data(),
+            _r.get(),
+            lcfr::jni::element_size(_r.size(), count),
+            _s.get(),
+            lcfr::jni::element_size(_s.size(), count),
+            _der.get(),
+            _der_sizes.data(),
+            (uint32_t)count);
+        env->SetIntArrayRegion(results, 0, count, (const jint*)_results.data());
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_encodeSignaturesCompact___3B_3B_3BI(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray c,
+    jbyteArray r,
+    jbyteArray s,
+    jint count)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::array_bytes _c(env, c, 0);
+        lcfr::jni::array_bytes _r(env, r, JNI_ABORT);
+        lcfr::jni::array_bytes _s(env, s, JNI_ABORT);
+        cpp_this->encodeSignaturesCompact(
+            _c.get(),
+            lcfr::jni::element_size(_c.size(), count),
+            _r.get(),
+            lcfr::jni::element_size(_r.size(), count),
+            _s.get(),
+            lcfr::jni::element_size(_s.size(), count),
+            (uint32_t)count);
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_decodeSignaturesCompact___3B_3B_3BI(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray c,
+    jint count)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::array_bytes _r(env, r, 0);
+        lcfr::jni::array_bytes _s(env, s, 0);
+        lcfr::jni::array_bytes _c(env, c, JNI_ABORT);
+        cpp_this->decodeSignaturesCompact(
+            _r.get(),
+            lcfr::jni::element_size(_r.size(), count),
+            _s.get(),
+            lcfr::jni::element_size(_s.size(), count),
+            _c.get(),
+            lcfr::jni::element_size(_c.size(), count),
+            (uint32_t)count);
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_verifySignaturesDer___3I_3B_3I_3B_3B_3BI(
+    JNIEnv *env,
+    jobject obj,
+    jintArray results,
+    jbyteArray der,
+    jintArray der_sizes,
+    jbyteArray hash,
+    jbyteArray qx,
+    jbyteArray qy,
+    jint count)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        if (env->GetArrayLength(results) < count) throw std::runtime_error("results array too short");
+        std::vector<int32_t> _results(count > 0 ? count : 0);
+        lcfr::jni::array_bytes _der(env, der, JNI_ABORT);
+        std::vector<uint32_t> _der_sizes = lcfr::jni::message_sizes(env, der_sizes, _der.size(), count);
+        lcfr::jni::array_bytes _hash(env, hash, JNI_ABORT);
+        lcfr::jni::array_bytes _qx(env, qx, JNI_ABORT);
+        lcfr::jni::array_bytes _qy(env, qy, JNI_ABORT);
+        cpp_this->verifySignaturesDer(
+            _results.data(),
+            _der.get(),
+            _der_sizes.data(),
+            _hash.get(),
+            lcfr::jni::element_size(_hash.size(), count),
+            _qx.get(),
+            lcfr::jni::element_size(_qx.size(), count),
+            _qy.get(),
+            lcfr::jni::element_size(_qy.size(), count),
+            (uint32_t)count);
+        env->SetIntArrayRegion(results, 0, count, (const jint*)_results.data());
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT jint JNICALL Java_lcfr_EcCipher_generateCompressedSignature___3B_3B_3B(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray c,
+    jbyteArray hash,
+    jbyteArray sk)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::region_bytes _c(env, c, 0);
+        lcfr::jni::region_bytes _hash(env, hash, JNI_ABORT);
+        lcfr::jni::region_bytes _sk(env, sk, JNI_ABORT);
+        auto _result = cpp_this->generateCompressedSignature(
+            _c.get(),
+            _c.size(),
+            _hash.get(),
+            _hash.size(),
+            _sk.get(),
+            _sk.size());
+        return _result;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jint(); // to suppress warning
+}
+
+JNIEXPORT jint JNICALL Java_lcfr_EcCipher_encodeCompressedSignature___3B_3B_3BI(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray c,
+    jbyteArray r,
+    jbyteArray s,
+    jint v)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::critical_bytes _c(env, c, 0);
+        lcfr::jni::critical_bytes _r(env, r, JNI_ABORT);
+        lcfr::jni::critical_bytes _s(env, s, JNI_ABORT);
+        auto _result = cpp_this->encodeCompressedSignature(
+            _c.get(),
+            _c.size(),
+            _r.get(),
+            _r.size(),
+            _s.get(),
+            _s.size(),
+            (uint32_t)v);
+        return _result;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jint(); // to suppress warning
+}
+
+JNIEXPORT jint JNICALL Java_lcfr_EcCipher_decodeCompressedSignature___3B_3B_3B(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray r,
+    jbyteArray s,
+    jbyteArray c)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::critical_bytes _r(env, r, 0);
+        lcfr::jni::critical_bytes _s(env, s, 0);
+        lcfr::jni::critical_bytes _c(env, c, JNI_ABORT);
+        auto _result = cpp_this->decodeCompressedSignature(
+            _r.get(),
+            _r.size(),
+            _s.get(),
+            _s.size(),
+            _c.get(),
+            _c.size());
+        return _result;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jint(); // to suppress warning
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_encodeCompressedKey___3B_3B_3B(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray k,
+    jbyteArray qx,
+    jbyteArray qy)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::critical_bytes _k(env, k, 0);
+        lcfr::jni::critical_bytes _qx(env, qx, JNI_ABORT);
+        lcfr::jni::critical_bytes _qy(env, qy, JNI_ABORT);
+        cpp_this->encodeCompressedKey(
+            _k.get(),
+            _k.size(),
+            _qx.get(),
+            _qx.size(),
+            _qy.get(),
+            _qy.size());
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT jint JNICALL Java_lcfr_EcCipher_verifyCompressedSignature___3B_3B_3B(
+    JNIEnv *env,
+    jobject obj,
+    jbyteArray c,
+    jbyteArray hash,
+    jbyteArray k)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        lcfr::jni::region_bytes _c(env, c, JNI_ABORT);
+        lcfr::jni::region_bytes _hash(env, hash, JNI_ABORT);
+        lcfr::jni::region_bytes _k(env, k, JNI_ABORT);
+        auto _result = cpp_this->verifyCompressedSignature(
+            _c.get(),
+            _c.size(),
+            _hash.get(),
+            _hash.size(),
+            _k.get(),
+            _k.size());
+        return _result;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jint(); // to suppress warning
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_verifyCompressedSignatures___3I_3B_3B_3BI(
+    JNIEnv *env,
+    jobject obj,
+    jintArray results,
+    jbyteArray c,
+    jbyteArray hash,
+    jbyteArray k,
+    jint count)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        if (env->GetArrayLength(results) < count) throw std::runtime_error("results array too short");
+        std::vector<int32_t> _results(count > 0 ? count : 0);
+        lcfr::jni::array_bytes _c(env, c, JNI_ABORT);
+        lcfr::jni::array_bytes _hash(env, hash, JNI_ABORT);
+        lcfr::jni::array_bytes _k(env, k, JNI_ABORT);
+        cpp_this->verifyCompressedSignatures(
+            _results.data(),
+            _c.get(),
+            lcfr::jni::element_size(_c.size(), count),
+            _hash.get(),
+            lcfr::jni::element_size(_hash.size(), count),
+            _k.get(),
+            lcfr::jni::element_size(_k.size(), count),
+            (uint32_t)count);
+        env->SetIntArrayRegion(results, 0, count, (const jint*)_results.data());
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_generateSignaturesDirect__Ljava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2III(
+    JNIEnv *env,
+    jobject obj,
+    jobject r,
+    jint r_offset,
+    jint r_size,
+    jobject s,
+    jint s_offset,
+    jint s_size,
+    jobject hash,
+    jint hash_offset,
+    jint hash_size,
+    jobject ek,
+    jint ek_offset,
+    jint ek_size,
+    jobject sk,
+    jint sk_offset,
+    jint sk_size,
+    jint count)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        cpp_this->generateSignatures(
+            lcfr::jni::direct_address(env, r, r_offset),
+            lcfr::jni::element_size(r_size, count),
+            lcfr::jni::direct_address(env, s, s_offset),
+            lcfr::jni::element_size(s_size, count),
+            lcfr::jni::direct_address(env, hash, hash_offset),
+            lcfr::jni::element_size(hash_size, count),
+            lcfr::jni::direct_address(env, ek, ek_offset),
+            lcfr::jni::element_size(ek_size, count),
+            lcfr::jni::direct_address(env, sk, sk_offset),
+            lcfr::jni::element_size(sk_size, count),
+            (uint32_t)count);
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT void JNICALL Java_lcfr_EcCipher_verifySignaturesDirect__Ljava_nio_IntBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2IILjava_nio_ByteBuffer_2III(
+    JNIEnv *env,
+    jobject obj,
+    jobject results,
+    jint results_offset,
+    jint results_size,
+    jobject r,
+    jint r_offset,
+    jint r_size,
+    jobject s,
+    jint s_offset,
+    jint s_size,
+    jobject hash,
+    jint hash_offset,
+    jint hash_size,
+    jobject qx,
+    jint qx_offset,
+    jint qx_size,
+    jobject qy,
+    jint qy_offset,
+    jint qy_size,
+    jint count)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
+        if (results_size < count) throw std::runtime_error("results buffer too short");
+        cpp_this->verifySignatures(
+            (int32_t*)lcfr::jni::direct_address(env, results, results_offset * (jint)sizeof(jint)),
+            lcfr::jni::direct_address(env, r, r_offset),
+            lcfr::jni::element_size(r_size, count),
+            lcfr::jni::direct_address(env, s, s_offset),
+            lcfr::jni::element_size(s_size, count),
+            lcfr::jni::direct_address(env, hash, hash_offset),
+            lcfr::jni::element_size(hash_size, count),
+            lcfr::jni::direct_address(env, qx, qx_offset),
+            lcfr::jni::element_size(qx_size, count),
+            lcfr::jni::direct_address(env, qy, qy_offset),
+            lcfr::jni::element_size(qy_size, count),
+            (uint32_t)count);
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
 JNIEXPORT void JNICALL Java_lcfr_EcCipher_destroy__(
     JNIEnv *env,
     jobject obj)
 {
     try
     {
-        auto cpp_this = (lcfr::EcCipher*) 
-            env->GetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"));
+        auto cpp_this = lcfr::jni::get_this<lcfr::EcCipher>(env, obj, cached_ids.ecCipherThis);
         if (cpp_this) {
             delete(cpp_this);
-            env->SetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"), (jlong)nullptr);
+            env->SetLongField(obj, cached_ids.ecCipherThis, (jlong)nullptr);
         }
     }
     catch(const std::exception& e)
     {
-        env->ThrowNew(env->FindClass("java/lang/Exception"), e.what());
+        lcfr::jni::throw_exception(env, e);
     }
 }
 }
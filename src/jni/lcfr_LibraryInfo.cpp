@@ -2,6 +2,9 @@
 #include <memory>
 #include <exception>
 #include "lcfr/library_info.h"
+#include "jni/lcfr_jni.h"
+
+using lcfr::jni::cached_ids;
 
 extern "C" {
 
@@ -12,11 +15,11 @@ JNIEXPORT void JNICALL Java_lcfr_LibraryInfo_init__(
     try
     {
         lcfr::LibraryInfo* cpp_this = new lcfr::LibraryInfo();
-        env->SetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"), (jlong)cpp_this);
+        env->SetLongField(obj, cached_ids.libraryInfoThis, (jlong)cpp_this);
     }
     catch(const std::exception& e)
     {
-        env->ThrowNew(env->FindClass("java/lang/Exception"), e.what());
+        lcfr::jni::throw_exception(env, e);
     }
 }
 
@@ -26,14 +29,30 @@ JNIEXPORT jstring JNICALL Java_lcfr_LibraryInfo_getVersion__(
 {
     try
     {
-        lcfr::LibraryInfo* cpp_this = (lcfr::LibraryInfo*)
-            env->GetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"));
+        auto cpp_this = lcfr::jni::get_this<lcfr::LibraryInfo>(env, obj, cached_ids.libraryInfoThis);
         auto _result = cpp_this->getVersion();
         return env->NewStringUTF(_result);
     }
     catch(const std::exception& e)
     {
-        env->ThrowNew(env->FindClass("java/lang/Exception"), e.what());
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jstring(); // to suppress warning
+}
+
+JNIEXPORT jstring JNICALL Java_lcfr_LibraryInfo_getActiveKernels__(
+    JNIEnv *env,
+    jobject obj)
+{
+    try
+    {
+        auto cpp_this = lcfr::jni::get_this<lcfr::LibraryInfo>(env, obj, cached_ids.libraryInfoThis);
+        auto _result = cpp_this->getActiveKernels();
+        return env->NewStringUTF(_result);
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
     }
     return jstring(); // to suppress warning
 }
@@ -44,16 +63,15 @@ JNIEXPORT void JNICALL Java_lcfr_LibraryInfo_destroy__(
 {
     try
     {
-        auto cpp_this = (lcfr::LibraryInfo*) 
-            env->GetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"));
+        auto cpp_this = lcfr::jni::get_this<lcfr::LibraryInfo>(env, obj, cached_ids.libraryInfoThis);
         if (cpp_this) {
             delete(cpp_this);
-            env->SetLongField(obj, env->GetFieldID(env->GetObjectClass(obj), "cpp_this", "J"), (jlong)nullptr);
+            env->SetLongField(obj, cached_ids.libraryInfoThis, (jlong)nullptr);
         }
     }
     catch(const std::exception& e)
     {
-        env->ThrowNew(env->FindClass("java/lang/Exception"), e.what());
+        lcfr::jni::throw_exception(env, e);
     }
 }
 }
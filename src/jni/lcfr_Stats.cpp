@@ -0,0 +1,116 @@
+#include <jni.h>
+#include <exception>
+#include <vector>
+#include "lcfr/stats.h"
+#include "jni/lcfr_jni.h"
+
+extern "C" {
+
+JNIEXPORT jboolean JNICALL Java_lcfr_Stats_isEnabled__(
+    JNIEnv *env,
+    jclass)
+{
+    try
+    {
+        return lcfr::Stats::isEnabled() ? JNI_TRUE : JNI_FALSE;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return JNI_FALSE; // to suppress warning
+}
+
+JNIEXPORT jlongArray JNICALL Java_lcfr_Stats_snapshot__(
+    JNIEnv *env,
+    jclass)
+{
+    try
+    {
+        uint64_t counters[lcfr::Stats::CURVE_COUNT * lcfr::Stats::COUNTER_COUNT];
+        jsize size = (jsize)lcfr::Stats::snapshot(counters, lcfr::Stats::CURVE_COUNT * lcfr::Stats::COUNTER_COUNT);
+        jlongArray _result = env->NewLongArray(size);
+        if (_result) env->SetLongArrayRegion(_result, 0, size, reinterpret_cast<const jlong*>(counters));
+        return _result;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jlongArray(); // to suppress warning
+}
+
+JNIEXPORT void JNICALL Java_lcfr_Stats_reset__(
+    JNIEnv *env,
+    jclass)
+{
+    try
+    {
+        lcfr::Stats::reset();
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT void JNICALL Java_lcfr_Stats_enableLatency__Z(
+    JNIEnv *env,
+    jclass,
+    jboolean enabled)
+{
+    try
+    {
+        lcfr::Stats::enableLatency(enabled != JNI_FALSE);
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+}
+
+JNIEXPORT jlong JNICALL Java_lcfr_Stats_getLatency__III_3D_3D(
+    JNIEnv *env,
+    jclass,
+    jint curve,
+    jint operation,
+    jint stage,
+    jdoubleArray quantiles,
+    jdoubleArray values)
+{
+    try
+    {
+        jsize count = env->GetArrayLength(quantiles);
+        if (env->GetArrayLength(values) < count) throw std::runtime_error("values array too short");
+        std::vector<double> q(count), v(count);
+        env->GetDoubleArrayRegion(quantiles, 0, count, q.data());
+        auto _result = lcfr::Stats::getLatency(
+            (uint32_t)curve, (uint32_t)operation, (uint32_t)stage, q.data(), v.data(), (uint32_t)count);
+        env->SetDoubleArrayRegion(values, 0, count, v.data());
+        return (jlong)_result;
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jlong(); // to suppress warning
+}
+
+JNIEXPORT jstring JNICALL Java_lcfr_Stats_getCurveName__I(
+    JNIEnv *env,
+    jclass,
+    jint curve)
+{
+    try
+    {
+        auto _result = lcfr::Stats::getCurveName((uint32_t)curve);
+        return env->NewStringUTF(_result);
+    }
+    catch(const std::exception& e)
+    {
+        lcfr::jni::throw_exception(env, e);
+    }
+    return jstring(); // to suppress warning
+}
+
+}
@@ -0,0 +1,47 @@
+#include "jni/lcfr_jni.h"
+
+namespace lcfr {
+namespace jni {
+
+ids cached_ids;
+
+}
+}
+
+extern "C" {
+
+JNIEXPORT jint JNICALL JNI_OnLoad(
+    JavaVM* vm,
+    void*)
+{
+    JNIEnv* env;
+    if (vm->GetEnv((void**)&env, JNI_VERSION_1_6) != JNI_OK) return JNI_ERR;
+
+    jclass exception = env->FindClass("java/lang/Exception");
+    jclass ecCipher = env->FindClass("lcfr/EcCipher");
+    jclass libraryInfo = env->FindClass("lcfr/LibraryInfo");
+    if (!exception || !ecCipher || !libraryInfo) return JNI_ERR;
+
+    lcfr::jni::ids& ids = lcfr::jni::cached_ids;
+    ids.exception = (jclass)env->NewGlobalRef(exception);
+    ids.ecCipherThis = env->GetFieldID(ecCipher, "cpp_this", "J");
+    ids.libraryInfoThis = env->GetFieldID(libraryInfo, "cpp_this", "J");
+    if (!ids.exception || !ids.ecCipherThis || !ids.libraryInfoThis) return JNI_ERR;
+
+    env->DeleteLocalRef(exception);
+    env->DeleteLocalRef(ecCipher);
+    env->DeleteLocalRef(libraryInfo);
+    return JNI_VERSION_1_6;
+}
+
+JNIEXPORT void JNICALL JNI_OnUnload(
+    JavaVM* vm,
+    void*)
+{
+    JNIEnv* env;
+    if (vm->GetEnv((void**)&env, JNI_VERSION_1_6) != JNI_OK) return;
+    env->DeleteGlobalRef(lcfr::jni::cached_ids.exception);
+    lcfr::jni::cached_ids.exception = nullptr;
+}
+
+}
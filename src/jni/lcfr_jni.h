@@ -0,0 +1,219 @@
+#pragma once
+
+#include <jni.h>
+#include <stdint.h>
+#include <new>
+#include <stdexcept>
+#include <vector>
+#include "lcfr/crypto/random/chacha20_drbg.h"
+
+namespace lcfr {
+namespace jni {
+
+/** Class and field IDs resolved once by JNI_OnLoad, instead of looking them up at every call. */
+struct ids
+{
+    jclass   exception;                 // java.lang.Exception, global reference
+    jfieldID ecCipherThis;              // lcfr.EcCipher.cpp_this
+    jfieldID libraryInfoThis;           // lcfr.LibraryInfo.cpp_this
+};
+
+extern ids cached_ids;
+
+template <class T>
+T* get_this(JNIEnv* env, jobject obj, jfieldID id)
+{
+    return (T*)env->GetLongField(obj, id);
+}
+
+inline void throw_exception(JNIEnv* env, const std::exception& e)
+{
+    env->ThrowNew(cached_ids.exception, e.what());
+}
+
+/** A byte[] accessed through GetPrimitiveArrayCritical, so that the VM hands out the array itself,
+* for the calls taking a few microseconds at most, the getters and the encodings.
+* The length is read by the constructor and the array is pinned by the first get(), since no other
+* JNI call is allowed until it is released: every critical_bytes of a call is built before any get().
+* Read-only arrays use the JNI_ABORT mode, so that a copy, if the VM makes one, is not written back.
+*/
+class critical_bytes
+{
+    JNIEnv*    env_;
+    jbyteArray array_;
+    jint       mode_;
+    uint32_t   size_;
+    uint8_t*   data_;
+
+public:
+    critical_bytes(JNIEnv* env, jbyteArray array, jint mode)
+        : env_(env),
+          array_(array),
+          mode_(mode),
+          size_((uint32_t)env->GetArrayLength(array)),
+          data_(nullptr)
+    {
+    }
+
+    critical_bytes(const critical_bytes&) = delete;
+    critical_bytes& operator=(const critical_bytes&) = delete;
+
+    ~critical_bytes()
+    {
+        if (data_) env_->ReleasePrimitiveArrayCritical(array_, data_, mode_);
+    }
+
+    uint8_t* get()
+    {
+        if (!data_)
+        {
+            data_ = (uint8_t*)env_->GetPrimitiveArrayCritical(array_, nullptr);
+            if (!data_) throw std::bad_alloc();
+        }
+        return data_;
+    }
+
+    uint32_t size() const
+    {
+        return size_;
+    }
+};
+
+/** A byte[] copied in by GetByteArrayRegion and, unless the mode is JNI_ABORT, copied back by
+* SetByteArrayRegion on release, for the single calls computing scalar multiplications: these take
+* up to a few milliseconds, for which a critical array would hold back the garbage collector.
+* Keys, hashes and signatures fit in the buffer on the stack, longer arrays such as messages are allocated.
+*/
+class region_bytes
+{
+    static const uint32_t STACK_SIZE = 128;
+
+    JNIEnv*              env_;
+    jbyteArray           array_;
+    jint                 mode_;
+    uint32_t             size_;
+    uint8_t*             data_;
+    uint8_t              stack_[STACK_SIZE];
+    std::vector<uint8_t> heap_;
+
+public:
+    region_bytes(JNIEnv* env, jbyteArray array, jint mode)
+        : env_(env),
+          array_(array),
+          mode_(mode),
+          size_((uint32_t)env->GetArrayLength(array)),
+          data_(stack_)
+    {
+        if (size_ > STACK_SIZE)
+        {
+            heap_.resize(size_);
+            data_ = heap_.data();
+        }
+        env->GetByteArrayRegion(array, 0, (jsize)size_, (jbyte*)data_);
+    }
+
+    region_bytes(const region_bytes&) = delete;
+    region_bytes& operator=(const region_bytes&) = delete;
+
+    // the copy may hold a secret key, so it is overwritten once released
+    ~region_bytes()
+    {
+        if (mode_ != JNI_ABORT) env_->SetByteArrayRegion(array_, 0, (jsize)size_, (const jbyte*)data_);
+        secure_zero(data_, size_);
+    }
+
+    uint8_t* get()
+    {
+        return data_;
+    }
+
+    uint32_t size() const
+    {
+        return size_;
+    }
+};
+
+/** A byte[] accessed through GetByteArrayElements, for the batch calls.
+* A batch may run for a long time on the thread pool, and a critical array would hold back the
+* garbage collector for all that time, so the VM is left free to hand out a copy instead.
+*/
+class array_bytes
+{
+    JNIEnv*    env_;
+    jbyteArray array_;
+    jint       mode_;
+    uint32_t   size_;
+    uint8_t*   data_;
+
+public:
+    array_bytes(JNIEnv* env, jbyteArray array, jint mode)
+        : env_(env),
+          array_(array),
+          mode_(mode),
+          size_((uint32_t)env->GetArrayLength(array)),
+          data_((uint8_t*)env->GetByteArrayElements(array, nullptr))
+    {
+        if (!data_) throw std::bad_alloc();
+    }
+
+    array_bytes(const array_bytes&) = delete;
+    array_bytes& operator=(const array_bytes&) = delete;
+
+    ~array_bytes()
+    {
+        env_->ReleaseByteArrayElements(array_, (jbyte*)data_, mode_);
+    }
+
+    uint8_t* get()
+    {
+        return data_;
+    }
+
+    uint32_t size() const
+    {
+        return size_;
+    }
+};
+
+/**
+  \return the size of each of the count elements packed in size bytes
+*/
+inline uint32_t element_size(uint32_t size, jint count)
+{
+    if (count < 0) throw std::runtime_error("invalid count");
+    if (count == 0) return 0;
+    if (size % (uint32_t)count != 0) throw std::runtime_error("buffer size is not a multiple of count");
+    return size / (uint32_t)count;
+}
+
+/**
+  \return the count sizes of the messages stored one after the other in an array of total bytes
+*/
+inline std::vector<uint32_t> message_sizes(JNIEnv* env, jintArray sizes, uint32_t total, jint count)
+{
+    if (count < 0) throw std::runtime_error("invalid count");
+    if (env->GetArrayLength(sizes) < count) throw std::runtime_error("message sizes array too short");
+    std::vector<uint32_t> result(count);
+    env->GetIntArrayRegion(sizes, 0, count, (jint*)result.data());
+    uint64_t sum = 0;
+    for (uint32_t size : result)
+    {
+        if (size > 0x7FFFFFFF) throw std::runtime_error("invalid message size");
+        sum += size;
+    }
+    if (sum > total) throw std::runtime_error("message sizes exceed the messages array");
+    return result;
+}
+
+/**
+  \return the address of the byte at offset in a direct java.nio.ByteBuffer
+*/
+inline uint8_t* direct_address(JNIEnv* env, jobject buffer, jint offset)
+{
+    uint8_t* address = (uint8_t*)env->GetDirectBufferAddress(buffer);
+    if (!address) throw std::runtime_error("direct buffer expected");
+    return address + offset;
+}
+
+}
+}
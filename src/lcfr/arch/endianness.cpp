@@ -1,16 +1,81 @@
 #include "lcfr/arch/endianness.h"
 
-uint16_t lcfr::reverse(uint16_t x)
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define LCFR_ENDIANNESS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace lcfr {
+
+namespace {
+
+typedef void (*reverse_kernel)(uint8_t*, size_t, const uint8_t*, size_t, size_t, size_t);
+
+// 8 bytes at a time with bswap, the tail of less than 8 bytes one byte at a time
+void reverse_string(uint8_t* to, const uint8_t* from, size_t size)
 {
-    return (x << 8) | (x >> 8);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        uint64_t x;
+        memcpy(&x, from + size - i - 8, 8);
+        x = reverse(x);
+        memcpy(to + i, &x, 8);
+    }
+    for (; i < size; i++) to[i] = from[size - 1 - i];
 }
 
-uint32_t lcfr::reverse(uint32_t x)
+void reverse_generic(uint8_t* to, size_t to_stride, const uint8_t* from, size_t from_stride, size_t size, size_t count)
 {
-    return reverse(uint16_t(x >> 16)) | uint32_t(reverse(uint16_t(x))) << 16;
+    for (size_t k = 0; k < count; k++, to += to_stride, from += from_stride) reverse_string(to, from, size);
 }
 
-uint64_t lcfr::reverse(uint64_t x)
+#ifdef LCFR_ENDIANNESS_X86
+__attribute__((target("ssse3")))
+void reverse_ssse3(uint8_t* to, size_t to_stride, const uint8_t* from, size_t from_stride, size_t size, size_t count)
 {
-    return reverse(uint32_t(x >> 32)) | uint64_t(reverse(uint32_t(x))) << 32;
+    const __m128i mask = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    for (size_t k = 0; k < count; k++, to += to_stride, from += from_stride)
+    {
+        size_t i = 0;
+        for (; i + 16 <= size; i += 16)
+        {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + size - i - 16));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(to + i), _mm_shuffle_epi8(x, mask));
+        }
+        reverse_string(to + i, from, size - i);
+    }
+}
+#endif
+
+reverse_kernel select_reverse_kernel()
+{
+#ifdef LCFR_ENDIANNESS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("ssse3")) return &reverse_ssse3;
+#endif
+    return &reverse_generic;
+}
+
+// the kernel is selected while the library is loaded, the generic kernel serving any earlier call
+reverse_kernel kernel_ = &reverse_generic;
+
+struct reverse_kernel_selector
+{
+    reverse_kernel_selector()
+    {
+        kernel_ = select_reverse_kernel();
+    }
+} reverse_kernel_selector_;
+
+}
+
+void reverse_bytes(
+    uint8_t* to, size_t to_stride,
+    const uint8_t* from, size_t from_stride,
+    size_t size, size_t count)
+{
+    kernel_(to, to_stride, from, from_stride, size, count);
+}
+
 }
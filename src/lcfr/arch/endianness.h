@@ -2,73 +2,55 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
-namespace lcfr {
-
-uint16_t reverse(uint16_t x);
-uint32_t reverse(uint32_t x);
-uint64_t reverse(uint64_t x);
-
-#if BIG_ENDIAN
-static void be_serialize(uint8_t* to, uint64_t from)
-{
-    *(uint64_t*)to = from;
-}
-
-static void be_serialize(uint8_t* to, uint32_t from)
-{
-    *(uint32_t*)to = from;
-}
-
-static void be_serialize(uint8_t* to, uint16_t from)
-{
-    *(uint16_t*)to = from;
-}
-
-static void be_deserialize(uint64_t& to, const uint8_t* from)
-{
-    to = *(uint64_t*)from;
-}
-
-static void be_deserialize(uint32_t& to, const uint8_t* from)
-{
-    to = *(uint32_t*)from;
-}
-
-static void be_deserialize(uint16_t& to, const uint8_t* from)
-{
-    to = *(uint16_t*)from;
-}
+// glibc defines BIG_ENDIAN as a byte order constant whatever the target, so the compiler macros are used
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define LCFR_BIG_ENDIAN 1
 #else
-static void be_serialize(uint8_t* to, uint64_t from)
-{
-    *(uint64_t*)to = reverse(from);
-}
+#define LCFR_BIG_ENDIAN 0
+#endif
 
-static void be_serialize(uint8_t* to, uint32_t from)
-{
-    *(uint32_t*)to = reverse(from);
-}
+namespace lcfr {
 
-static void be_serialize(uint8_t* to, uint16_t from)
-{
-    *(uint16_t*)to = reverse(from);
-}
+#ifdef _MSC_VER
+inline uint16_t reverse(uint16_t x) { return _byteswap_ushort(x); }
+inline uint32_t reverse(uint32_t x) { return _byteswap_ulong(x); }
+inline uint64_t reverse(uint64_t x) { return _byteswap_uint64(x); }
+#else
+inline uint16_t reverse(uint16_t x) { return __builtin_bswap16(x); }
+inline uint32_t reverse(uint32_t x) { return __builtin_bswap32(x); }
+inline uint64_t reverse(uint64_t x) { return __builtin_bswap64(x); }
+#endif
 
-static void be_deserialize(uint64_t& to, const uint8_t* from)
+// the words are copied with memcpy, which compiles to a single unaligned load or store
+template <class W>
+inline void be_serialize(uint8_t* to, W from)
 {
-    to = reverse(*(uint64_t*)from);
+#if !LCFR_BIG_ENDIAN
+    from = reverse(from);
+#endif
+    memcpy(to, &from, sizeof(W));
 }
 
-static void be_deserialize(uint32_t& to, const uint8_t* from)
+template <class W>
+inline void be_deserialize(W& to, const uint8_t* from)
 {
-    to = reverse(*(uint32_t*)from);
+    memcpy(&to, from, sizeof(W));
+#if !LCFR_BIG_ENDIAN
+    to = reverse(to);
+#endif
 }
 
-static void be_deserialize(uint16_t& to, const uint8_t* from)
-{
-    to = reverse(*(uint16_t*)from);
-}
-#endif
+/**
+  Copy count strings of size bytes in the reverse byte order, to[i] = from[size - 1 - i] for each string,
+  the strings being from_stride bytes apart in from and to_stride bytes apart in to.
+  On a little-endian cpu the reversed big-endian string of a number is the image of its array of words,
+  so that whole batches of numbers are converted in one pass, 16 bytes at a time with pshufb when available.
+*/
+void reverse_bytes(
+    uint8_t* to, size_t to_stride,
+    const uint8_t* from, size_t from_stride,
+    size_t size, size_t count);
 
 }
@@ -0,0 +1,23 @@
+#pragma once
+
+/** USDT probes of the provider lcfr, for bpftrace or perf (e.g. bpftrace -l 'usdt:liblcfr.so:*').
+* A probe compiles to a nop and an ELF note describing its arguments, which the tracers read when attached.
+* The probes are compiled out without LCFR_USDT, and when sys/sdt.h (systemtap-sdt-dev) is missing.
+* A double underscore in a probe name reads as a dash for the tracers: sign__entry is lcfr:sign-entry.
+*/
+#if defined(LCFR_USDT) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define LCFR_HAS_USDT 1
+#endif
+#endif
+
+#ifdef LCFR_HAS_USDT
+#define LCFR_TRACE1(name, a)        DTRACE_PROBE1(lcfr, name, a)
+#define LCFR_TRACE2(name, a, b)     DTRACE_PROBE2(lcfr, name, a, b)
+#define LCFR_TRACE3(name, a, b, c)  DTRACE_PROBE3(lcfr, name, a, b, c)
+#else
+#define LCFR_TRACE1(name, a)        ((void)0)
+#define LCFR_TRACE2(name, a, b)     ((void)0)
+#define LCFR_TRACE3(name, a, b, c)  ((void)0)
+#endif
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace lcfr {
+
+/** Cheap monotonic clock: the time stamp counter on x86, else the steady clock in nanoseconds.
+* The reads are not serialized, an interval may include a few instructions before or after it.
+*/
+inline uint64_t read_tsc()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+}
@@ -0,0 +1,196 @@
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include "autotune.h"
+#include "library_info.h"
+#include "lcfr/crypto/ecc/ec_fp.h"
+
+namespace lcfr {
+
+namespace {
+
+// repetitions of a measure, the fastest one being kept
+const unsigned REPEATS = 3;
+
+const char* const HEADER = "# lcfr tuning 1";
+
+const unsigned MAX_WINDOW = ec_fp_secp256k1<>::MAX_WINDOW;
+
+double elapsed_ns(std::chrono::steady_clock::time_point t0)
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - t0).count();
+}
+
+template <class F>
+double fastest_ns(F&& f)
+{
+    double best = 0;
+    for (unsigned r = 0; r < REPEATS; r++)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        double t = elapsed_ns(t0);
+        if (r == 0 || t < best) best = t;
+    }
+    return best;
+}
+
+template <class C>
+void tune_curve()
+{
+    typedef typename C::ecpp        ecpp;
+    typedef typename C::n_ui        n_ui;
+    typedef typename C::lane_point  lane_point;
+    const C& c = ec_shared_cipher<C>();
+
+    // a full size scalar, the multiplications taking the same time for every scalar of that size
+    n_ui k = n_ui::ones(c.n_fp_.getPrimeBitCount());
+    k[0] ^= 0x5A5A5A5A;
+
+    ecpp g(c.G.x, c.G.y), p;
+    unsigned window = 1;
+    double scalar_ns = 0;
+    for (unsigned w = 1; w <= C::MAX_WINDOW; w++)
+    {
+        double t = fastest_ns([&] { c.mult(p, g, k, C::NNW, w); });
+        if (w == 1 || t < scalar_ns)
+        {
+            window = w;
+            scalar_ns = t;
+        }
+    }
+
+    // a lane multiplication costs the same whatever the number of busy lanes,
+    // the lanes pay off from the number of scalar multiplications it outlasts
+    unsigned min_lanes = LANE_COUNT + 1;
+    if (lane_kernels_vectorized())
+    {
+        const uint32_t* ks[LANE_COUNT];
+        for (unsigned l = 0; l < LANE_COUNT; l++) ks[l] = k;
+        lane_point q;
+        c.lanes_.broadcast(q, c.G.x, c.G.y);
+        double lanes_ns = fastest_ns([&] { lane_point r; c.lanes_.mult(r, q, ks, C::NNW); });
+        double ratio = lanes_ns / scalar_ns;
+        min_lanes = ratio < 2 ? 2 : ratio >= LANE_COUNT ? LANE_COUNT + 1 : unsigned(ratio) + 1;
+    }
+
+    c.tune(window, min_lanes);
+}
+
+struct curve_entry
+{
+    const char* name;
+    void (*tune)();
+    void (*set)(const curve_tuning&);
+    curve_tuning (*get)();
+};
+
+template <class C>
+void set_curve(const curve_tuning& t)
+{
+    ec_shared_cipher<C>().tune(t.window, t.min_lanes);
+}
+
+template <class C>
+curve_tuning get_curve()
+{
+    const C& c = ec_shared_cipher<C>();
+    curve_tuning t = { c.window(), c.min_lanes() };
+    return t;
+}
+
+#define LCFR_CURVE_ENTRY(name, C) { name, &tune_curve<C>, &set_curve<C>, &get_curve<C> }
+
+const curve_entry CURVES[] = {
+    LCFR_CURVE_ENTRY("secp112r1", ec_fp_secp112r1<>),
+    LCFR_CURVE_ENTRY("secp112r2", ec_fp_secp112r2<>),
+    LCFR_CURVE_ENTRY("secp128r1", ec_fp_secp128r1<>),
+    LCFR_CURVE_ENTRY("secp128r2", ec_fp_secp128r2<>),
+    LCFR_CURVE_ENTRY("secp160k1", ec_fp_secp160k1<>),
+    LCFR_CURVE_ENTRY("secp160r1", ec_fp_secp160r1<>),
+    LCFR_CURVE_ENTRY("secp192k1", ec_fp_secp192k1<>),
+    LCFR_CURVE_ENTRY("secp192r1", ec_fp_secp192r1<>),
+    LCFR_CURVE_ENTRY("secp256k1", ec_fp_secp256k1<>),
+    LCFR_CURVE_ENTRY("secp256r1", ec_fp_secp256r1<>)
+};
+
+const size_t CURVE_COUNT = sizeof(CURVES) / sizeof(CURVES[0]);
+
+const curve_entry* find_entry(const char* name)
+{
+    for (const curve_entry& e : CURVES)
+        if (strcmp(e.name, name) == 0) return &e;
+    return nullptr;
+}
+
+// the tuning holds for the kernels selected on the cpu it was measured on
+std::string kernels_line()
+{
+    return std::string("kernels ") + LibraryInfo().getActiveKernels();
+}
+
+}
+
+void autotune_curves()
+{
+    for (const curve_entry& e : CURVES) e.tune();
+}
+
+bool load_tuning(const char* path)
+{
+    FILE* f = fopen(path, "r");
+    if (!f) return false;
+
+    char line[256];
+    bool valid = fgets(line, sizeof(line), f) && (strncmp(line, HEADER, strlen(HEADER)) == 0);
+    valid = valid && fgets(line, sizeof(line), f) && (strcspn(line, "\r\n") == kernels_line().size())
+        && (strncmp(line, kernels_line().c_str(), kernels_line().size()) == 0);
+
+    // every curve must be present, the parameters are applied once the whole file is read
+    curve_tuning tunings[CURVE_COUNT];
+    bool found[CURVE_COUNT] = {};
+    while (valid && fgets(line, sizeof(line), f))
+    {
+        if (line[0] == '#') continue;
+        char name[32];
+        curve_tuning t;
+        if (sscanf(line, "%31s %u %u", name, &t.window, &t.min_lanes) != 3) { valid = false; break; }
+        const curve_entry* e = find_entry(name);
+        if (!e || t.window < 1 || t.window > MAX_WINDOW
+            || t.min_lanes < 1 || t.min_lanes > LANE_COUNT + 1) { valid = false; break; }
+        tunings[e - CURVES] = t;
+        found[e - CURVES] = true;
+    }
+    fclose(f);
+
+    for (size_t i = 0; i < CURVE_COUNT; i++) valid = valid && found[i];
+    if (!valid) return false;
+    for (size_t i = 0; i < CURVE_COUNT; i++) CURVES[i].set(tunings[i]);
+    return true;
+}
+
+bool save_tuning(const char* path)
+{
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "%s\n%s\n", HEADER, kernels_line().c_str());
+    fprintf(f, "# curve window min_lanes\n");
+    for (const curve_entry& e : CURVES)
+    {
+        curve_tuning t = e.get();
+        fprintf(f, "%s %u %u\n", e.name, t.window, t.min_lanes);
+    }
+    return fclose(f) == 0;
+}
+
+bool get_tuning(const char* curve, curve_tuning& tuning)
+{
+    const curve_entry* e = find_entry(curve);
+    if (!e) return false;
+    tuning = e->get();
+    return true;
+}
+
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace lcfr {
+
+/** Parameters of the shared cipher of a curve, chosen by the autotuner.
+*/
+struct curve_tuning
+{
+    unsigned window;        // window width of the scalar multiplications
+    unsigned min_lanes;     // number of signatures from which batches use the lanes
+};
+
+/**
+  Benchmark the candidate parameters of every curve and apply the fastest ones to the shared ciphers.
+  Each curve takes a few scalar multiplications per candidate.
+*/
+void autotune_curves();
+
+/**
+  Apply the parameters saved by save_tuning.
+  \return false if the file is missing, malformed or was written for other kernels, nothing being applied then
+*/
+bool load_tuning(const char* path);
+
+/**
+  Save the parameters of the shared ciphers, with the kernels they were tuned for.
+  \return false if the file cannot be written
+*/
+bool save_tuning(const char* path);
+
+/**
+  \return false if the curve name is unknown
+*/
+bool get_tuning(const char* curve, curve_tuning& tuning);
+
+}
@@ -1,51 +1,359 @@
 #include <string.h>
+#include <algorithm>
+#include "lcfr/arch/trace.h"
+#include "lcfr/crypto/ecc/signature_codec.h"
+#include "lcfr/crypto/hash/sha256.h"
 #include "lcfr/crypto/mp_arithmetic.h"
 #include "cipher.h"
+#include "runtime.h"
 
 namespace lcfr {
 
+namespace {
+
+const size_t SIGN_GRAIN = 8;
+const size_t VERIFY_GRAIN = 32;
+const size_t DECODE_GRAIN = 32;
+
+// messages hashed at a time by a slice of a message batch, before their digests are signed or verified
+const size_t MESSAGE_CHUNK = 128;
+
+// DER signatures decoded at a time by a slice of a DER batch, before they are verified
+const size_t DER_CHUNK = 128;
+
+// the arrays of the batches are stored one after the other or left where the requests keep them
+template <class C>
+struct sign_batch
+{
+    const C* cipher;
+    batch_arrays<uint8_t*>       r;
+    batch_arrays<uint8_t*>       s;
+    batch_arrays<const uint8_t*> h;
+    batch_arrays<const uint8_t*> ek;
+    batch_arrays<const uint8_t*> pk;
+
+    static void run(void* context, size_t begin, size_t end, const thread_pool::scratch&)
+    {
+        auto& b = *reinterpret_cast<const sign_batch<C>*>(context);
+        b.cipher->generate_signatures(
+            b.r.from(begin), b.s.from(begin), b.h.from(begin), b.ek.from(begin), b.pk.from(begin), end - begin);
+    }
+};
+
+template <class C>
+struct verify_batch
+{
+    const C* cipher;
+    int32_t* results;
+    batch_arrays<const uint8_t*> r;
+    batch_arrays<const uint8_t*> s;
+    batch_arrays<const uint8_t*> h;
+    batch_arrays<const uint8_t*> qx;
+    batch_arrays<const uint8_t*> qy;
+
+    static void run(void* context, size_t begin, size_t end, const thread_pool::scratch& scratch)
+    {
+        auto& b = *reinterpret_cast<const verify_batch<C>*>(context);
+        b.cipher->verify_signatures(
+            b.results + begin,
+            b.r.from(begin), b.s.from(begin), b.h.from(begin), b.qx.from(begin), b.qy.from(begin),
+            end - begin,
+            scratch.data, scratch.size);
+    }
+};
+
+// Arrays of variable sizes stored one after the other, messages or DER signatures. The offset of the first array
+// of every block is computed once on the stack, so that a slice of a batch finds the address of its first array
+// from the start of its block, without any allocation.
+struct packed_arrays
+{
+    static const size_t MAX_BLOCKS = 512;
+
+    const uint8_t*  base;
+    const uint32_t* sizes;
+    size_t          block;
+    size_t          offsets[MAX_BLOCKS];
+
+    packed_arrays(const uint8_t* a, const uint32_t* a_sizes, size_t count)
+        : base(a), sizes(a_sizes), block(count / MAX_BLOCKS + 1)
+    {
+        size_t offset = 0;
+        for (size_t b = 0, i = 0; i < count; b++)
+        {
+            offsets[b] = offset;
+            size_t end = std::min(i + block, count);
+            for (; i < end; i++) offset += sizes[i];
+        }
+    }
+
+    // the addresses of the arrays first to first + n
+    void addresses(const uint8_t** a, size_t first, size_t n) const
+    {
+        size_t offset = offsets[first / block];
+        for (size_t i = first - first % block; i < first; i++) offset += sizes[i];
+        for (size_t i = 0; i < n; i++)
+        {
+            a[i] = base + offset;
+            offset += sizes[first + i];
+        }
+    }
+};
+
+template <class C>
+struct sign_message_batch
+{
+    const C* cipher;
+    uint8_t* r;        size_t r_size;
+    uint8_t* s;        size_t s_size;
+    const packed_arrays* m;
+    const uint8_t* ek; size_t ek_size;
+    const uint8_t* pk; size_t pk_size;
+
+    static void run(void* context, size_t begin, size_t end, const thread_pool::scratch&)
+    {
+        auto& b = *reinterpret_cast<const sign_message_batch<C>*>(context);
+        uint8_t digests[MESSAGE_CHUNK * SHA256_DIGEST_SIZE];
+        const uint8_t* m[MESSAGE_CHUNK];
+        for (size_t i = begin; i < end; i += MESSAGE_CHUNK)
+        {
+            size_t n = std::min(end - i, MESSAGE_CHUNK);
+            b.m->addresses(m, i, n);
+            sha256_digests(digests, m, b.m->sizes + i, n);
+            b.cipher->generate_signatures(
+                b.r + i * b.r_size, b.r_size,
+                b.s + i * b.s_size, b.s_size,
+                digests, SHA256_DIGEST_SIZE,
+                b.ek + i * b.ek_size, b.ek_size,
+                b.pk + i * b.pk_size, b.pk_size,
+                n);
+        }
+    }
+};
+
+template <class C>
+struct verify_message_batch
+{
+    const C* cipher;
+    int32_t* results;
+    const uint8_t* r;  size_t r_size;
+    const uint8_t* s;  size_t s_size;
+    const packed_arrays* m;
+    const uint8_t* qx; size_t qx_size;
+    const uint8_t* qy; size_t qy_size;
+
+    static void run(void* context, size_t begin, size_t end, const thread_pool::scratch& scratch)
+    {
+        auto& b = *reinterpret_cast<const verify_message_batch<C>*>(context);
+        uint8_t digests[MESSAGE_CHUNK * SHA256_DIGEST_SIZE];
+        const uint8_t* m[MESSAGE_CHUNK];
+        for (size_t i = begin; i < end; i += MESSAGE_CHUNK)
+        {
+            size_t n = std::min(end - i, MESSAGE_CHUNK);
+            b.m->addresses(m, i, n);
+            sha256_digests(digests, m, b.m->sizes + i, n);
+            b.cipher->verify_signatures(
+                b.results + i,
+                b.r + i * b.r_size, b.r_size,
+                b.s + i * b.s_size, b.s_size,
+                digests, SHA256_DIGEST_SIZE,
+                b.qx + i * b.qx_size, b.qx_size,
+                b.qy + i * b.qy_size, b.qy_size,
+                n,
+                scratch.data, scratch.size);
+        }
+    }
+};
+
+template <class C>
+struct verify_der_batch
+{
+    const C* cipher;
+    int32_t* results;
+    const packed_arrays* der;
+    const uint8_t* h;  size_t h_size;
+    const uint8_t* qx; size_t qx_size;
+    const uint8_t* qy; size_t qy_size;
+
+    static void run(void* context, size_t begin, size_t end, const thread_pool::scratch& scratch)
+    {
+        auto& b = *reinterpret_cast<const verify_der_batch<C>*>(context);
+        uint8_t r[DER_CHUNK * C::NNO], s[DER_CHUNK * C::NNO];
+        const uint8_t* der[DER_CHUNK];
+        for (size_t i = begin; i < end; i += DER_CHUNK)
+        {
+            size_t n = std::min(end - i, DER_CHUNK);
+            b.der->addresses(der, i, n);
+            // a malformed signature gets s = 0, which the verification rejects
+            for (size_t j = 0; j < n; j++)
+                if (!decode_der_signature(r + j * C::NNO, C::NNO, s + j * C::NNO, C::NNO, der[j], b.der->sizes[i + j]))
+                    memset(s + j * C::NNO, 0, C::NNO);
+            b.cipher->verify_signatures(
+                b.results + i,
+                r, C::NNO,
+                s, C::NNO,
+                b.h + i * b.h_size, b.h_size,
+                b.qx + i * b.qx_size, b.qx_size,
+                b.qy + i * b.qy_size, b.qy_size,
+                n,
+                scratch.data, scratch.size);
+        }
+    }
+};
+
+// the compressed key: the first k_size bytes of the SHA-256 digest of the SEC1 compressed encoding
+template <class C>
+void compress_key(
+    const C* c,
+    uint8_t* k,        size_t k_size,
+    const uint8_t* qx, size_t qx_size,
+    const uint8_t* qy, size_t qy_size)
+{
+    uint8_t q[1 + C::NPO], digest[SHA256_DIGEST_SIZE];
+    c->encode_point(q, sizeof(q), qx, qx_size, qy, qy_size, true);
+    sha256 hash;
+    hash.update(q, sizeof(q));
+    hash.final(digest);
+    memcpy(k, digest, k_size);
+}
+
+template <class C>
+bool verify_compressed(
+    const C* c,
+    const uint8_t* sig, size_t sig_size,
+    const uint8_t* h,   size_t h_size,
+    const uint8_t* k,   size_t k_size)
+{
+    if (sig_size != 2 * C::NNO) return false;
+    uint8_t s[C::NNO], qx[C::NPO], qy[C::NPO], key[EcCipher::MAX_COMPRESSION];
+    memcpy(s, sig + C::NNO, C::NNO);
+    s[0] &= 0x7F;
+    if (!c->recover_public_key(qx, C::NPO, qy, C::NPO, sig, C::NNO, s, C::NNO, h, h_size, sig[C::NNO] >> 7))
+        return false;
+    compress_key(c, key, k_size, qx, C::NPO, qy, C::NPO);
+    return memcmp(key, k, k_size) == 0;
+}
+
+template <class C>
+struct verify_compressed_batch
+{
+    const C* cipher;
+    int32_t* results;
+    const uint8_t* c; size_t c_size;
+    const uint8_t* h; size_t h_size;
+    const uint8_t* k; size_t k_size;
+
+    static void run(void* context, size_t begin, size_t end, const thread_pool::scratch&)
+    {
+        auto& b = *reinterpret_cast<const verify_compressed_batch<C>*>(context);
+        for (size_t i = begin; i < end; i++)
+        {
+            b.results[i] = verify_compressed(
+                b.cipher,
+                b.c + i * b.c_size, b.c_size,
+                b.h + i * b.h_size, b.h_size,
+                b.k + i * b.k_size, b.k_size) ? -1 : 0;
+        }
+    }
+};
+
+template <class C>
+struct decode_batch
+{
+    const C* cipher;
+    int32_t* results;
+    uint8_t* qx;      size_t qx_size;
+    uint8_t* qy;      size_t qy_size;
+    const uint8_t* q; size_t q_size;
+
+    static void run(void* context, size_t begin, size_t end, const thread_pool::scratch&)
+    {
+        auto& b = *reinterpret_cast<const decode_batch<C>*>(context);
+        b.cipher->decode_points(
+            b.results + begin,
+            b.qx + begin * b.qx_size, b.qx_size,
+            b.qy + begin * b.qy_size, b.qy_size,
+            b.q + begin * b.q_size, b.q_size,
+            end - begin);
+    }
+};
+
+// The names are secpNNN followed by k1, r1 or r2, with two curves of each size,
+// so that the size and the suffix locate the curve in the table without comparing every name.
+int find_curve(const char* curve)
+{
+    if (strncmp(curve, "secp", 4) != 0 || strlen(curve) != 9) return -1;
+
+    int index;
+    switch ((curve[4] - '0') * 100 + (curve[5] - '0') * 10 + (curve[6] - '0'))
+    {
+    case 112: index = 0; break;
+    case 128: index = 2; break;
+    case 160: index = 4; break;
+    case 192: index = 6; break;
+    case 256: index = 8; break;
+    default:  return -1;
+    }
+
+    // the second curve of a size is r2 after r1, or r1 after k1
+    if (strcmp(curve + 7, index < 4 ? "r2" : "r1") == 0) index++;
+    return index;
+}
+
+}
+
 EcCipher::EcCipher(const char* curve)
 {
-    if      (strcmp(curve, "secp112r1") == 0) cipher_.emplace<ec_fp_secp112r1<>>();
-    else if (strcmp(curve, "secp112r2") == 0) cipher_.emplace<ec_fp_secp112r2<>>();
-    else if (strcmp(curve, "secp128r1") == 0) cipher_.emplace<ec_fp_secp128r1<>>();
-    else if (strcmp(curve, "secp128r2") == 0) cipher_.emplace<ec_fp_secp128r2<>>();
-    else if (strcmp(curve, "secp160k1") == 0) cipher_.emplace<ec_fp_secp160k1<>>();
-    else if (strcmp(curve, "secp160r1") == 0) cipher_.emplace<ec_fp_secp160r1<>>();
-    else if (strcmp(curve, "secp192k1") == 0) cipher_.emplace<ec_fp_secp192k1<>>();
-    else if (strcmp(curve, "secp192r1") == 0) cipher_.emplace<ec_fp_secp192r1<>>();
-    else if (strcmp(curve, "secp256k1") == 0) cipher_.emplace<ec_fp_secp256k1<>>();
-    else if (strcmp(curve, "secp256r1") == 0) cipher_.emplace<ec_fp_secp256r1<>>();
-    else throw std::runtime_error("invalid curve name");
+    static const struct
+    {
+        const ec_curve_params& params;
+        void (EcCipher::*bind)();
+    } CURVES[] = {
+        { SECP112R1_PARAMS, &EcCipher::bind<ec_fp_secp112r1<>> },
+        { SECP112R2_PARAMS, &EcCipher::bind<ec_fp_secp112r2<>> },
+        { SECP128R1_PARAMS, &EcCipher::bind<ec_fp_secp128r1<>> },
+        { SECP128R2_PARAMS, &EcCipher::bind<ec_fp_secp128r2<>> },
+        { SECP160K1_PARAMS, &EcCipher::bind<ec_fp_secp160k1<>> },
+        { SECP160R1_PARAMS, &EcCipher::bind<ec_fp_secp160r1<>> },
+        { SECP192K1_PARAMS, &EcCipher::bind<ec_fp_secp192k1<>> },
+        { SECP192R1_PARAMS, &EcCipher::bind<ec_fp_secp192r1<>> },
+        { SECP256K1_PARAMS, &EcCipher::bind<ec_fp_secp256k1<>> },
+        { SECP256R1_PARAMS, &EcCipher::bind<ec_fp_secp256r1<>> }
+    };
+
+    int index = find_curve(curve);
+    if (index < 0 || strcmp(CURVES[index].params.name, curve) != 0) throw std::runtime_error("invalid curve name");
+    (this->*CURVES[index].bind)();
+    curve_ = index;
 }
 
+// every method dispatches on the curve type, the calls into the concrete cipher being resolved statically
+
 size_t EcCipher::getPrimeBitLength() const
 {
-    size_t bitCount = cipher_.as<ec_cipher_base<>>().get_prime_bit_length();
-    return bitCount;
+    return cipher_.visit([](const auto* c) { return c->get_prime_bit_length(); });
 }
 
 size_t EcCipher::getPrimeByteLength() const
 {
-    size_t bitCount = cipher_.as<ec_cipher_base<>>().get_prime_bit_length();
+    size_t bitCount = getPrimeBitLength();
     return (bitCount + 7) / 8;
 }
 
 void EcCipher::getPrime(
     uint8_t* p, size_t p_size) const
 {
-    cipher_.as<ec_cipher_base<>>().get_prime(p, p_size);
+    cipher_.visit([&](const auto* c) { c->get_prime(p, p_size); });
 }
 
 uint32_t EcCipher::getCurvePointCoordinateBitLength() const
 {
-    size_t bitCount = cipher_.as<ec_cipher_base<>>().get_curve_point_coordinate_bit_length();
+    size_t bitCount = cipher_.visit([](const auto* c) { return c->get_curve_point_coordinate_bit_length(); });
     return bitCount;
 }
 
 uint32_t EcCipher::getCurvePointCoordinateByteLength() const
 {
-    size_t bitCount = cipher_.as<ec_cipher_base<>>().get_curve_point_coordinate_bit_length();
+    size_t bitCount = getCurvePointCoordinateBitLength();
     return (bitCount + 7) / 8;
 }
 
@@ -56,8 +364,53 @@ void EcCipher::generateSignature(
     const uint8_t* ek, size_t ek_size,
     const uint8_t* pk, size_t pk_size) const
 {
-    cipher_.as<ec_cipher_base<>>().generate_signature(
-        r, r_size, s, s_size, h, h_size, ek, ek_size, pk, pk_size);
+    LCFR_TRACE1(sign__entry, curve_);
+    cipher_.visit([&](const auto* c) {
+        c->generate_signature(r, r_size, s, s_size, h, h_size, ek, ek_size, pk, pk_size);
+    });
+    LCFR_TRACE1(sign__return, curve_);
+}
+
+void EcCipher::generateSignatureRandom(
+    uint8_t* r,        size_t r_size,
+    uint8_t* s,        size_t s_size,
+    const uint8_t* h,  size_t h_size,
+    const uint8_t* pk, size_t pk_size) const
+{
+    LCFR_TRACE1(sign__entry, curve_);
+    cipher_.visit([&](const auto* c) {
+        c->generate_signature_random(r, r_size, s, s_size, h, h_size, pk, pk_size);
+    });
+    LCFR_TRACE1(sign__return, curve_);
+}
+
+uint32_t EcCipher::generateRecoverableSignature(
+    uint8_t* r,        size_t r_size,
+    uint8_t* s,        size_t s_size,
+    const uint8_t* h,  size_t h_size,
+    const uint8_t* ek, size_t ek_size,
+    const uint8_t* pk, size_t pk_size) const
+{
+    LCFR_TRACE1(sign__entry, curve_);
+    unsigned v = cipher_.visit([&](const auto* c) {
+        return c->generate_recoverable_signature(r, r_size, s, s_size, h, h_size, ek, ek_size, pk, pk_size);
+    });
+    LCFR_TRACE1(sign__return, curve_);
+    return uint32_t(v);
+}
+
+void EcCipher::recoverPublicKey(
+    uint8_t* qx,      size_t qx_size,
+    uint8_t* qy,      size_t qy_size,
+    const uint8_t* r, size_t r_size,
+    const uint8_t* s, size_t s_size,
+    const uint8_t* h, size_t h_size,
+    uint32_t v) const
+{
+    bool valid = cipher_.visit([&](const auto* c) {
+        return c->recover_public_key(qx, qx_size, qy, qy_size, r, r_size, s, s_size, h, h_size, v);
+    });
+    if (!valid) throw std::runtime_error("invalid signature");
 }
 
 int32_t EcCipher::verifySignature(
@@ -67,8 +420,12 @@ int32_t EcCipher::verifySignature(
     const uint8_t* qx, size_t qx_size,
     const uint8_t* qy, size_t qy_size) const
 {
-    return cipher_.as<ec_cipher_base<>>().verify_signature(
-        r, r_size, s, s_size, h, h_size, qx, qx_size, qy, qy_size) ? -1 : 0; 
+    LCFR_TRACE1(verify__entry, curve_);
+    int32_t result = cipher_.visit([&](const auto* c) {
+        return c->verify_signature(r, r_size, s, s_size, h, h_size, qx, qx_size, qy, qy_size) ? -1 : 0;
+    });
+    LCFR_TRACE2(verify__return, curve_, result);
+    return result;
 }
 
 void EcCipher::generatePublicKey(
@@ -76,8 +433,404 @@ void EcCipher::generatePublicKey(
     uint8_t* qy, size_t qy_size,
     const uint8_t* pk, size_t pk_size) const
 {
-    return cipher_.as<ec_cipher_base<>>().generate_public_key(
-        qx, qx_size, qy, qy_size, pk, pk_size);
+    LCFR_TRACE1(public_key__entry, curve_);
+    cipher_.visit([&](const auto* c) {
+        c->generate_public_key(qx, qx_size, qy, qy_size, pk, pk_size);
+    });
+    LCFR_TRACE1(public_key__return, curve_);
+}
+
+void EcCipher::generateSignatures(
+    uint8_t* r,        size_t r_size,
+    uint8_t* s,        size_t s_size,
+    const uint8_t* h,  size_t h_size,
+    const uint8_t* ek, size_t ek_size,
+    const uint8_t* pk, size_t pk_size,
+    size_t count) const
+{
+    LCFR_TRACE2(sign_batch__entry, curve_, count);
+    cipher_.visit([&](const auto* c) {
+        typedef typename std::decay<decltype(*c)>::type C;
+        sign_batch<C> batch = {
+            c, { r, nullptr, r_size }, { s, nullptr, s_size }, { h, nullptr, h_size },
+            { ek, nullptr, ek_size }, { pk, nullptr, pk_size } };
+        Runtime::run(&sign_batch<C>::run, &batch, count, SIGN_GRAIN);
+    });
+    LCFR_TRACE2(sign_batch__return, curve_, count);
+}
+
+void EcCipher::verifySignatures(
+    int32_t* results,
+    const uint8_t* r, size_t r_size,
+    const uint8_t* s, size_t s_size,
+    const uint8_t* h, size_t h_size,
+    const uint8_t* qx, size_t qx_size,
+    const uint8_t* qy, size_t qy_size,
+    size_t count) const
+{
+    LCFR_TRACE2(verify_batch__entry, curve_, count);
+    cipher_.visit([&](const auto* c) {
+        typedef typename std::decay<decltype(*c)>::type C;
+        verify_batch<C> batch = {
+            c, results, { r, nullptr, r_size }, { s, nullptr, s_size }, { h, nullptr, h_size },
+            { qx, nullptr, qx_size }, { qy, nullptr, qy_size } };
+        Runtime::run(&verify_batch<C>::run, &batch, count, VERIFY_GRAIN);
+    });
+    LCFR_TRACE2(verify_batch__return, curve_, count);
+}
+
+void EcCipher::generateSignatures(
+    uint8_t* const* r,        size_t r_size,
+    uint8_t* const* s,        size_t s_size,
+    const uint8_t* const* h,  size_t h_size,
+    const uint8_t* const* ek, size_t ek_size,
+    const uint8_t* const* pk, size_t pk_size,
+    size_t count) const
+{
+    LCFR_TRACE2(sign_batch__entry, curve_, count);
+    cipher_.visit([&](const auto* c) {
+        typedef typename std::decay<decltype(*c)>::type C;
+        sign_batch<C> batch = {
+            c, { nullptr, r, r_size }, { nullptr, s, s_size }, { nullptr, h, h_size },
+            { nullptr, ek, ek_size }, { nullptr, pk, pk_size } };
+        Runtime::run(&sign_batch<C>::run, &batch, count, SIGN_GRAIN);
+    });
+    LCFR_TRACE2(sign_batch__return, curve_, count);
+}
+
+void EcCipher::verifySignatures(
+    int32_t* results,
+    const uint8_t* const* r,  size_t r_size,
+    const uint8_t* const* s,  size_t s_size,
+    const uint8_t* const* h,  size_t h_size,
+    const uint8_t* const* qx, size_t qx_size,
+    const uint8_t* const* qy, size_t qy_size,
+    size_t count) const
+{
+    LCFR_TRACE2(verify_batch__entry, curve_, count);
+    cipher_.visit([&](const auto* c) {
+        typedef typename std::decay<decltype(*c)>::type C;
+        verify_batch<C> batch = {
+            c, results, { nullptr, r, r_size }, { nullptr, s, s_size }, { nullptr, h, h_size },
+            { nullptr, qx, qx_size }, { nullptr, qy, qy_size } };
+        Runtime::run(&verify_batch<C>::run, &batch, count, VERIFY_GRAIN);
+    });
+    LCFR_TRACE2(verify_batch__return, curve_, count);
+}
+
+void EcCipher::signMessage(
+    uint8_t* r,        size_t r_size,
+    uint8_t* s,        size_t s_size,
+    const uint8_t* m,  size_t m_size,
+    const uint8_t* ek, size_t ek_size,
+    const uint8_t* pk, size_t pk_size) const
+{
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    sha256_digest(digest, m, m_size);
+    generateSignature(r, r_size, s, s_size, digest, sizeof(digest), ek, ek_size, pk, pk_size);
+}
+
+int32_t EcCipher::verifyMessage(
+    const uint8_t* r, size_t r_size,
+    const uint8_t* s, size_t s_size,
+    const uint8_t* m, size_t m_size,
+    const uint8_t* qx, size_t qx_size,
+    const uint8_t* qy, size_t qy_size) const
+{
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    sha256_digest(digest, m, m_size);
+    return verifySignature(r, r_size, s, s_size, digest, sizeof(digest), qx, qx_size, qy, qy_size);
+}
+
+void EcCipher::signMessages(
+    uint8_t* r,        size_t r_size,
+    uint8_t* s,        size_t s_size,
+    const uint8_t* m,  const uint32_t* m_sizes,
+    const uint8_t* ek, size_t ek_size,
+    const uint8_t* pk, size_t pk_size,
+    size_t count) const
+{
+    LCFR_TRACE2(sign_batch__entry, curve_, count);
+    packed_arrays messages(m, m_sizes, count);
+    cipher_.visit([&](const auto* c) {
+        typedef typename std::decay<decltype(*c)>::type C;
+        sign_message_batch<C> batch = {
+            c, r, r_size, s, s_size, &messages, ek, ek_size, pk, pk_size };
+        Runtime::run(&sign_message_batch<C>::run, &batch, count, SIGN_GRAIN);
+    });
+    LCFR_TRACE2(sign_batch__return, curve_, count);
+}
+
+void EcCipher::verifyMessages(
+    int32_t* results,
+    const uint8_t* r, size_t r_size,
+    const uint8_t* s, size_t s_size,
+    const uint8_t* m, const uint32_t* m_sizes,
+    const uint8_t* qx, size_t qx_size,
+    const uint8_t* qy, size_t qy_size,
+    size_t count) const
+{
+    LCFR_TRACE2(verify_batch__entry, curve_, count);
+    packed_arrays messages(m, m_sizes, count);
+    cipher_.visit([&](const auto* c) {
+        typedef typename std::decay<decltype(*c)>::type C;
+        verify_message_batch<C> batch = {
+            c, results, r, r_size, s, s_size, &messages, qx, qx_size, qy, qy_size };
+        Runtime::run(&verify_message_batch<C>::run, &batch, count, VERIFY_GRAIN);
+    });
+    LCFR_TRACE2(verify_batch__return, curve_, count);
+}
+
+uint32_t EcCipher::encodePublicKey(
+    uint8_t* q,        size_t q_size,
+    const uint8_t* qx, size_t qx_size,
+    const uint8_t* qy, size_t qy_size,
+    bool compressed) const
+{
+    size_t size = cipher_.visit([&](const auto* c) {
+        return c->encode_point(q, q_size, qx, qx_size, qy, qy_size, compressed);
+    });
+    if (size == 0) throw std::runtime_error("encoded key array too short");
+    return uint32_t(size);
+}
+
+void EcCipher::decodePublicKey(
+    uint8_t* qx,      size_t qx_size,
+    uint8_t* qy,      size_t qy_size,
+    const uint8_t* q, size_t q_size) const
+{
+    bool valid = cipher_.visit([&](const auto* c) {
+        return c->decode_point(qx, qx_size, qy, qy_size, q, q_size);
+    });
+    if (!valid) throw std::runtime_error("invalid public key");
+}
+
+void EcCipher::decodePublicKeys(
+    int32_t* results,
+    uint8_t* qx,      size_t qx_size,
+    uint8_t* qy,      size_t qy_size,
+    const uint8_t* q, size_t q_size,
+    size_t count) const
+{
+    cipher_.visit([&](const auto* c) {
+        typedef typename std::decay<decltype(*c)>::type C;
+        decode_batch<C> batch = { c, results, qx, qx_size, qy, qy_size, q, q_size };
+        Runtime::run(&decode_batch<C>::run, &batch, count, DECODE_GRAIN);
+    });
+}
+
+uint32_t EcCipher::encodeSignatureDer(
+    uint8_t* der,     size_t der_size,
+    const uint8_t* r, size_t r_size,
+    const uint8_t* s, size_t s_size) const
+{
+    size_t size = encode_der_signature(der, der_size, r, r_size, s, s_size);
+    if (size == 0) throw std::runtime_error("encoded signature array too short");
+    return uint32_t(size);
+}
+
+void EcCipher::decodeSignatureDer(
+    uint8_t* r,         size_t r_size,
+    uint8_t* s,         size_t s_size,
+    const uint8_t* der, size_t der_size) const
+{
+    if (!decode_der_signature(r, r_size, s, s_size, der, der_size)) throw std::runtime_error("invalid signature encoding");
+}
+
+uint32_t EcCipher::encodeSignatureCompact(
+    uint8_t* c,       size_t c_size,
+    const uint8_t* r, size_t r_size,
+    const uint8_t* s, size_t s_size) const
+{
+    size_t size = getPrimeByteLength();
+    if (c_size < 2 * size) throw std::runtime_error("encoded signature array too short");
+    if (!encode_compact_signature(c, size, r, r_size, s, s_size)) throw std::runtime_error("invalid signature");
+    return uint32_t(2 * size);
+}
+
+void EcCipher::decodeSignatureCompact(
+    uint8_t* r,       size_t r_size,
+    uint8_t* s,       size_t s_size,
+    const uint8_t* c, size_t c_size) const
+{
+    size_t size = getPrimeByteLength();
+    if (c_size != 2 * size || !decode_compact_signature(r, r_size, s, s_size, c, size))
+        throw std::runtime_error("invalid signature encoding");
+}
+
+uint32_t EcCipher::encodeSignaturesDer(
+    uint32_t* der_sizes,
+    uint8_t* der,     size_t der_size,
+    const uint8_t* r, size_t r_size,
+    const uint8_t* s, size_t s_size,
+    size_t count) const
+{
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t size = encode_der_signature(der + total, der_size - total, r + i * r_size, r_size, s + i * s_size, s_size);
+        if (size == 0) throw std::runtime_error("encoded signature array too short");
+        der_sizes[i] = uint32_t(size);
+        total += size;
+    }
+    return uint32_t(total);
+}
+
+void EcCipher::decodeSignaturesDer(
+    int32_t* results,
+    uint8_t* r,         size_t r_size,
+    uint8_t* s,         size_t s_size,
+    const uint8_t* der, const uint32_t* der_sizes,
+    size_t count) const
+{
+    // the malformed signatures are left as r = s = 0, which verifySignatures rejects
+    for (size_t i = 0; i < count; der += der_sizes[i], i++)
+    {
+        bool valid = decode_der_signature(r + i * r_size, r_size, s + i * s_size, s_size, der, der_sizes[i]);
+        if (!valid)
+        {
+            memset(r + i * r_size, 0, r_size);
+            memset(s + i * s_size, 0, s_size);
+        }
+        results[i] = valid ? -1 : 0;
+    }
+}
+
+void EcCipher::encodeSignaturesCompact(
+    uint8_t* c,       size_t c_size,
+    const uint8_t* r, size_t r_size,
+    const uint8_t* s, size_t s_size,
+    size_t count) const
+{
+    size_t size = getPrimeByteLength();
+    if (count > 0 && c_size < 2 * size) throw std::runtime_error("encoded signature array too short");
+    for (size_t i = 0; i < count; i++)
+        if (!encode_compact_signature(c + i * c_size, size, r + i * r_size, r_size, s + i * s_size, s_size))
+            throw std::runtime_error("invalid signature");
+}
+
+void EcCipher::decodeSignaturesCompact(
+    uint8_t* r,       size_t r_size,
+    uint8_t* s,       size_t s_size,
+    const uint8_t* c, size_t c_size,
+    size_t count) const
+{
+    size_t size = getPrimeByteLength();
+    if (count > 0 && c_size < 2 * size) throw std::runtime_error("invalid signature encoding");
+    for (size_t i = 0; i < count; i++)
+        if (!decode_compact_signature(r + i * r_size, r_size, s + i * s_size, s_size, c + i * c_size, size))
+            throw std::runtime_error("invalid signature encoding");
+}
+
+void EcCipher::verifySignaturesDer(
+    int32_t* results,
+    const uint8_t* der, const uint32_t* der_sizes,
+    const uint8_t* h,   size_t h_size,
+    const uint8_t* qx,  size_t qx_size,
+    const uint8_t* qy,  size_t qy_size,
+    size_t count) const
+{
+    LCFR_TRACE2(verify_batch__entry, curve_, count);
+    packed_arrays signatures(der, der_sizes, count);
+    cipher_.visit([&](const auto* c) {
+        typedef typename std::decay<decltype(*c)>::type C;
+        verify_der_batch<C> batch = {
+            c, results, &signatures, h, h_size, qx, qx_size, qy, qy_size };
+        Runtime::run(&verify_der_batch<C>::run, &batch, count, VERIFY_GRAIN);
+    });
+    LCFR_TRACE2(verify_batch__return, curve_, count);
+}
+
+uint32_t EcCipher::generateCompressedSignature(
+    uint8_t* c,        size_t c_size,
+    const uint8_t* h,  size_t h_size,
+    const uint8_t* pk, size_t pk_size) const
+{
+    size_t size = getPrimeByteLength();
+    if (c_size < 2 * size) throw std::runtime_error("encoded signature array too short");
+    LCFR_TRACE1(sign__entry, curve_);
+    unsigned v = cipher_.visit([&](const auto* cipher) {
+        return cipher->generate_recoverable_signature_random(c, size, c + size, size, h, h_size, pk, pk_size);
+    });
+    c[size] |= uint8_t(v << 7);
+    LCFR_TRACE1(sign__return, curve_);
+    return uint32_t(2 * size);
+}
+
+// the low s is below n / 2, so that the top bit of its field is free for the parity of y
+uint32_t EcCipher::encodeCompressedSignature(
+    uint8_t* c,       size_t c_size,
+    const uint8_t* r, size_t r_size,
+    const uint8_t* s, size_t s_size,
+    uint32_t v) const
+{
+    size_t size = getPrimeByteLength();
+    if (c_size < 2 * size) throw std::runtime_error("encoded signature array too short");
+    if (v > 1) throw std::runtime_error("recovery id out of the compressed format range");
+    if (!encode_compact_signature(c, size, r, r_size, s, s_size) || (c[size] & 0x80) != 0)
+        throw std::runtime_error("invalid signature");
+    c[size] |= uint8_t(v << 7);
+    return uint32_t(2 * size);
+}
+
+uint32_t EcCipher::decodeCompressedSignature(
+    uint8_t* r,       size_t r_size,
+    uint8_t* s,       size_t s_size,
+    const uint8_t* c, size_t c_size) const
+{
+    size_t size = getPrimeByteLength();
+    if (c_size != 2 * size) throw std::runtime_error("invalid signature encoding");
+    bool valid = cipher_.visit([&](const auto* cipher) {
+        typedef typename std::decay<decltype(*cipher)>::type C;
+        uint8_t compact[2 * C::NNO];
+        memcpy(compact, c, sizeof(compact));
+        compact[C::NNO] &= 0x7F;
+        return decode_compact_signature(r, r_size, s, s_size, compact, C::NNO);
+    });
+    if (!valid) throw std::runtime_error("invalid signature encoding");
+    return c[size] >> 7;
+}
+
+void EcCipher::encodeCompressedKey(
+    uint8_t* k,        size_t k_size,
+    const uint8_t* qx, size_t qx_size,
+    const uint8_t* qy, size_t qy_size) const
+{
+    if (k_size < MIN_COMPRESSION || k_size > MAX_COMPRESSION) throw std::runtime_error("invalid compressed key size");
+    cipher_.visit([&](const auto* c) {
+        compress_key(c, k, k_size, qx, qx_size, qy, qy_size);
+    });
+}
+
+int32_t EcCipher::verifyCompressedSignature(
+    const uint8_t* c, size_t c_size,
+    const uint8_t* h, size_t h_size,
+    const uint8_t* k, size_t k_size) const
+{
+    if (k_size < MIN_COMPRESSION || k_size > MAX_COMPRESSION) throw std::runtime_error("invalid compressed key size");
+    LCFR_TRACE1(verify__entry, curve_);
+    int32_t result = cipher_.visit([&](const auto* cipher) {
+        return verify_compressed(cipher, c, c_size, h, h_size, k, k_size) ? -1 : 0;
+    });
+    LCFR_TRACE2(verify__return, curve_, result);
+    return result;
+}
+
+void EcCipher::verifyCompressedSignatures(
+    int32_t* results,
+    const uint8_t* c, size_t c_size,
+    const uint8_t* h, size_t h_size,
+    const uint8_t* k, size_t k_size,
+    size_t count) const
+{
+    if (k_size < MIN_COMPRESSION || k_size > MAX_COMPRESSION) throw std::runtime_error("invalid compressed key size");
+    LCFR_TRACE2(verify_batch__entry, curve_, count);
+    cipher_.visit([&](const auto* cipher) {
+        typedef typename std::decay<decltype(*cipher)>::type C;
+        verify_compressed_batch<C> batch = { cipher, results, c, c_size, h, h_size, k, k_size };
+        Runtime::run(&verify_compressed_batch<C>::run, &batch, count, VERIFY_GRAIN);
+    });
+    LCFR_TRACE2(verify_batch__return, curve_, count);
 }
 
 }
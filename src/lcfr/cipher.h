@@ -1,3 +1,5 @@
+#pragma once
+
 #include "lcfr/containers/variant.h"
 #include "lcfr/crypto/ecc/ec_fp.h"
 
@@ -7,10 +9,20 @@ namespace lcfr
 class EcCipher
 {
 public:
+    // the smallest compressed key size, 128 bits against the forgery of a matching key
+    static const size_t MIN_COMPRESSION = 16;
+    // the largest compressed key size, the SHA-256 digest size
     static const size_t MAX_COMPRESSION = 32;
 
     EcCipher(const char* curve);
 
+    /** Return the index of the curve in the statistics, curves being ordered by name.
+      */
+    uint32_t getCurveIndex() const
+    {
+        return curve_;
+    }
+
     size_t getPrimeBitLength() const;
     size_t getPrimeByteLength() const;
 
@@ -32,6 +44,31 @@ public:
         const uint8_t* ek, size_t ek_size,
         const uint8_t* pk, size_t pk_size) const;
 
+    // the ephemeral key is drawn from the generator of the calling thread
+    void generateSignatureRandom(
+        uint8_t* r,        size_t r_size,
+        uint8_t* s,        size_t s_size,
+        const uint8_t* h,  size_t h_size,
+        const uint8_t* pk, size_t pk_size) const;
+
+    // Recoverable signatures: the recovery id v returned with (r, s) selects the point of the signature
+    // among the ones whose abscissa is r modulo n, so that the public key can be computed from the signature and the hash.
+
+    uint32_t generateRecoverableSignature(
+        uint8_t* r,        size_t r_size,
+        uint8_t* s,        size_t s_size,
+        const uint8_t* h,  size_t h_size,
+        const uint8_t* ek, size_t ek_size,
+        const uint8_t* pk, size_t pk_size) const;
+
+    void recoverPublicKey(
+        uint8_t* qx,      size_t qx_size,
+        uint8_t* qy,      size_t qy_size,
+        const uint8_t* r, size_t r_size,
+        const uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        uint32_t v) const;
+
     int32_t verifySignature(
         const uint8_t* r, size_t r_size,
         const uint8_t* s, size_t s_size,
@@ -39,19 +76,216 @@ public:
         const uint8_t* qx, size_t qx_size,
         const uint8_t* qy, size_t qy_size) const;
 
+    void generateSignatures(
+        uint8_t* r,        size_t r_size,
+        uint8_t* s,        size_t s_size,
+        const uint8_t* h,  size_t h_size,
+        const uint8_t* ek, size_t ek_size,
+        const uint8_t* pk, size_t pk_size,
+        size_t count) const;
+
+    void verifySignatures(
+        int32_t* results,
+        const uint8_t* r, size_t r_size,
+        const uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* qx, size_t qx_size,
+        const uint8_t* qy, size_t qy_size,
+        size_t count) const;
+
+    // The same batches on arrays left where independent requests keep them, r[i] being the address of the i-th r
+    // and so on, so that they are neither gathered nor copied.
+
+    void generateSignatures(
+        uint8_t* const* r,        size_t r_size,
+        uint8_t* const* s,        size_t s_size,
+        const uint8_t* const* h,  size_t h_size,
+        const uint8_t* const* ek, size_t ek_size,
+        const uint8_t* const* pk, size_t pk_size,
+        size_t count) const;
+
+    void verifySignatures(
+        int32_t* results,
+        const uint8_t* const* r,  size_t r_size,
+        const uint8_t* const* s,  size_t s_size,
+        const uint8_t* const* h,  size_t h_size,
+        const uint8_t* const* qx, size_t qx_size,
+        const uint8_t* const* qy, size_t qy_size,
+        size_t count) const;
+
+    // The message methods hash the messages with SHA-256 and sign or verify the digests.
+    // The messages of a batch are stored one after the other, m_sizes giving their byte sizes.
+
+    void signMessage(
+        uint8_t* r,        size_t r_size,
+        uint8_t* s,        size_t s_size,
+        const uint8_t* m,  size_t m_size,
+        const uint8_t* ek, size_t ek_size,
+        const uint8_t* pk, size_t pk_size) const;
+
+    int32_t verifyMessage(
+        const uint8_t* r, size_t r_size,
+        const uint8_t* s, size_t s_size,
+        const uint8_t* m, size_t m_size,
+        const uint8_t* qx, size_t qx_size,
+        const uint8_t* qy, size_t qy_size) const;
+
+    void signMessages(
+        uint8_t* r,        size_t r_size,
+        uint8_t* s,        size_t s_size,
+        const uint8_t* m,  const uint32_t* m_sizes,
+        const uint8_t* ek, size_t ek_size,
+        const uint8_t* pk, size_t pk_size,
+        size_t count) const;
+
+    void verifyMessages(
+        int32_t* results,
+        const uint8_t* r, size_t r_size,
+        const uint8_t* s, size_t s_size,
+        const uint8_t* m, const uint32_t* m_sizes,
+        const uint8_t* qx, size_t qx_size,
+        const uint8_t* qy, size_t qy_size,
+        size_t count) const;
+
+    // SEC1 encodings of the public keys: 0x02 or 0x03 and qx when compressed, 0x04, qx and qy otherwise.
+    // The decoding checks that the key is on the curve, recovering qy from qx with a square root.
+
+    uint32_t encodePublicKey(
+        uint8_t* q,        size_t q_size,
+        const uint8_t* qx, size_t qx_size,
+        const uint8_t* qy, size_t qy_size,
+        bool compressed) const;
+
+    void decodePublicKey(
+        uint8_t* qx,      size_t qx_size,
+        uint8_t* qy,      size_t qy_size,
+        const uint8_t* q, size_t q_size) const;
+
+    void decodePublicKeys(
+        int32_t* results,
+        uint8_t* qx,      size_t qx_size,
+        uint8_t* qy,      size_t qy_size,
+        const uint8_t* q, size_t q_size,
+        size_t count) const;
+
+    // Signature encodings: DER, the ASN.1 SEQUENCE of the INTEGERs r and s, of at most 2 * getPrimeByteLength() + 8 bytes,
+    // and compact, r and s on getPrimeByteLength() bytes each (64 bytes for the 256-bit curves).
+    // The DER signatures of a batch are stored one after the other, der_sizes giving their byte sizes.
+
+    uint32_t encodeSignatureDer(
+        uint8_t* der,     size_t der_size,
+        const uint8_t* r, size_t r_size,
+        const uint8_t* s, size_t s_size) const;
+
+    void decodeSignatureDer(
+        uint8_t* r,         size_t r_size,
+        uint8_t* s,         size_t s_size,
+        const uint8_t* der, size_t der_size) const;
+
+    uint32_t encodeSignatureCompact(
+        uint8_t* c,       size_t c_size,
+        const uint8_t* r, size_t r_size,
+        const uint8_t* s, size_t s_size) const;
+
+    void decodeSignatureCompact(
+        uint8_t* r,       size_t r_size,
+        uint8_t* s,       size_t s_size,
+        const uint8_t* c, size_t c_size) const;
+
+    uint32_t encodeSignaturesDer(
+        uint32_t* der_sizes,
+        uint8_t* der,     size_t der_size,
+        const uint8_t* r, size_t r_size,
+        const uint8_t* s, size_t s_size,
+        size_t count) const;
+
+    void decodeSignaturesDer(
+        int32_t* results,
+        uint8_t* r,         size_t r_size,
+        uint8_t* s,         size_t s_size,
+        const uint8_t* der, const uint32_t* der_sizes,
+        size_t count) const;
+
+    void encodeSignaturesCompact(
+        uint8_t* c,       size_t c_size,
+        const uint8_t* r, size_t r_size,
+        const uint8_t* s, size_t s_size,
+        size_t count) const;
+
+    void decodeSignaturesCompact(
+        uint8_t* r,       size_t r_size,
+        uint8_t* s,       size_t s_size,
+        const uint8_t* c, size_t c_size,
+        size_t count) const;
+
+    void verifySignaturesDer(
+        int32_t* results,
+        const uint8_t* der, const uint32_t* der_sizes,
+        const uint8_t* h,   size_t h_size,
+        const uint8_t* qx,  size_t qx_size,
+        const uint8_t* qy,  size_t qy_size,
+        size_t count) const;
+
+    // Compressed schema: the signature is r and s on 2 * getPrimeByteLength() bytes, the recovery id, 0 or 1,
+    // in the top bit of s which the low s leaves free, and the key is stored as the first k_size bytes,
+    // MIN_COMPRESSION to MAX_COMPRESSION, of the SHA-256 digest of its SEC1 compressed encoding.
+    // The verification recovers the key from the signature and compares the digests.
+
+    // the ephemeral key is drawn from the generator of the calling thread, again until the recovery id is 0 or 1
+    uint32_t generateCompressedSignature(
+        uint8_t* c,        size_t c_size,
+        const uint8_t* h,  size_t h_size,
+        const uint8_t* pk, size_t pk_size) const;
+
+    uint32_t encodeCompressedSignature(
+        uint8_t* c,       size_t c_size,
+        const uint8_t* r, size_t r_size,
+        const uint8_t* s, size_t s_size,
+        uint32_t v) const;
+
+    uint32_t decodeCompressedSignature(
+        uint8_t* r,       size_t r_size,
+        uint8_t* s,       size_t s_size,
+        const uint8_t* c, size_t c_size) const;
+
+    void encodeCompressedKey(
+        uint8_t* k,        size_t k_size,
+        const uint8_t* qx, size_t qx_size,
+        const uint8_t* qy, size_t qy_size) const;
+
+    int32_t verifyCompressedSignature(
+        const uint8_t* c, size_t c_size,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* k, size_t k_size) const;
+
+    void verifyCompressedSignatures(
+        int32_t* results,
+        const uint8_t* c, size_t c_size,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* k, size_t k_size,
+        size_t count) const;
+
 private:
+    // the ciphers are the process-wide ones of ec_shared_cipher, so that an EcCipher is only a handle
     variant<
-        ec_fp_secp112r1<>,
-        ec_fp_secp112r2<>,
-        ec_fp_secp128r1<>,
-        ec_fp_secp128r2<>,
-        ec_fp_secp160k1<>,
-        ec_fp_secp160r1<>,
-        ec_fp_secp192k1<>,
-        ec_fp_secp192r1<>,
-        ec_fp_secp256k1<>,
-        ec_fp_secp256r1<>
+        const ec_fp_secp112r1<>*,
+        const ec_fp_secp112r2<>*,
+        const ec_fp_secp128r1<>*,
+        const ec_fp_secp128r2<>*,
+        const ec_fp_secp160k1<>*,
+        const ec_fp_secp160r1<>*,
+        const ec_fp_secp192k1<>*,
+        const ec_fp_secp192r1<>*,
+        const ec_fp_secp256k1<>*,
+        const ec_fp_secp256r1<>*
     > cipher_;
+    uint32_t curve_;
+
+    template <class C>
+    void bind()
+    {
+        cipher_.emplace<const C*>(&ec_shared_cipher<C>());
+    }
 };
 
 }
@@ -0,0 +1,254 @@
+#include <algorithm>
+#include <stdexcept>
+#include "lcfr/arch/trace.h"
+#include "cipher_ring.h"
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace lcfr {
+
+namespace {
+
+// requests of the same group are batched together
+bool same_group(const EcCipherRing::Request& a, const EcCipherRing::Request& b)
+{
+    return a.opcode == b.opcode && a.r_size == b.r_size && a.s_size == b.s_size &&
+        a.h_size == b.h_size && a.k1_size == b.k1_size && a.k2_size == b.k2_size;
+}
+
+bool group_less(const EcCipherRing::Request& a, const EcCipherRing::Request& b)
+{
+    if (a.opcode != b.opcode) return a.opcode < b.opcode;
+    if (a.r_size != b.r_size) return a.r_size < b.r_size;
+    if (a.s_size != b.s_size) return a.s_size < b.s_size;
+    if (a.h_size != b.h_size) return a.h_size < b.h_size;
+    if (a.k1_size != b.k1_size) return a.k1_size < b.k1_size;
+    return a.k2_size < b.k2_size;
+}
+
+// the addresses of a field of the requests of a group
+template <class P>
+void collect(P* to, const EcCipherRing::Request* batch, const uint32_t* group, uint32_t count,
+    P EcCipherRing::Request::* field)
+{
+    for (uint32_t i = 0; i < count; i++) to[i] = batch[group[i]].*field;
+}
+
+}
+
+EcCipherRing::EcCipherRing(const EcCipher* cipher, uint32_t entries)
+    : cipher_(cipher),
+      entries_(entries),
+      sq_head_(0),
+      sq_count_(0),
+      cq_head_(0),
+      cq_count_(0),
+      inflight_(0),
+      stop_(false),
+      event_fd_(-1)
+{
+    if (entries == 0) throw std::runtime_error("invalid ring size");
+    sq_.reset(new Request[entries]);
+    batch_.reset(new Request[entries]);
+    results_.reset(new Completion[entries]);
+    order_.reset(new uint32_t[entries]);
+    outputs_.reset(new uint8_t*[2 * (size_t)entries]);
+    inputs_.reset(new const uint8_t*[3 * (size_t)entries]);
+    verified_.reset(new int32_t[entries]);
+    cq_.reset(new Completion[entries]);
+#ifdef __linux__
+    event_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (event_fd_ < 0) throw std::runtime_error("eventfd creation failed");
+#endif
+    dispatcher_ = std::thread(&EcCipherRing::dispatch, this);
+}
+
+EcCipherRing::~EcCipherRing()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    submitted_.notify_all();
+    dispatcher_.join();
+#ifdef __linux__
+    close(event_fd_);
+#endif
+}
+
+uint32_t EcCipherRing::submit(const Request* requests, uint32_t count)
+{
+    uint32_t accepted = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // every accepted request owns a completion slot until it is polled, so the queue never overflows
+        accepted = entries_ - inflight_ < count ? entries_ - inflight_ : count;
+        for (uint32_t i = 0; i < accepted; i++)
+        {
+            sq_[(sq_head_ + sq_count_) % entries_] = requests[i];
+            sq_count_++;
+        }
+        inflight_ += accepted;
+    }
+    if (accepted > 0) submitted_.notify_one();
+    LCFR_TRACE3(ring_submit, cipher_->getCurveIndex(), count, accepted);
+    return accepted;
+}
+
+uint32_t EcCipherRing::poll(Completion* completions, uint32_t capacity)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint32_t n = cq_count_ < capacity ? cq_count_ : capacity;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        completions[i] = cq_[cq_head_];
+        cq_head_ = (cq_head_ + 1) % entries_;
+    }
+    cq_count_ -= n;
+    inflight_ -= n;
+    return n;
+}
+
+uint32_t EcCipherRing::wait(Completion* completions, uint32_t capacity, uint32_t minComplete)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (minComplete > capacity) minComplete = capacity;
+        if (minComplete > inflight_) minComplete = inflight_;
+        completed_.wait(lock, [&]{ return cq_count_ >= minComplete; });
+    }
+    return poll(completions, capacity);
+}
+
+int32_t EcCipherRing::getEventFd() const
+{
+    return event_fd_;
+}
+
+void EcCipherRing::execute(uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) order_[i] = i;
+    const Request* batch = batch_.get();
+    std::stable_sort(order_.get(), order_.get() + count,
+        [batch](uint32_t a, uint32_t b) { return group_less(batch[a], batch[b]); });
+    for (uint32_t begin = 0, end; begin < count; begin = end)
+    {
+        for (end = begin + 1; end < count && same_group(batch[order_[begin]], batch[order_[end]]); end++);
+        execute_group(order_.get() + begin, end - begin);
+    }
+}
+
+// a group failing as a whole, for example on a key too long, runs again request by request to find the invalid ones
+void EcCipherRing::execute_group(const uint32_t* group, uint32_t count)
+{
+    const Request& q = batch_[group[0]];
+    if ((q.opcode != SIGN && q.opcode != VERIFY) || count == 1)
+    {
+        for (uint32_t i = 0; i < count; i++) execute_one(group[i]);
+        return;
+    }
+
+    uint8_t** r = outputs_.get();
+    uint8_t** s = r + count;
+    const uint8_t** h = inputs_.get();
+    const uint8_t** k1 = h + count;
+    const uint8_t** k2 = k1 + count;
+    collect(r, batch_.get(), group, count, &Request::r);
+    collect(s, batch_.get(), group, count, &Request::s);
+    collect(h, batch_.get(), group, count, &Request::hash);
+    collect(k1, batch_.get(), group, count, &Request::k1);
+    collect(k2, batch_.get(), group, count, &Request::k2);
+    try
+    {
+        if (q.opcode == SIGN)
+        {
+            cipher_->generateSignatures(
+                r, q.r_size, s, q.s_size, h, q.h_size, k1, q.k1_size, k2, q.k2_size, count);
+        }
+        else
+        {
+            cipher_->verifySignatures(
+                verified_.get(), r, q.r_size, s, q.s_size, h, q.h_size, k1, q.k1_size, k2, q.k2_size, count);
+        }
+    }
+    catch (const std::exception&)
+    {
+        for (uint32_t i = 0; i < count; i++) execute_one(group[i]);
+        return;
+    }
+    for (uint32_t i = 0; i < count; i++)
+    {
+        Completion& c = results_[group[i]];
+        c.userData = batch_[group[i]].userData;
+        c.result = q.opcode == VERIFY ? verified_[i] : 0;
+        c.status = 0;
+    }
+}
+
+void EcCipherRing::execute_one(uint32_t i)
+{
+    Request& q = batch_[i];
+    int32_t result = 0;
+    uint32_t status = 0;
+    try
+    {
+        if (q.opcode == SIGN)
+        {
+            cipher_->generateSignature(
+                q.r, q.r_size, q.s, q.s_size, q.hash, q.h_size, q.k1, q.k1_size, q.k2, q.k2_size);
+        }
+        else if (q.opcode == VERIFY)
+        {
+            result = cipher_->verifySignature(
+                q.r, q.r_size, q.s, q.s_size, q.hash, q.h_size, q.k1, q.k1_size, q.k2, q.k2_size);
+        }
+        else status = 1;
+    }
+    catch (const std::exception&)
+    {
+        status = 1;
+    }
+    Completion& c = results_[i];
+    c.userData = q.userData;
+    c.result = result;
+    c.status = status;
+}
+
+void EcCipherRing::dispatch()
+{
+    for (;;)
+    {
+        uint32_t n;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            submitted_.wait(lock, [&]{ return stop_ || (sq_count_ > 0); });
+            if (stop_) return;
+            n = sq_count_;
+            for (uint32_t i = 0; i < n; i++) batch_[i] = sq_[(sq_head_ + i) % entries_];
+            sq_head_ = (sq_head_ + n) % entries_;
+            sq_count_ = 0;
+        }
+
+        LCFR_TRACE2(ring_batch__entry, cipher_->getCurveIndex(), n);
+        execute(n);
+        LCFR_TRACE2(ring_batch__return, cipher_->getCurveIndex(), n);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (uint32_t i = 0; i < n; i++)
+                cq_[(cq_head_ + cq_count_ + i) % entries_] = results_[i];
+            cq_count_ += n;
+        }
+        completed_.notify_all();
+#ifdef __linux__
+        uint64_t signal = n;
+        ssize_t written = write(event_fd_, &signal, sizeof(signal));
+        (void)written;
+#endif
+    }
+}
+
+}
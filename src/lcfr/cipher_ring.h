@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "lcfr/cipher.h"
+
+namespace lcfr {
+
+/** Asynchronous submission/completion queue pair executing requests on an EcCipher.
+* Requests refer to buffers owned by the caller, which must stay valid until the request completes.
+* A dispatcher thread drains the submission queue taking every pending request at once,
+* so that the batch size follows the load. The drained requests are grouped by opcode and sizes,
+* and each group runs as one generateSignatures or verifySignatures batch on the arrays of the requests,
+* which are never copied.
+*/
+class EcCipherRing
+{
+public:
+    enum Opcode : uint32_t
+    {
+        SIGN = 1,
+        VERIFY = 2
+    };
+
+    struct Request
+    {
+        uint64_t       userData;
+        uint32_t       opcode;
+        uint32_t       r_size;
+        uint32_t       s_size;
+        uint32_t       h_size;
+        uint32_t       k1_size;
+        uint32_t       k2_size;
+        uint8_t*       r;
+        uint8_t*       s;
+        const uint8_t* hash;
+        const uint8_t* k1;
+        const uint8_t* k2;
+    };
+
+    struct Completion
+    {
+        uint64_t userData;
+        int32_t  result;
+        uint32_t status;
+    };
+
+    EcCipherRing(const EcCipher* cipher, uint32_t entries);
+    ~EcCipherRing();
+
+    EcCipherRing(const EcCipherRing&) = delete;
+    EcCipherRing& operator = (const EcCipherRing&) = delete;
+
+    uint32_t submit(const Request* requests, uint32_t count);
+    uint32_t poll(Completion* completions, uint32_t capacity);
+    uint32_t wait(Completion* completions, uint32_t capacity, uint32_t minComplete);
+    int32_t getEventFd() const;
+
+private:
+    void execute(uint32_t count);
+    void execute_group(const uint32_t* group, uint32_t count);
+    void execute_one(uint32_t i);
+    void dispatch();
+
+    const EcCipher*               cipher_;
+    uint32_t                      entries_;
+    std::unique_ptr<Request[]>    sq_;
+    std::unique_ptr<Request[]>    batch_;
+    std::unique_ptr<Completion[]> results_;
+    std::unique_ptr<uint32_t[]>   order_;
+    std::unique_ptr<uint8_t*[]>   outputs_;        // the addresses of the r and s of a group
+    std::unique_ptr<const uint8_t*[]> inputs_;     // the addresses of the hash, k1 and k2 of a group
+    std::unique_ptr<int32_t[]>    verified_;
+    std::unique_ptr<Completion[]> cq_;
+    uint32_t                      sq_head_;
+    uint32_t                      sq_count_;
+    uint32_t                      cq_head_;
+    uint32_t                      cq_count_;
+    uint32_t                      inflight_;
+    bool                          stop_;
+    int                           event_fd_;
+
+    std::mutex                    mutex_;
+    std::condition_variable       submitted_;
+    std::condition_variable       completed_;
+    std::thread                   dispatcher_;
+};
+
+}
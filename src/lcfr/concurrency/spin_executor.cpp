@@ -0,0 +1,135 @@
+#include "lcfr/concurrency/spin_executor.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace lcfr {
+
+namespace {
+
+const unsigned SPIN_COUNT = 1u << 16;
+
+void cpu_relax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+void pin_current_thread(size_t cpu)
+{
+#ifdef __linux__
+    unsigned n = std::thread::hardware_concurrency();
+    if (n == 0) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % n, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+std::mutex configure_mutex_;
+
+}
+
+std::shared_ptr<spin_executor::helper_set> spin_executor::helpers_;
+
+spin_helper::spin_helper(bool pinning, size_t cpu)
+    : state_(IDLE),
+      sleeping_(false),
+      function_(nullptr),
+      context_(nullptr)
+{
+    thread_ = std::thread(&spin_helper::main, this, pinning, cpu);
+}
+
+spin_helper::~spin_helper()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        state_.store(STOP);
+    }
+    wake_.notify_one();
+    thread_.join();
+}
+
+bool spin_helper::try_acquire()
+{
+    uint32_t expected = IDLE;
+    return state_.compare_exchange_strong(expected, ACQUIRED, std::memory_order_acquire);
+}
+
+void spin_helper::post(function f, void* context)
+{
+    function_ = f;
+    context_ = context;
+    state_.store(POSTED);
+    if (sleeping_.load())
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        wake_.notify_one();
+    }
+}
+
+void spin_helper::join()
+{
+    while (state_.load(std::memory_order_acquire) != DONE) cpu_relax();
+    state_.store(IDLE, std::memory_order_release);
+}
+
+void spin_helper::main(bool pinning, size_t cpu)
+{
+    if (pinning) pin_current_thread(cpu);
+
+    for (;;)
+    {
+        uint32_t state = state_.load(std::memory_order_acquire);
+        for (unsigned spin = 0; (state != POSTED) && (state != STOP) && (spin < SPIN_COUNT); spin++)
+        {
+            cpu_relax();
+            state = state_.load(std::memory_order_acquire);
+        }
+
+        if ((state != POSTED) && (state != STOP))
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            sleeping_.store(true);
+            wake_.wait(lock, [&]{ state = state_.load(); return (state == POSTED) || (state == STOP); });
+            sleeping_.store(false);
+        }
+
+        if (state == STOP) return;
+
+        function_(context_);
+        state_.store(DONE, std::memory_order_release);
+    }
+}
+
+void spin_executor::configure(size_t helpers, bool pinning)
+{
+    std::lock_guard<std::mutex> lock(configure_mutex_);
+    // a spinning helper sharing the cpu with the caller only delays it
+    size_t cpus = std::thread::hardware_concurrency();
+    if ((cpus > 0) && (helpers > cpus - 1)) helpers = cpus - 1;
+
+    std::shared_ptr<helper_set> set;
+    if (helpers > 0)
+    {
+        set = std::make_shared<helper_set>();
+        for (size_t i = 0; i < helpers; i++)
+            set->emplace_back(new spin_helper(pinning, i));
+    }
+    std::atomic_store(&helpers_, set);
+}
+
+spin_helper* spin_executor::acquire(helper_set& set)
+{
+    for (auto& h : set) if (h->try_acquire()) return h.get();
+    return nullptr;
+}
+
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lcfr {
+
+/** Pre-spawned thread executing one function at a time, handed over through spin-waiting.
+* After each job the thread keeps spinning for a while before going to sleep,
+* so that back-to-back jobs are started without a kernel round trip.
+*/
+class spin_helper
+{
+public:
+    typedef void (*function)(void* context);
+
+    spin_helper(bool pinning, size_t cpu);
+    ~spin_helper();
+
+    spin_helper(const spin_helper&) = delete;
+    spin_helper& operator = (const spin_helper&) = delete;
+
+    /**
+      Reserve the helper for the calling thread.
+      \return false if the helper is serving another thread
+    */
+    bool try_acquire();
+
+    /**
+      Start the function on the helper thread, the helper must have been acquired.
+    */
+    void post(function f, void* context);
+
+    /**
+      Wait for the posted function to return and release the helper.
+    */
+    void join();
+
+private:
+    enum : uint32_t { IDLE, ACQUIRED, POSTED, DONE, STOP };
+
+    void main(bool pinning, size_t cpu);
+
+    std::atomic<uint32_t>   state_;
+    std::atomic<bool>       sleeping_;
+    function                function_;
+    void*                   context_;
+    std::mutex              mutex_;
+    std::condition_variable wake_;
+    std::thread             thread_;
+};
+
+/** Set of helpers used to run the two halves of an operation in parallel.
+*/
+class spin_executor
+{
+public:
+    /**
+      \param helpers the number of helper threads, 0 disables the parallel execution
+      \param pinning if true each helper thread is bound to a distinct cpu
+    */
+    static void configure(size_t helpers, bool pinning);
+
+    /**
+      Run a and b, in parallel if a helper is idle, else one after the other on the calling thread.
+    */
+    template <class A, class B>
+    static void invoke(A& a, B& b)
+    {
+        auto set = std::atomic_load(&helpers_);
+        spin_helper* h = set ? acquire(*set) : nullptr;
+        if (h == nullptr)
+        {
+            a();
+            b();
+            return;
+        }
+        struct joiner
+        {
+            spin_helper* h;
+            ~joiner() { h->join(); }
+        } j = { h };
+        h->post(&thunk<A>, &a);
+        b();
+    }
+
+private:
+    typedef std::vector<std::unique_ptr<spin_helper>> helper_set;
+
+    template <class F>
+    static void thunk(void* f)
+    {
+        (*reinterpret_cast<F*>(f))();
+    }
+
+    static spin_helper* acquire(helper_set& set);
+
+    static std::shared_ptr<helper_set> helpers_;
+};
+
+}
@@ -0,0 +1,159 @@
+#include <new>
+#include "lcfr/concurrency/thread_pool.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace lcfr {
+
+namespace {
+
+const unsigned SPIN_COUNT = 4096;
+
+void pin_current_thread(size_t cpu)
+{
+#ifdef __linux__
+    unsigned n = std::thread::hardware_concurrency();
+    if (n == 0) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % n, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+}
+
+thread_pool::thread_pool(size_t concurrency, bool pinning, size_t scratch_size)
+    : slot_count_(concurrency > 0 ? concurrency : 1),
+      memory_(nullptr),
+      slots_(nullptr),
+      generation_(0),
+      active_(0),
+      stop_(false),
+      task_(nullptr),
+      context_(nullptr),
+      grain_(1)
+{
+    size_t scratch_stride = ((scratch_size + CACHE_LINE - 1) / CACHE_LINE) * CACHE_LINE;
+    memory_ = new uint8_t[slot_count_ * (SLOT_STRIDE + scratch_stride) + CACHE_LINE];
+    slots_ = memory_ + (CACHE_LINE - uintptr_t(memory_) % CACHE_LINE) % CACHE_LINE;
+    uint8_t* scratch_base = slots_ + slot_count_ * SLOT_STRIDE;
+    for (size_t i = 0; i < slot_count_; i++)
+    {
+        slot* s = new(slots_ + i * SLOT_STRIDE) slot;
+        s->next.store(0, std::memory_order_relaxed);
+        s->end = 0;
+        s->scratch_.data = scratch_base + i * scratch_stride;
+        s->scratch_.size = scratch_size;
+    }
+
+    workers_.reserve(slot_count_ - 1);
+    for (size_t i = 1; i < slot_count_; i++)
+        workers_.emplace_back(&thread_pool::worker_main, this, i, pinning);
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        generation_.fetch_add(1, std::memory_order_release);
+    }
+    wake_.notify_all();
+    for (auto& w : workers_) w.join();
+    for (size_t i = 0; i < slot_count_; i++) slot_at(i).~slot();
+    delete[] memory_;
+}
+
+void thread_pool::run(task t, void* context, size_t count, size_t grain)
+{
+    if (count == 0) return;
+    if (grain == 0) grain = 1;
+
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+    for (size_t i = 0; i < slot_count_; i++)
+    {
+        slot& s = slot_at(i);
+        s.next.store(count * i / slot_count_, std::memory_order_relaxed);
+        s.end = count * (i + 1) / slot_count_;
+    }
+    task_ = t;
+    context_ = context;
+    grain_ = grain;
+    error_ = nullptr;
+    active_.store(slot_count_ - 1, std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        generation_.fetch_add(1, std::memory_order_release);
+    }
+    wake_.notify_all();
+
+    execute(0);
+
+    for (unsigned spin = 0; active_.load(std::memory_order_acquire) != 0; spin++)
+        if (spin >= SPIN_COUNT) std::this_thread::yield();
+
+    if (error_) std::rethrow_exception(error_);
+}
+
+void thread_pool::worker_main(size_t index, bool pinning)
+{
+    if (pinning) pin_current_thread(index);
+
+    uint64_t seen = 0;
+    for (;;)
+    {
+        uint64_t current = generation_.load(std::memory_order_acquire);
+        for (unsigned spin = 0; (current == seen) && (spin < SPIN_COUNT); spin++)
+            current = generation_.load(std::memory_order_acquire);
+
+        if (current == seen)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&]{ return generation_.load(std::memory_order_acquire) != seen; });
+            current = generation_.load(std::memory_order_acquire);
+        }
+        seen = current;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stop_) return;
+        }
+
+        execute(index);
+        active_.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+void thread_pool::execute(size_t index)
+{
+    const scratch& own = slot_at(index).scratch_;
+    try
+    {
+        for (size_t k = 0; k < slot_count_; k++)
+        {
+            slot& victim = slot_at((index + k) % slot_count_);
+            for (;;)
+            {
+                size_t begin = victim.next.fetch_add(grain_, std::memory_order_relaxed);
+                if (begin >= victim.end) break;
+                size_t end = begin + grain_ < victim.end ? begin + grain_ : victim.end;
+                task_(context_, begin, end, own);
+            }
+        }
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        if (!error_) error_ = std::current_exception();
+    }
+}
+
+}
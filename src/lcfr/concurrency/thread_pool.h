@@ -0,0 +1,98 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lcfr {
+
+/** Work-stealing pool of threads processing index ranges.
+* Each participant (the calling thread and every worker) owns a contiguous slice of the range
+* and claims fixed-size chunks from it; a participant that exhausted its own slice steals chunks
+* from the slices of the others. Every participant owns a preallocated scratch buffer, so running
+* a job does not allocate memory.
+*/
+class thread_pool
+{
+public:
+    static const size_t DEFAULT_SCRATCH_SIZE = 64 * 1024;
+
+    struct scratch
+    {
+        uint8_t* data;
+        size_t   size;
+    };
+
+    typedef void (*task)(void* context, size_t begin, size_t end, const scratch& s);
+
+    /**
+      \param concurrency the number of threads processing a job, the calling thread included
+      \param pinning if true each worker thread is bound to a distinct cpu
+      \param scratch_size the byte size of the scratch buffer of each participant
+    */
+    thread_pool(size_t concurrency, bool pinning, size_t scratch_size = DEFAULT_SCRATCH_SIZE);
+    ~thread_pool();
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator = (const thread_pool&) = delete;
+
+    /**
+      \return the number of threads processing a job, the calling thread included
+    */
+    size_t concurrency() const
+    {
+        return slot_count_;
+    }
+
+    /**
+      Process the range [0, count) calling the task on chunks of at most grain indexes.
+      The calling thread takes part to the job and the method returns when the whole range is processed.
+      Jobs submitted concurrently by different threads are executed one after another.
+    */
+    void run(task t, void* context, size_t count, size_t grain);
+
+private:
+    struct slot
+    {
+        std::atomic<size_t> next;
+        size_t              end;
+        scratch             scratch_;
+    };
+
+    slot& slot_at(size_t i) const
+    {
+        return *reinterpret_cast<slot*>(slots_ + i * SLOT_STRIDE);
+    }
+
+    void worker_main(size_t index, bool pinning);
+    void execute(size_t index);
+
+    static const size_t CACHE_LINE = 64;
+    static const size_t SLOT_STRIDE = ((sizeof(slot) + CACHE_LINE - 1) / CACHE_LINE) * CACHE_LINE;
+
+    size_t                   slot_count_;
+    uint8_t*                 memory_;
+    uint8_t*                 slots_;
+    std::vector<std::thread> workers_;
+
+    std::mutex               run_mutex_;
+    std::mutex               mutex_;
+    std::condition_variable  wake_;
+    std::atomic<uint64_t>    generation_;
+    std::atomic<size_t>      active_;
+    bool                     stop_;
+
+    task                     task_;
+    void*                    context_;
+    size_t                   grain_;
+
+    std::mutex               error_mutex_;
+    std::exception_ptr       error_;
+};
+
+}
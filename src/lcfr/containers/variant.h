@@ -43,12 +43,25 @@ struct max_size_of<X> {
     static const size_t size = sizeof(X);
 };
 
+template <typename... Ts>
+struct max_align_of;
+
+template <typename X, typename... Ts>
+struct max_align_of<X, Ts...> {
+    static const size_t align = (alignof(X) > max_align_of<Ts...>::align) ? alignof(X) : max_align_of<Ts...>::align;
+};
+
+template <typename X>
+struct max_align_of<X> {
+    static const size_t align = alignof(X);
+};
+
 template<int N, typename... Ts>
 struct deleter;
 
 template<int N>
 struct deleter<N> {
-    static void execute(int n, const void* ptr) {}
+    static void execute(int, const void*) {}
 };
 
 template<int N, typename T, typename... Ts>
@@ -65,7 +78,7 @@ struct copy_constructor;
 
 template<int N>
 struct copy_constructor<N> {
-    static void execute(int n, char* obj, const char* other) {}
+    static void execute(int, char*, const char*) {}
 };
 
 template<int N, typename T, typename... Ts>
@@ -82,7 +95,7 @@ struct move_constructor;
 
 template<int N>
 struct move_constructor<N> {
-    static void execute(int n, char* obj, char* other) {}
+    static void execute(int, char*, char*) {}
 };
 
 template<int N, typename T, typename... Ts>
@@ -99,7 +112,7 @@ struct caster;
 
 template<typename B>
 struct caster<B> {
-    static const B* execute(int n, const void* ptr) { throw std::bad_cast(); }
+    static const B* execute(int, const void*) { throw std::bad_cast(); }
 };
 
 template<typename B, typename T, typename... Ts>
@@ -116,6 +129,12 @@ struct caster<B, T, Ts...> {
 };
 
 
+template <typename R, typename F, typename T>
+struct visitor {
+    static R execute(F& f, char* ptr) { return f(*reinterpret_cast<T*>(ptr)); }
+    static R execute_const(F& f, const char* ptr) { return f(*reinterpret_cast<const T*>(ptr)); }
+};
+
 template <int N, typename... Ts>
 struct type_at;
 
@@ -202,6 +221,30 @@ public:
         else return *const_cast<T*>(variant_detail::caster<T, Ts...>::execute(which_, u_.data_));
     }
 
+    /**
+      Call f with the stored object as its concrete type, through a table indexed by the type index,
+      so that f is instantiated (and can be inlined) for each type. The result type is the one of the first type.
+    */
+    template <typename F>
+    typename std::result_of<F&(typename variant_detail::type_at<0, Ts...>::result&)>::type visit(F&& f)
+    {
+        typedef typename std::result_of<F&(typename variant_detail::type_at<0, Ts...>::result&)>::type R;
+        typedef R (*thunk)(F&, char*);
+        static const thunk table[] = { &variant_detail::visitor<R, F, Ts>::execute... };
+        if (which_ < 0) throw std::bad_cast();
+        return table[which_](f, u_.data_);
+    }
+
+    template <typename F>
+    typename std::result_of<F&(const typename variant_detail::type_at<0, Ts...>::result&)>::type visit(F&& f) const
+    {
+        typedef typename std::result_of<F&(const typename variant_detail::type_at<0, Ts...>::result&)>::type R;
+        typedef R (*thunk)(F&, const char*);
+        static const thunk table[] = { &variant_detail::visitor<R, F, Ts>::execute_const... };
+        if (which_ < 0) throw std::bad_cast();
+        return table[which_](f, u_.data_);
+    }
+
     template <class T> bool is() const
     {
         return (which_ >= 0) && (which_ == variant_detail::finder<T, Ts...>::index);
@@ -235,6 +278,7 @@ private:
     int which_;
 
     union {
+        alignas(variant_detail::max_align_of<Ts...>::align)
         char    data_[variant_detail::max_size_of<Ts...>::size];
         int32_t dummy_int32_;
         int64_t dummy_int64_;
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "lcfr/crypto/fp.h"
+
+namespace lcfr {
+
+/* Addition chains of the exponents p - 2 (Fermat inversion) and (p + 1) / 4 (square root, every prime
+* being 3 mod 4) of the field primes, see pw_fp::pow. secp128r2 and secp112r2 share the primes of
+* secp128r1 and secp112r1.
+* The chains of the primes with long runs of one bits build a^(2^k - 1) for a short chain of lengths k,
+* then append the runs of the exponent one at a time. The prime of secp112r1 has no such structure and
+* its chains are sliding windows of width 4 over the odd powers a, a^3, ..., a^15.
+*/
+
+// p - 2: 255 squarings, 15 multiplications
+constexpr fp_chain_step SECP256K1_P_INVERSE[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   2,  1 }, {  3,  2,   4,  2 }, {  4,  3,   8,  3 },
+    {  5,  4,   4,  2 }, {  6,  5,   2,  1 }, {  7,  6,  22,  6 }, {  8,  7,   1,  0 },
+    {  9,  8,  44,  7 }, { 10,  9,  89,  9 }, { 11, 10,  45,  8 }, { 12, 11,  23,  6 },
+    { 12, 12,   5,  0 }, { 12, 12,   3,  1 }, { 12, 12,   2,  0 }
+};
+
+// (p + 1) / 4: 253 squarings, 13 multiplications
+constexpr fp_chain_step SECP256K1_P_SQRT[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   2,  1 }, {  3,  2,   4,  2 }, {  4,  3,   8,  3 },
+    {  5,  4,   4,  2 }, {  6,  5,   2,  1 }, {  7,  6,  22,  6 }, {  8,  7,   1,  0 },
+    {  9,  8,  44,  7 }, { 10,  9,  89,  9 }, { 11, 10,  45,  8 }, { 12, 11,  23,  6 },
+    { 12, 12,   6,  1 }, { 12, 12,   2, NO_MULT }
+};
+
+// p - 2: 255 squarings, 13 multiplications
+constexpr fp_chain_step SECP256R1_P_INVERSE[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   2,  1 }, {  3,  2,   4,  2 }, {  4,  3,   8,  3 },
+    {  5,  4,  16,  4 }, {  6,  5,  32,  0 }, {  6,  6, 128,  5 }, {  6,  6,  32,  5 },
+    {  6,  6,  16,  4 }, {  6,  6,   8,  3 }, {  6,  6,   4,  2 }, {  6,  6,   2,  1 },
+    {  6,  6,   2,  0 }
+};
+
+// (p + 1) / 4: 253 squarings, 7 multiplications
+constexpr fp_chain_step SECP256R1_P_SQRT[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   2,  1 }, {  3,  2,   4,  2 }, {  4,  3,   8,  3 },
+    {  5,  4,  16,  4 }, {  6,  5,  32,  0 }, {  6,  6,  96,  0 }, {  6,  6,  94, NO_MULT }
+};
+
+// p - 2: 191 squarings, 15 multiplications
+constexpr fp_chain_step SECP192K1_P_INVERSE[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   1,  0 }, {  3,  2,   3,  2 }, {  4,  3,   2,  1 },
+    {  5,  4,   8,  4 }, {  6,  5,   3,  2 }, {  7,  6,  16,  5 }, {  8,  7,  35,  7 },
+    {  9,  8,  70,  8 }, { 10,  9,  19,  6 }, { 11, 10,  20,  6 }, { 11, 11,   4,  2 },
+    { 11, 11,   5,  1 }, { 11, 11,   2,  0 }, { 11, 11,   2,  0 }
+};
+
+// (p + 1) / 4: 189 squarings, 13 multiplications
+constexpr fp_chain_step SECP192K1_P_SQRT[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   1,  0 }, {  3,  2,   3,  2 }, {  4,  3,   2,  1 },
+    {  5,  4,   8,  4 }, {  6,  5,   3,  2 }, {  7,  6,  16,  5 }, {  8,  7,  35,  7 },
+    {  9,  8,  70,  8 }, { 10,  9,  19,  6 }, { 11, 10,  20,  6 }, { 11, 11,   4,  2 },
+    { 11, 11,   6,  2 }, { 11, 11,   1, NO_MULT }
+};
+
+// p - 2: 191 squarings, 12 multiplications
+constexpr fp_chain_step SECP192R1_P_INVERSE[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   2,  1 }, {  3,  2,   1,  0 }, {  4,  3,   5,  3 },
+    {  5,  4,  10,  4 }, {  6,  5,  20,  5 }, {  7,  6,  20,  5 }, {  8,  7,   2,  1 },
+    {  9,  8,  60,  7 }, { 10,  9,   5,  3 }, { 11, 10,  63,  8 }, { 11, 11,   2,  0 }
+};
+
+// (p + 1) / 4: 189 squarings, 7 multiplications
+constexpr fp_chain_step SECP192R1_P_SQRT[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   2,  1 }, {  3,  2,   4,  2 }, {  4,  3,   8,  3 },
+    {  5,  4,  16,  4 }, {  6,  5,  32,  5 }, {  7,  6,  64,  6 }, {  8,  7,  62, NO_MULT }
+};
+
+// p - 2: 159 squarings, 15 multiplications
+constexpr fp_chain_step SECP160K1_P_INVERSE[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   1,  0 }, {  3,  2,   3,  2 }, {  4,  3,   6,  3 },
+    {  5,  4,   2,  1 }, {  6,  5,   3,  2 }, {  7,  6,  14,  5 }, {  8,  7,  31,  7 },
+    {  9,  8,  62,  8 }, { 10,  9,   3,  2 }, { 11, 10,  18,  6 }, { 11, 11,   2,  0 },
+    { 11, 11,   3,  1 }, { 11, 11,   6,  2 }, { 11, 11,   4,  0 }
+};
+
+// (p + 1) / 4: 157 squarings, 15 multiplications
+constexpr fp_chain_step SECP160K1_P_SQRT[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   1,  0 }, {  3,  2,   3,  2 }, {  4,  3,   6,  3 },
+    {  5,  4,   2,  1 }, {  6,  5,   3,  2 }, {  7,  6,  14,  5 }, {  8,  7,  31,  7 },
+    {  9,  8,  62,  8 }, { 10,  9,   3,  2 }, { 11, 10,  18,  6 }, { 11, 11,   2,  0 },
+    { 11, 11,   3,  1 }, { 11, 11,   6,  2 }, { 11, 11,   2,  0 }
+};
+
+// p - 2: 159 squarings, 12 multiplications
+constexpr fp_chain_step SECP160R1_P_INVERSE[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   2,  1 }, {  3,  2,   4,  2 }, {  4,  3,   8,  3 },
+    {  5,  4,  16,  4 }, {  6,  5,  32,  5 }, {  7,  6,  64,  6 }, {  8,  7,  17,  4 },
+    {  8,  8,   8,  3 }, {  8,  8,   4,  2 }, {  8,  8,   1,  0 }, {  8,  8,   2,  0 }
+};
+
+// (p + 1) / 4: 157 squarings, 8 multiplications
+constexpr fp_chain_step SECP160R1_P_SQRT[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   2,  1 }, {  3,  2,   4,  2 }, {  4,  3,   8,  3 },
+    {  5,  4,  16,  4 }, {  6,  5,  32,  5 }, {  7,  6,  64,  6 }, {  8,  7,   1,  0 },
+    {  9,  8,  29, NO_MULT }
+};
+
+// p - 2: 127 squarings, 11 multiplications
+constexpr fp_chain_step SECP128R1_P_INVERSE[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   2,  1 }, {  3,  2,   1,  0 }, {  4,  3,   5,  3 },
+    {  5,  4,  10,  4 }, {  6,  5,  10,  4 }, {  7,  6,  31,  6 }, {  7,  7,  30,  6 },
+    {  7,  7,  30,  6 }, {  7,  7,   5,  3 }, {  7,  7,   2,  0 }
+};
+
+// (p + 1) / 4: 125 squarings, 7 multiplications
+constexpr fp_chain_step SECP128R1_P_SQRT[] = {
+    {  1,  0,   1,  0 }, {  2,  1,   2,  1 }, {  3,  2,   4,  2 }, {  4,  3,   2,  1 },
+    {  5,  4,  10,  4 }, {  6,  5,  10,  4 }, {  7,  6,   1,  0 }, {  8,  7,  95, NO_MULT }
+};
+
+// p - 2: 109 squarings, 29 multiplications
+constexpr fp_chain_step SECP112R1_P_INVERSE[] = {
+    {  8,  0,   1, NO_MULT }, {  1,  0,   0,  8 }, {  2,  1,   0,  8 }, {  3,  2,   0,  8 },
+    {  4,  3,   0,  8 }, {  5,  4,   0,  8 }, {  6,  5,   0,  8 }, {  7,  6,   0,  8 },
+    {  9,  6,   4,  5 }, {  9,  9,   5,  7 }, {  9,  9,   1,  0 }, {  9,  9,   7,  2 },
+    {  9,  9,   4,  2 }, {  9,  9,   5,  7 }, {  9,  9,   4,  6 }, {  9,  9,   1,  0 },
+    {  9,  9,   7,  5 }, {  9,  9,   1,  0 }, {  9,  9,   7,  6 }, {  9,  9,   5,  7 },
+    {  9,  9,   4,  1 }, {  9,  9,   6,  6 }, {  9,  9,  11,  3 }, {  9,  9,   5,  6 },
+    {  9,  9,   5,  7 }, {  9,  9,   3,  2 }, {  9,  9,   5,  5 }, {  9,  9,   5,  4 },
+    {  9,  9,   6,  0 }, {  9,  9,   7,  4 }
+};
+
+// (p + 1) / 4: 107 squarings, 29 multiplications
+constexpr fp_chain_step SECP112R1_P_SQRT[] = {
+    {  8,  0,   1, NO_MULT }, {  1,  0,   0,  8 }, {  2,  1,   0,  8 }, {  3,  2,   0,  8 },
+    {  4,  3,   0,  8 }, {  5,  4,   0,  8 }, {  6,  5,   0,  8 }, {  7,  6,   0,  8 },
+    {  9,  6,   4,  5 }, {  9,  9,   5,  7 }, {  9,  9,   1,  0 }, {  9,  9,   7,  2 },
+    {  9,  9,   4,  2 }, {  9,  9,   5,  7 }, {  9,  9,   4,  6 }, {  9,  9,   1,  0 },
+    {  9,  9,   7,  5 }, {  9,  9,   1,  0 }, {  9,  9,   7,  6 }, {  9,  9,   5,  7 },
+    {  9,  9,   4,  1 }, {  9,  9,   6,  6 }, {  9,  9,  11,  3 }, {  9,  9,   5,  6 },
+    {  9,  9,   5,  7 }, {  9,  9,   3,  2 }, {  9,  9,   5,  5 }, {  9,  9,   5,  4 },
+    {  9,  9,   6,  0 }, {  9,  9,   5,  1 }
+};
+
+}
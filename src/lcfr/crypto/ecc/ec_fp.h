@@ -1,11 +1,168 @@
 #pragma once
 
+#include <new>
+#include <atomic>
 #include "lcfr/arch/endianness.h"
+#include "lcfr/concurrency/spin_executor.h"
 #include "lcfr/crypto/fp.h"
+#include "lcfr/crypto/ecc/ec_chains.h"
+#include "lcfr/crypto/ecc/ec_lanes.h"
 #include "lcfr/crypto/ecc/ec_point.h"
+#include "lcfr/crypto/random/chacha20_drbg.h"
+#include "lcfr/stats/counters.h"
+#include "lcfr/stats/latency.h"
 
 namespace lcfr {
 
+/** Domain parameters of a curve, as hex strings with the most significant digit first.
+* pr and nr are the reduction constants of p and n used by pw_fp,
+* p_inverse and p_sqrt the addition chains of p - 2 and (p + 1) / 4.
+*/
+struct ec_curve_params
+{
+    const char* name;
+    const char* a;
+    const char* b;
+    const char* gx;
+    const char* gy;
+    const char* p;
+    const char* pr;
+    const char* n;
+    const char* nr;
+    fp_chain    p_inverse;
+    fp_chain    p_sqrt;
+};
+
+constexpr ec_curve_params SECP256K1_PARAMS = {
+    "secp256k1",
+    "0",
+    "7",
+    "79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798",
+    "483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8",
+    "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F", "1000003D1",
+    "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141", "14551231950B75FC4402DA1732FC9BEC0",
+    fp_chain_of(SECP256K1_P_INVERSE), fp_chain_of(SECP256K1_P_SQRT)
+};
+
+constexpr ec_curve_params SECP256R1_PARAMS = {
+    "secp256r1",
+    "FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFC",
+    "5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B",
+    "6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296",
+    "4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5",
+    "FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF", "FFFFFFFFFFFFFFFEFFFFFFFEFFFFFFFEFFFFFFFF0000000000000003",
+    "FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551", "FFFFFFFFFFFFFFFEFFFFFFFF43190552DF1A6C21012FFD85EEDF9BFE",
+    fp_chain_of(SECP256R1_P_INVERSE), fp_chain_of(SECP256R1_P_SQRT)
+};
+
+constexpr ec_curve_params SECP192K1_PARAMS = {
+    "secp192k1",
+    "0",
+    "3",
+    "DB4FF10EC057E9AE26B07D0280B7F4341DA5D1B1EAE06C7D",
+    "9B2F2F6D9C5628A7844163D015BE86344082AA88D95E2F9D",
+    "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFEE37", "1000011C9",
+    "FFFFFFFFFFFFFFFFFFFFFFFE26F2FC170F69466A74DEFD8D", "1D90D03E8F096B9958B210276",
+    fp_chain_of(SECP192K1_P_INVERSE), fp_chain_of(SECP192K1_P_SQRT)
+};
+
+constexpr ec_curve_params SECP192R1_PARAMS = {
+    "secp192r1",
+    "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFC",
+    "64210519E59C80E70FA7E9AB72243049FEB8DEECC146B9B1",
+    "188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012",
+    "07192B95FFC8DA78631011ED6B24CDD573F977A11E794811",
+    "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFF", "10000000000000001",
+    "FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22831", "662107C9EB94364E4B2DD7CF",
+    fp_chain_of(SECP192R1_P_INVERSE), fp_chain_of(SECP192R1_P_SQRT)
+};
+
+constexpr ec_curve_params SECP160K1_PARAMS = {
+    "secp160k1",
+    "0",
+    "7",
+    "3B4C382CE37AA192A4019E763036F4F5DD4D7EBB",
+    "938CF935318FDCED6BC28286531733C3F03C4FEE",
+    "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFAC73", "10000538D",
+    "100000000000000000001B8FA16DFAB9ACA16B6B3", "3FFFFFFFFFFFFFFFFFFF91C17A4815194D7A5253F",
+    fp_chain_of(SECP160K1_P_INVERSE), fp_chain_of(SECP160K1_P_SQRT)
+};
+
+constexpr ec_curve_params SECP160R1_PARAMS = {
+    "secp160r1",
+    "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFFFC",
+    "1C97BEFC54BD7A8B65ACF89F81D4D4ADC565FA45",
+    "4A96B5688EF573284664698968C38BB913CBFC82",
+    "23A628553168947D59DCC912042351377AC5FB32",
+    "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFFFF", "80000001",
+    "100000000000000000001F4C8F927AED3CA752257", "3FFFFFFFFFFFFFFFFFFF82CDC1B6144B0D62B76B3",
+    fp_chain_of(SECP160R1_P_INVERSE), fp_chain_of(SECP160R1_P_SQRT)
+};
+
+constexpr ec_curve_params SECP128R1_PARAMS = {
+    "secp128r1",
+    "FFFFFFFDFFFFFFFFFFFFFFFFFFFFFFFC",
+    "E87579C11079F43DD824993C2CEE5ED3",
+    "161FF7528B899B2D0C28607CA52C5B86",
+    "CF5AC8395BAFEB13C02DA292DDED7A83",
+    "FFFFFFFDFFFFFFFFFFFFFFFFFFFFFFFF", "2000000040000000800000011",
+    "FFFFFFFE0000000075A30D1B9038A115", "2000000038A5CF2EA993B2A87",
+    fp_chain_of(SECP128R1_P_INVERSE), fp_chain_of(SECP128R1_P_SQRT)
+};
+
+constexpr ec_curve_params SECP128R2_PARAMS = {
+    "secp128r2",
+    "D6031998D1B3BBFEBF59CC9BBFF9AEE1",
+    "5EEEFCA380D02919DC2C6558BB6D8A5D",
+    "7B6AA5D85E572983E6FB32A7CDEBC140",
+    "27B6916A894D3AEE7106FE805FC34B44",
+    "FFFFFFFDFFFFFFFFFFFFFFFFFFFFFFFF", "2000000040000000800000011",
+    "3FFFFFFF7FFFFFFFBE0024720613B5A3", "400000008000000141FFDB9101EBB89C",
+    fp_chain_of(SECP128R1_P_INVERSE), fp_chain_of(SECP128R1_P_SQRT)
+};
+
+constexpr ec_curve_params SECP112R1_PARAMS = {
+    "secp112r1",
+    "DB7C2ABF62E35E668076BEAD2088",
+    "659EF8BA043916EEDE8911702B22",
+    "09487239995A5EE76B55F9C2F098",
+    "A89CE5AF8724C0A23E0E0FF77500",
+    "DB7C2ABF62E35E668076BEAD208B", "12A97000000000000000000000000",
+    "DB7C2ABF62E35E7628DFAC6561C5", "12A96FFFFFFFFFFEAB2EA46B3447E",
+    fp_chain_of(SECP112R1_P_INVERSE), fp_chain_of(SECP112R1_P_SQRT)
+};
+
+constexpr ec_curve_params SECP112R2_PARAMS = {
+    "secp112r2",
+    "6127C24C05F38A0AAAF65C0EF02C",
+    "51DEF1815DB5ED74FCC34C85D709",
+    "4BA30AB5E892B4E1649DD0928643",
+    "ADCD46F5882E3747DEF36E956E97",
+    "DB7C2ABF62E35E668076BEAD208B", "12A97000000000000000000000000",
+    "36DF0AAFD8B8D7597CA10520D04B", "4AA5C0000000005741402575BCFC",
+    fp_chain_of(SECP112R1_P_INVERSE), fp_chain_of(SECP112R1_P_SQRT)
+};
+
+
+/** The arrays of a batch: the i-th array is at base + i * size for arrays stored one after the other,
+* or at addresses[i] if addresses is not null, for arrays left where the requests of the batch keep them.
+*/
+template <class P>
+struct batch_arrays
+{
+    P        base;
+    const P* addresses;
+    size_t   size;
+
+    P operator [] (size_t i) const { return addresses ? addresses[i] : base + i * size; }
+
+    // the arrays from the i-th one
+    batch_arrays from(size_t i) const
+    {
+        return addresses ? batch_arrays{ base, addresses + i, size } : batch_arrays{ base + i * size, nullptr, size };
+    }
+};
+
 template <class W = uint32_t>
 class ec_cipher_base
 {
@@ -32,6 +189,59 @@ public:
         const uint8_t* ek, size_t ek_size,
         const uint8_t* pk, size_t pk_size) const = 0;
 
+    virtual void generate_signature_random(
+        uint8_t* r, size_t r_size,
+        uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* pk, size_t pk_size) const = 0;
+
+    // returns the recovery id: the parity of the y of the point of the signature, plus twice the quotient of its x by n
+    virtual unsigned generate_recoverable_signature(
+        uint8_t* r, size_t r_size,
+        uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* ek, size_t ek_size,
+        const uint8_t* pk, size_t pk_size) const = 0;
+
+    // the ephemeral key is drawn by the library, a key whose point has an x of n or more being replaced
+    // by another, so that the recovery id is the parity of y only, 0 or 1
+    virtual unsigned generate_recoverable_signature_random(
+        uint8_t* r, size_t r_size,
+        uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* pk, size_t pk_size) const = 0;
+
+    // false if the signature or the recovery id is invalid
+    virtual bool recover_public_key(
+        uint8_t* qx, size_t qx_size,
+        uint8_t* qy, size_t qy_size,
+        const uint8_t* r, size_t r_size,
+        const uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        unsigned v) const = 0;
+
+    // SEC1 encoding of a point: 0x02 or 0x03 (the parity of y) and x, or 0x04, x and y;
+    // returns the encoding size, 0 if q is too short
+    virtual size_t encode_point(
+        uint8_t* q, size_t q_size,
+        const uint8_t* qx, size_t qx_size,
+        const uint8_t* qy, size_t qy_size,
+        bool compressed) const = 0;
+
+    // false if the encoding is malformed or the point is not on the curve
+    virtual bool decode_point(
+        uint8_t* qx, size_t qx_size,
+        uint8_t* qy, size_t qy_size,
+        const uint8_t* q, size_t q_size) const = 0;
+
+    // results are set to -1 for valid encodings, 0 otherwise
+    virtual void decode_points(
+        int32_t* results,
+        uint8_t* qx, size_t qx_size,
+        uint8_t* qy, size_t qy_size,
+        const uint8_t* q, size_t q_size,
+        size_t count) const = 0;
+
     virtual bool verify_signature(
         const uint8_t* r, size_t r_size,
         const uint8_t* s, size_t s_size,
@@ -39,11 +249,32 @@ public:
         const uint8_t* qx, size_t qx_size,
         const uint8_t* qy, size_t qy_size) const = 0;
 
+    virtual void generate_signatures(
+        uint8_t* r, size_t r_size,
+        uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* ek, size_t ek_size,
+        const uint8_t* pk, size_t pk_size,
+        size_t count) const = 0;
+
+    // results are set to -1 for valid signatures, 0 otherwise
+    virtual void verify_signatures(
+        int32_t* results,
+        const uint8_t* r, size_t r_size,
+        const uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* qx, size_t qx_size,
+        const uint8_t* qy, size_t qy_size,
+        size_t count,
+        uint8_t* scratch, size_t scratch_size) const = 0;
+
     virtual const W* get_prime() const = 0;
     virtual bool sign(W* r, W* s, const W* hash, const W* ek, const W* pk) const = 0;
     virtual bool verify(const W* r, const W* s, const W* hash, const W* qx, const W* qy) const = 0;
 };
 
+// The calls between the methods are qualified, so that they are bound statically and the whole pipeline
+// can be inlined when the concrete curve type is known.
 template <unsigned NPB, unsigned NNB, class W = uint32_t>
 class ec_cipher: public ec_cipher_base<W>
 {
@@ -61,6 +292,10 @@ public:
     typedef ui<NNW * WB, W>         n_ui;
     typedef ui<NNW * WB * 2, W>     z_ui;
 
+    // wide enough for a coordinate or a scalar plus n, to compare the values of the two fields
+    static const unsigned NXW = (NPW > NNW ? NPW : NNW) + 1;
+    typedef ui<NXW * WB, W>         x_ui;
+
 public:
     typedef typename uint_traits<W>::s SW;
     typedef ec_point<NPW * WB, W>   ecp;
@@ -72,25 +307,76 @@ public:
 
     const pw_fp<NPB, W>    p_fp_;
     const pw_fp<NNB, W>    n_fp_;
+    const ec_lanes<NPB, W> lanes_;
+    const unsigned         curve_;  // index of the curve in the operation counters
+
+    typedef typename ec_lanes<NPB, W>::point lane_point;
+
+    // batches use the lane arithmetic only when the kernels are vectorized and enough lanes are busy
+    static const unsigned DEFAULT_MIN_LANES = 2;
+
+    // busy lanes from which the lanes are normalized with the addition chain of p - 2
+    static const unsigned CHAIN_LANES = 3;
+
+    // width of the windows of the scalar multiplications, 1 being the binary method
+    static const unsigned DEFAULT_WINDOW = 4;
+    static const unsigned MAX_WINDOW = 5;
+
+    // the shared ciphers are tuned while in use, so the parameters are atomics read once per operation
+    mutable std::atomic<unsigned> window_;
+    mutable std::atomic<unsigned> min_lanes_;
 
 public:
     
     ec_cipher(const p_ui& a, const p_ui& b,
         const p_ui& gx, const p_ui& gy,
         const p_ui& p, const p_ui& pr,
-        const n_ui& n, const n_ui& nr)
+        const n_ui& n, const n_ui& nr,
+        unsigned curve = stats::OTHER_CURVE,
+        const fp_chain& p_inverse = fp_chain{ nullptr, 0 },
+        const fp_chain& p_sqrt = fp_chain{ nullptr, 0 })
         : A(a),
           B(b),
           G(gx, gy),
-          p_fp_(p, pr),
-          n_fp_(n, nr)
+          p_fp_(p, pr, p_inverse, p_sqrt),
+          n_fp_(n, nr),
+          lanes_(p_fp_.getPrime(), A),
+          curve_(curve),
+          window_(DEFAULT_WINDOW),
+          min_lanes_(DEFAULT_MIN_LANES)
     {
     }
 
+    ec_cipher(const ec_curve_params& c)
+        : ec_cipher(c.a, c.b, c.gx, c.gy, c.p, c.pr, c.n, c.nr, stats::curve_index(c.name), c.p_inverse, c.p_sqrt)
+    {
+    }
+
+    /**
+      Set the tuned parameters.
+      \param window the window width of the scalar multiplications, from 1 to MAX_WINDOW
+      \param min_lanes the number of signatures from which batches use the lanes, LANE_COUNT + 1 for never
+    */
+    void tune(unsigned window, unsigned min_lanes) const
+    {
+        window_.store(window < 1 ? 1 : window > MAX_WINDOW ? MAX_WINDOW : window, std::memory_order_relaxed);
+        min_lanes_.store(min_lanes < 1 ? 1 : min_lanes > LANE_COUNT + 1 ? LANE_COUNT + 1 : min_lanes, std::memory_order_relaxed);
+    }
+
+    unsigned window() const
+    {
+        return window_.load(std::memory_order_relaxed);
+    }
+
+    unsigned min_lanes() const
+    {
+        return min_lanes_.load(std::memory_order_relaxed);
+    }
+
     virtual void get_prime(
         uint8_t* p, size_t p_size) const
     {
-        n_ui p_box(get_prime());
+        n_ui p_box(ec_cipher::get_prime());
         p_box.to_bytes(p, p_size);
     }
 
@@ -121,6 +407,57 @@ public:
         const uint8_t* ek, size_t ek_size,
         const uint8_t* pk, size_t pk_size) const
     {
+        LCFR_STATS_CURVE(curve_);
+        stats::latency::stage_timer timer(curve_, stats::latency::SIGN);
+        n_ui r_box, s_box;
+
+        n_ui mask = n_ui::ones(n_fp_.getPrimeBitCount());
+        n_ui ek_box(ek, ek_size); bitwise_and(ek_box, ek_box, mask, NNW);
+        n_ui pk_box(pk, pk_size); bitwise_and(pk_box, pk_box, mask, NNW);
+
+        n_ui h_box; box_hash(h_box, h, h_size);
+        timer.lap(stats::latency::HASH);
+
+        ec_cipher::sign(r_box, s_box, h_box, ek_box, pk_box);
+
+        r_box.to_bytes(r, r_size);
+        s_box.to_bytes(s, s_size);
+    }
+
+    // the ephemeral key is drawn by the library, a key giving r = 0 or s = 0 being replaced by another
+    virtual void generate_signature_random(
+        uint8_t* r, size_t r_size,
+        uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* pk, size_t pk_size) const
+    {
+        LCFR_STATS_CURVE(curve_);
+        stats::latency::stage_timer timer(curve_, stats::latency::SIGN);
+        n_ui r_box, s_box, ek_box;
+
+        n_ui mask = n_ui::ones(n_fp_.getPrimeBitCount());
+        n_ui pk_box(pk, pk_size); bitwise_and(pk_box, pk_box, mask, NNW);
+
+        n_ui h_box; box_hash(h_box, h, h_size);
+        timer.lap(stats::latency::HASH);
+
+        do ec_cipher::random_scalar(ek_box);
+        while (!ec_cipher::sign(r_box, s_box, h_box, ek_box, pk_box));
+        secure_zero(&ek_box, sizeof(ek_box));
+
+        r_box.to_bytes(r, r_size);
+        s_box.to_bytes(s, s_size);
+    }
+
+    virtual unsigned generate_recoverable_signature(
+        uint8_t* r, size_t r_size,
+        uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* ek, size_t ek_size,
+        const uint8_t* pk, size_t pk_size) const
+    {
+        LCFR_STATS_CURVE(curve_);
+        stats::latency::stage_timer timer(curve_, stats::latency::SIGN);
         n_ui r_box, s_box;
 
         n_ui mask = n_ui::ones(n_fp_.getPrimeBitCount());
@@ -128,11 +465,186 @@ public:
         n_ui pk_box(pk, pk_size); bitwise_and(pk_box, pk_box, mask, NNW);
 
         n_ui h_box; box_hash(h_box, h, h_size);
+        timer.lap(stats::latency::HASH);
 
-        sign(r_box, s_box, h_box, ek_box, pk_box);
+        unsigned v = 0;
+        ec_cipher::sign_recoverable(r_box, s_box, v, h_box, ek_box, pk_box);
 
         r_box.to_bytes(r, r_size);
         s_box.to_bytes(s, s_size);
+        return v;
+    }
+
+    virtual unsigned generate_recoverable_signature_random(
+        uint8_t* r, size_t r_size,
+        uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* pk, size_t pk_size) const
+    {
+        LCFR_STATS_CURVE(curve_);
+        stats::latency::stage_timer timer(curve_, stats::latency::SIGN);
+        n_ui r_box, s_box, ek_box;
+
+        n_ui mask = n_ui::ones(n_fp_.getPrimeBitCount());
+        n_ui pk_box(pk, pk_size); bitwise_and(pk_box, pk_box, mask, NNW);
+
+        n_ui h_box; box_hash(h_box, h, h_size);
+        timer.lap(stats::latency::HASH);
+
+        // x is n or more with a probability of about (p - n) / p, negligible but on the cofactor 4 curves where it is about 3/4
+        unsigned v = 0;
+        do ec_cipher::random_scalar(ek_box);
+        while (!ec_cipher::sign_recoverable(r_box, s_box, v, h_box, ek_box, pk_box) || v > 1);
+        secure_zero(&ek_box, sizeof(ek_box));
+
+        r_box.to_bytes(r, r_size);
+        s_box.to_bytes(s, s_size);
+        return v;
+    }
+
+    // Q = r^-1 (s R - z G), R being the point of abscissa r + (v / 2) n and of y parity v & 1
+    virtual bool recover_public_key(
+        uint8_t* qx, size_t qx_size,
+        uint8_t* qy, size_t qy_size,
+        const uint8_t* r, size_t r_size,
+        const uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        unsigned v) const
+    {
+        LCFR_STATS_CURVE(curve_);
+        n_ui r_box(r, r_size);
+        n_ui s_box(s, s_size);
+        if (r_box == n_ui::ZERO || !l(r_box, n_fp_.getPrime(), NNW)) return false;
+        if (s_box == n_ui::ZERO || !l(s_box, n_fp_.getPrime(), NNW)) return false;
+
+        x_ui xr(r_box, NNW), n(n_fp_.getPrime(), NNW), p(p_fp_.getPrime(), NPW);
+        for (unsigned j = v / 2; j > 0 && l(xr, p, NXW); j--) lcfr::add(xr, xr, n, NXW);
+        if (!l(xr, p, NXW)) return false;
+        p_ui x(xr, NPW), y;
+        if (!ec_cipher::decompress(y, x, v & 1)) return false;
+
+        n_ui h_box; box_hash(h_box, h, h_size);
+        n_ui z_; set_modulo(z_, h_box);
+        n_ui ri; n_fp_.inverse(ri, r_box);
+        n_ui u1_(W(0)); n_fp_.sub(u1_, u1_, z_); n_fp_.mult(u1_, u1_, ri);
+        n_ui u2_; n_fp_.mult(u2_, s_box, ri);
+
+        ecpp p1(G.x, G.y);
+        ecpp p2(x, y);
+        auto m1 = [&]{ mult(p1, p1, u1_, NNW); };
+        auto m2 = [&]{ LCFR_STATS_CURVE(curve_); mult(p2, p2, u2_, NNW); };
+        spin_executor::invoke(m2, m1);
+        ecpp q; add(q, p1, p2);
+        if (q.is_zero()) return false;
+        normalize(q);
+
+        p_ui(q.x).to_bytes(qx, qx_size);
+        p_ui(q.y).to_bytes(qy, qy_size);
+        return true;
+    }
+
+    virtual size_t encode_point(
+        uint8_t* q, size_t q_size,
+        const uint8_t* qx, size_t qx_size,
+        const uint8_t* qy, size_t qy_size,
+        bool compressed) const
+    {
+        size_t size = compressed ? 1 + NPO : 1 + 2 * NPO;
+        if (q_size < size) return 0;
+        p_ui x(qx, qx_size);
+        p_ui y(qy, qy_size);
+        q[0] = compressed ? uint8_t(0x02 | (y[0] & W(1))) : uint8_t(0x04);
+        x.to_bytes(q + 1, NPO);
+        if (!compressed) y.to_bytes(q + 1 + NPO, NPO);
+        return size;
+    }
+
+    virtual bool decode_point(
+        uint8_t* qx, size_t qx_size,
+        uint8_t* qy, size_t qy_size,
+        const uint8_t* q, size_t q_size) const
+    {
+        LCFR_STATS_CURVE(curve_);
+        p_ui x, y;
+        bool compressed = q_size == 1 + NPO && (q[0] == 0x02 || q[0] == 0x03);
+        if (!compressed && (q_size != 1 + 2 * NPO || q[0] != 0x04)) return false;
+
+        x = p_ui(q + 1, NPO);
+        if (!l(x, p_fp_.getPrime(), NPW)) return false;
+        if (compressed)
+        {
+            if (!ec_cipher::decompress(y, x, q[0] & 1)) return false;
+        }
+        else
+        {
+            y = p_ui(q + 1 + NPO, NPO);
+            if (!l(y, p_fp_.getPrime(), NPW) || !ec_cipher::on_curve(x, y)) return false;
+        }
+        x.to_bytes(qx, qx_size);
+        y.to_bytes(qy, qy_size);
+        return true;
+    }
+
+    virtual void decode_points(
+        int32_t* results,
+        uint8_t* qx, size_t qx_size,
+        uint8_t* qy, size_t qy_size,
+        const uint8_t* q, size_t q_size,
+        size_t count) const
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            results[i] = ec_cipher::decode_point(
+                qx + i * qx_size, qx_size, qy + i * qy_size, qy_size, q + i * q_size, q_size) ? -1 : 0;
+        }
+    }
+
+    // y^2 = x^3 + A x + B
+    void curve_rhs(p_ui& y2, const p_ui& x) const
+    {
+        p_fp_.square(y2, x);
+        p_fp_.add(y2, y2, A);
+        p_fp_.mult(y2, y2, x);
+        p_fp_.add(y2, y2, B);
+    }
+
+    bool on_curve(const p_ui& x, const p_ui& y) const
+    {
+        p_ui y2, rhs;
+        p_fp_.square(y2, y);
+        ec_cipher::curve_rhs(rhs, x);
+        return y2 == rhs;
+    }
+
+    // the y of parity odd of the point of abscissa x, false if there is none
+    bool decompress(p_ui& y, const p_ui& x, unsigned odd) const
+    {
+        p_ui rhs;
+        ec_cipher::curve_rhs(rhs, x);
+        if (!p_fp_.sqrt(y, rhs)) return false;
+        if ((y[0] & W(1)) != W(odd))
+        {
+            if (y == p_ui::ZERO) return false;
+            lcfr::sub(y, p_fp_.getPrime(), y, NPW);
+        }
+        return true;
+    }
+
+    /**
+      Draw a uniform scalar between 1 and n - 1 from the generator of the calling thread.
+      The draws are masked to the bit length of n and rejected until they are in range,
+      which takes less than two draws on average.
+    */
+    void random_scalar(n_ui& k) const
+    {
+        n_ui mask = n_ui::ones(n_fp_.getPrimeBitCount());
+        chacha20_drbg& drbg = chacha20_drbg::local();
+        do
+        {
+            drbg.generate(static_cast<W*>(k), NNW * WO);
+            bitwise_and(k, k, mask, NNW);
+        }
+        while (k == n_ui::ZERO || !l(k, n_fp_.getPrime(), NNW));
     }
 
     virtual bool verify_signature(
@@ -142,14 +654,303 @@ public:
         const uint8_t* qx, size_t qx_size,
         const uint8_t* qy, size_t qy_size) const
     {
+        LCFR_STATS_CURVE(curve_);
+        stats::latency::stage_timer timer(curve_, stats::latency::VERIFY);
         n_ui r_box(r, r_size);
         n_ui s_box(s, s_size);
         n_ui qx_box(qx, qx_size);
         n_ui qy_box(qy, qy_size);
 
         n_ui h_box; box_hash(h_box, h, h_size);
+        timer.lap(stats::latency::HASH);
+
+        return ec_cipher::verify(r_box, s_box, h_box, qx_box, qy_box);
+    }
+
+    virtual void generate_signatures(
+        uint8_t* r, size_t r_size,
+        uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* ek, size_t ek_size,
+        const uint8_t* pk, size_t pk_size,
+        size_t count) const
+    {
+        generate_signatures(
+            batch_arrays<uint8_t*>{ r, nullptr, r_size },
+            batch_arrays<uint8_t*>{ s, nullptr, s_size },
+            batch_arrays<const uint8_t*>{ h, nullptr, h_size },
+            batch_arrays<const uint8_t*>{ ek, nullptr, ek_size },
+            batch_arrays<const uint8_t*>{ pk, nullptr, pk_size },
+            count);
+    }
+
+    void generate_signatures(
+        const batch_arrays<uint8_t*>& r,
+        const batch_arrays<uint8_t*>& s,
+        const batch_arrays<const uint8_t*>& h,
+        const batch_arrays<const uint8_t*>& ek,
+        const batch_arrays<const uint8_t*>& pk,
+        size_t count) const
+    {
+        LCFR_STATS_CURVE(curve_);
+        bool vectorized = lane_kernels_vectorized();
+        unsigned min_lanes = ec_cipher::min_lanes();
+        for (size_t b = 0; b < count; b += LANE_COUNT)
+        {
+            size_t m = count - b < LANE_COUNT ? count - b : LANE_COUNT;
+            if (!vectorized || (m < min_lanes))
+            {
+                for (size_t i = b; i < b + m; i++)
+                {
+                    ec_cipher::generate_signature(
+                        r[i], r.size, s[i], s.size, h[i], h.size, ek[i], ek.size, pk[i], pk.size);
+                }
+                continue;
+            }
+
+            // the points ek * G of the group are computed on the lanes, idle lanes repeating the first key
+            n_ui mask = n_ui::ones(n_fp_.getPrimeBitCount());
+            n_ui ek_box[LANE_COUNT];
+            const W* k[LANE_COUNT];
+            load_boxes(ek_box, ek.from(b), m);
+            for (unsigned l = 0; l < LANE_COUNT; l++)
+            {
+                if (l < m) bitwise_and(ek_box[l], ek_box[l], mask, NNW);
+                else ek_box[l] = ek_box[0];
+                k[l] = ek_box[l];
+            }
+
+            lane_point g;
+            lanes_.broadcast(g, G.x, G.y);
+            lanes_.mult(g, g, k, NNW);
+            ecpp p[LANE_COUNT];
+            store_lanes(p, g);
+
+            n_ui pk_box[LANE_COUNT], r_box[LANE_COUNT], s_box[LANE_COUNT];
+            load_boxes(pk_box, pk.from(b), m);
+            for (size_t l = 0; l < m; l++)
+            {
+                bitwise_and(pk_box[l], pk_box[l], mask, NNW);
+                n_ui h_box; box_hash(h_box, h[b + l], h.size);
+
+                normalize(p[l]);
+                sign_point(r_box[l], s_box[l], p[l].x, h_box, ek_box[l], pk_box[l]);
+            }
+            store_boxes(r.from(b), r_box, m);
+            store_boxes(s.from(b), s_box, m);
+        }
+    }
+
+    virtual void verify_signatures(
+        int32_t* results,
+        const uint8_t* r, size_t r_size,
+        const uint8_t* s, size_t s_size,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* qx, size_t qx_size,
+        const uint8_t* qy, size_t qy_size,
+        size_t count,
+        uint8_t* scratch, size_t scratch_size) const
+    {
+        verify_signatures(
+            results,
+            batch_arrays<const uint8_t*>{ r, nullptr, r_size },
+            batch_arrays<const uint8_t*>{ s, nullptr, s_size },
+            batch_arrays<const uint8_t*>{ h, nullptr, h_size },
+            batch_arrays<const uint8_t*>{ qx, nullptr, qx_size },
+            batch_arrays<const uint8_t*>{ qy, nullptr, qy_size },
+            count,
+            scratch, scratch_size);
+    }
+
+    void verify_signatures(
+        int32_t* results,
+        const batch_arrays<const uint8_t*>& r,
+        const batch_arrays<const uint8_t*>& s,
+        const batch_arrays<const uint8_t*>& h,
+        const batch_arrays<const uint8_t*>& qx,
+        const batch_arrays<const uint8_t*>& qy,
+        size_t count,
+        uint8_t* scratch, size_t scratch_size) const
+    {
+        LCFR_STATS_CURVE(curve_);
+        // the inverses of s are computed with a single field inversion per chunk (Montgomery trick),
+        // the scratch buffer holding the running products
+        size_t chunk = scratch_size / (2 * sizeof(n_ui));
+        if (chunk == 0)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                results[i] = ec_cipher::verify_signature(
+                    r[i], r.size, s[i], s.size, h[i], h.size, qx[i], qx.size, qy[i], qy.size) ? -1 : 0;
+            }
+            return;
+        }
+
+        n_ui* s_ = reinterpret_cast<n_ui*>(scratch);
+        n_ui* prod_ = s_ + chunk;
+        for (size_t b = 0; b < count; b += chunk)
+        {
+            size_t m = count - b < chunk ? count - b : chunk;
+            load_boxes(s_, s.from(b), m);
+            for (size_t i = 0; i < m; i++)
+            {
+                size_t k = b + i;
+                bool valid = !(s_[i] == n_ui::ZERO) && l(s_[i], n_fp_.getPrime(), NNW);
+                results[k] = valid ? -1 : 0;
+                if (!valid) s_[i] = n_ui::ONE;
+                new(prod_ + i) n_ui(s_[i]);
+                if (i > 0) n_fp_.mult(prod_[i], prod_[i - 1], s_[i]);
+            }
 
-        return verify(r_box, s_box, h_box, qx_box, qy_box);
+            // s_ is overwritten with the inverses
+            n_ui inv; n_fp_.inverse(inv, prod_[m - 1]);
+            for (size_t i = m; i > 0; i--)
+            {
+                n_ui w_;
+                if (i > 1)
+                {
+                    n_fp_.mult(w_, inv, prod_[i - 2]);
+                    n_fp_.mult(inv, inv, s_[i - 1]);
+                }
+                else w_ = inv;
+                s_[i - 1] = w_;
+            }
+
+            verify_inverses(results + b, r.from(b), s_, h.from(b), qx.from(b), qy.from(b), m);
+        }
+    }
+
+    // verifies the signatures whose result is still -1, w holding the inverses of their s components
+    void verify_inverses(
+        int32_t* results,
+        const batch_arrays<const uint8_t*>& r,
+        const n_ui* w,
+        const batch_arrays<const uint8_t*>& h,
+        const batch_arrays<const uint8_t*>& qx,
+        const batch_arrays<const uint8_t*>& qy,
+        size_t count) const
+    {
+        bool vectorized = lane_kernels_vectorized() && (ec_cipher::min_lanes() <= LANE_COUNT);
+        unsigned min_lanes = ec_cipher::min_lanes();
+        size_t pending[LANE_COUNT];
+        size_t np = 0;
+        for (size_t k = 0; k <= count; k++)
+        {
+            if (k < count)
+            {
+                if (results[k] == 0) continue;
+                pending[np++] = k;
+                if (vectorized && (np < LANE_COUNT)) continue;
+            }
+
+            if (vectorized && (np >= min_lanes))
+            {
+                verify_lanes(results, pending, np, r, w, h, qx, qy);
+            }
+            else
+            {
+                for (size_t i = 0; i < np; i++)
+                {
+                    size_t j = pending[i];
+                    n_ui r_box(r[j], r.size);
+                    n_ui qx_box(qx[j], qx.size);
+                    n_ui qy_box(qy[j], qy.size);
+                    n_ui h_box; box_hash(h_box, h[j], h.size);
+                    results[j] = verify_inverse(r_box, w[j], h_box, qx_box, qy_box) ? -1 : 0;
+                }
+            }
+            np = 0;
+        }
+    }
+
+    // verifies up to LANE_COUNT signatures on the lanes, idle lanes repeating the first signature
+    void verify_lanes(
+        int32_t* results, const size_t* index, size_t m,
+        const batch_arrays<const uint8_t*>& r,
+        const n_ui* w,
+        const batch_arrays<const uint8_t*>& h,
+        const batch_arrays<const uint8_t*>& qx,
+        const batch_arrays<const uint8_t*>& qy) const
+    {
+        LCFR_STATS_COUNT(VERIFY, m);
+        n_ui r_[LANE_COUNT], u1_[LANE_COUNT], u2_[LANE_COUNT];
+        const W* k1[LANE_COUNT];
+        const W* k2[LANE_COUNT];
+        lane_point p1, p2;
+        lanes_.broadcast(p1, G.x, G.y);
+        for (unsigned l = 0; l < LANE_COUNT; l++)
+        {
+            size_t j = index[l < m ? l : 0];
+            r_[l] = n_ui(r[j], r.size);
+            n_ui h_box; box_hash(h_box, h[j], h.size);
+            n_ui z_; set_modulo(z_, h_box);
+            n_fp_.mult(u1_[l], z_, w[j]);
+            n_fp_.mult(u2_[l], r_[l], w[j]);
+            k1[l] = u1_[l];
+            k2[l] = u2_[l];
+
+            p_ui qx_box(n_ui(qx[j], qx.size));
+            p_ui qy_box(n_ui(qy[j], qy.size));
+            lanes_.load(p2, l, qx_box, qy_box);
+        }
+
+        auto m1 = [&]{ lanes_.mult(p1, p1, k1, NNW); };
+        auto m2 = [&]{ LCFR_STATS_CURVE(curve_); lanes_.mult(p2, p2, k2, NNW); };
+        spin_executor::invoke(m2, m1);
+        lane_point p; lanes_.add(p, p1, p2);
+
+        // a single addition chain on the lanes inverts the z of every lane in the time of about
+        // two scalar inversions, so it is used from CHAIN_LANES busy lanes
+        p_ui x[LANE_COUNT];
+        if (m >= CHAIN_LANES && p_fp_.getInverseChain().size > 0)
+        {
+            W* x_[LANE_COUNT];
+            for (unsigned l = 0; l < LANE_COUNT; l++) x_[l] = x[l];
+            lanes_.store_affine_x(x_, p, p_fp_.getInverseChain());
+        }
+        else
+        {
+            ecpp q[LANE_COUNT];
+            store_lanes(q, p);
+            for (size_t l = 0; l < m; l++)
+            {
+                normalize(q[l]);
+                x[l] = q[l].x;
+            }
+        }
+        for (size_t l = 0; l < m; l++)
+        {
+            if (ge(x[l], p_fp_.getPrime(), NPW)) sub(x[l], x[l], p_fp_.getPrime(), NPW);
+            n_ui rt_; n_fp_.modulo(rt_, x[l], NPW);
+            results[index[l]] = lcfr::eq(rt_, r_[l], NNW) ? -1 : 0;
+        }
+    }
+
+    // the contiguous arrays are converted at once, the scattered ones one by one
+    static void load_boxes(n_ui* x, const batch_arrays<const uint8_t*>& a, size_t count)
+    {
+        if (a.addresses == nullptr) n_ui::from_bytes(x, a.base, a.size, count);
+        else for (size_t i = 0; i < count; i++) new(x + i) n_ui(a.addresses[i], a.size);
+    }
+
+    static void store_boxes(const batch_arrays<uint8_t*>& a, const n_ui* x, size_t count)
+    {
+        if (a.addresses == nullptr) n_ui::to_bytes(a.base, a.size, x, count);
+        else for (size_t i = 0; i < count; i++) x[i].to_bytes(a.addresses[i], a.size);
+    }
+
+    void store_lanes(ecpp* q, const lane_point& p) const
+    {
+        W* x[LANE_COUNT];
+        W* y[LANE_COUNT];
+        W* z[LANE_COUNT];
+        for (unsigned l = 0; l < LANE_COUNT; l++)
+        {
+            x[l] = q[l].x;
+            y[l] = q[l].y;
+            z[l] = q[l].z;
+        }
+        lanes_.store(x, y, z, p);
     }
 
     virtual void generate_public_key(
@@ -157,6 +958,7 @@ public:
         uint8_t* qy, size_t qy_size,
         const uint8_t* pk, size_t pk_size) const
     {
+        LCFR_STATS_CURVE(curve_);
         p_ui qx_box, qy_box;
         n_ui mask = n_ui::ones(n_fp_.getPrimeBitCount());
         n_ui pk_box(pk, pk_size); bitwise_and(pk_box, pk_box, mask, NNW);
@@ -167,6 +969,7 @@ public:
 
     void twice(ecp& s, const ecp& p) const
     {
+        LCFR_STATS_COUNT(POINT_DOUBLE, 1);
         if (p.is_zero() || (p.y == p_ui::ZERO))
         {
             s = ecp();
@@ -190,6 +993,7 @@ public:
 
     void twice(ecpp& s, const ecpp& p) const
     {
+        LCFR_STATS_COUNT(POINT_DOUBLE, 1);
         if (p.is_zero() || (p.y == p_ui::ZERO))
         {
             s = ecpp();
@@ -223,6 +1027,7 @@ public:
 
     void add(ecp& s, const ecp& p1, const ecp& p2) const
     {
+        LCFR_STATS_COUNT(POINT_ADD, 1);
         if (p1.is_zero())
         {
             s = p2; return;
@@ -257,6 +1062,7 @@ public:
 
     void add(ecpp& s, const ecpp& p1, const ecpp& p2) const
     {
+        LCFR_STATS_COUNT(POINT_ADD, 1);
         if (p1.is_zero())
         {
             s = p2; return;
@@ -319,17 +1125,50 @@ public:
 
     void mult(ecpp& p, const ecpp& b, const W* k, size_t nk) const
     {
-        ecpp b2n(b);
-        p = ecpp();
-        for (size_t i = 0; i < nk; i++)
+        ec_cipher::mult(p, b, k, nk, ec_cipher::window());
+    }
+
+    // fixed window method, the multiples 1..2^w-1 of b being precomputed
+    void mult(ecpp& p, const ecpp& b, const W* k, size_t nk, unsigned w) const
+    {
+        if (w <= 1)
         {
-            for (size_t j = 0; j < WB; j++)
+            ecpp b2n(b);
+            p = ecpp();
+            for (size_t i = 0; i < nk; i++)
             {
-                bool take = k[i] & (W(1) << j);
-                if (take) add(p, p, b2n);
-                twice(b2n, b2n);
+                for (size_t j = 0; j < WB; j++)
+                {
+                    bool take = k[i] & (W(1) << j);
+                    if (take) add(p, p, b2n);
+                    twice(b2n, b2n);
+                }
             }
+            return;
+        }
+
+        ecpp t[(1u << MAX_WINDOW) - 1]; // t[i] = (i + 1) b
+        unsigned nt = (1u << w) - 1;
+        t[0] = b;
+        for (unsigned i = 1; i < nt; i++)
+        {
+            if (i & 1) twice(t[i], t[i / 2]);
+            else       add(t[i], t[i - 1], b);
         }
+
+        size_t nb = nk * WB;
+        ecpp s;
+        for (size_t i = (nb + w - 1) / w; i > 0; i--)
+        {
+            if (!s.is_zero())
+                for (unsigned j = 0; j < w; j++) twice(s, s);
+            size_t bit = (i - 1) * w;
+            unsigned d = 0;
+            for (unsigned j = 0; (j < w) && (bit + j < nb); j++)
+                d |= unsigned((k[(bit + j) / WB] >> ((bit + j) % WB)) & 1) << j;
+            if (d != 0) add(s, s, t[d - 1]);
+        }
+        p = s;
     }
 
     virtual const W* get_prime() const
@@ -339,16 +1178,51 @@ public:
 
     virtual bool sign(W* r, W* s, const W* hash, const W* ek, const W* pk) const
     {
+        LCFR_STATS_CURVE(curve_);
         //if (::eq(ek, n_ui::ZERO, NNW) || lcfr::ge(ek, n_fp_.getPrime(), NNW)) return false;
 
-        n_ui ek_; set_modulo(ek_, ek);
-        n_ui pk_; set_modulo(pk_, pk);
+        stats::latency::stage_timer timer(curve_, stats::latency::SIGN);
+        ecpp p(G.x, G.y);
+        mult(p, p, ek, NNW);
+        timer.lap(stats::latency::SCALAR_MULT);
+        normalize(p);
+        timer.lap(stats::latency::NORMALIZE);
+
+        bool ok = sign_point(r, s, p.x, hash, ek, pk);
+        timer.lap(stats::latency::FINAL);
+        return ok;
+    }
 
+    // sign also returning the recovery id in v
+    bool sign_recoverable(W* r, W* s, unsigned& v, const W* hash, const W* ek, const W* pk) const
+    {
+        LCFR_STATS_CURVE(curve_);
+        stats::latency::stage_timer timer(curve_, stats::latency::SIGN);
         ecpp p(G.x, G.y);
         mult(p, p, ek, NNW);
+        timer.lap(stats::latency::SCALAR_MULT);
         normalize(p);
+        timer.lap(stats::latency::NORMALIZE);
+
+        // s replaced by n - s is the signature of -ek, whose point has the other y
+        bool negated = false;
+        bool ok = sign_point(r, s, p.x, hash, ek, pk, &negated);
+        v = unsigned(p.y[0] & W(1)) ^ (negated ? 1u : 0u);
+        x_ui xr(p.x, NPW), n(n_fp_.getPrime(), NNW);
+        for (; !l(xr, n, NXW); v += 2) lcfr::sub(xr, xr, n, NXW);
+        timer.lap(stats::latency::FINAL);
+        return ok;
+    }
 
-        n_ui r_; n_fp_.modulo(r_, p.x, NPW);
+    // completes the signature given the x coordinate of the normalized point ek * G,
+    // negated telling if s has been replaced by n - s
+    bool sign_point(W* r, W* s, const W* x, const W* hash, const W* ek, const W* pk, bool* negated = nullptr) const
+    {
+        LCFR_STATS_COUNT(SIGN, 1);
+        n_ui ek_; set_modulo(ek_, ek);
+        n_ui pk_; set_modulo(pk_, pk);
+
+        n_ui r_; n_fp_.modulo(r_, x, NPW);
         if (r_ == n_ui::ZERO) return false;
 
         n_ui s_(r_);
@@ -364,28 +1238,50 @@ public:
 
         n_ui ns(W(0));
         n_fp_.sub(ns, ns, s_);
-        if (l(ns, s_, NNW)) lcfr::set(s, ns, NNW);
-        else                lcfr::set(s, s_, NNW);
+        bool low = l(ns, s_, NNW);
+        if (low) lcfr::set(s, ns, NNW);
+        else     lcfr::set(s, s_, NNW);
+        if (negated) *negated = low;
         lcfr::set(r, r_, NNW);
         return true;
     }
 
     virtual bool verify(const W* r, const W* s, const W* hash, const W* qx, const W* qy) const
     {
-        n_ui r_(r), s_(s);
-        n_ui z_; set_modulo(z_, hash);
+        LCFR_STATS_CURVE(curve_);
+        stats::latency::stage_timer timer(curve_, stats::latency::VERIFY);
+        n_ui s_(s);
         n_ui w_; n_fp_.inverse(w_, s_);
+        timer.lap(stats::latency::INVERSE);
+        return verify_inverse(r, w_, hash, qx, qy);
+    }
+
+    // w is the inverse of the signature s component
+    bool verify_inverse(const W* r, const W* w, const W* hash, const W* qx, const W* qy) const
+    {
+        LCFR_STATS_COUNT(VERIFY, 1);
+        stats::latency::stage_timer timer(curve_, stats::latency::VERIFY);
+        n_ui r_(r), w_(w);
+        n_ui z_; set_modulo(z_, hash);
 
         n_ui u1_; n_fp_.mult(u1_, z_, w_);
         n_ui u2_; n_fp_.mult(u2_, r_, w_);
 
-        ecpp p1(G.x, G.y); mult(p1, p1, u1_, NNW);
-        ecpp p2(qx, qy);   mult(p2, p2, u2_, NNW);
+        // the two multiplications are independent, they run in parallel when helper threads are configured
+        ecpp p1(G.x, G.y);
+        ecpp p2(qx, qy);
+        auto m1 = [&]{ mult(p1, p1, u1_, NNW); };
+        auto m2 = [&]{ LCFR_STATS_CURVE(curve_); mult(p2, p2, u2_, NNW); };
+        spin_executor::invoke(m2, m1);
         ecpp p;            add(p, p1, p2);
+        timer.lap(stats::latency::SCALAR_MULT);
         normalize(p);
+        timer.lap(stats::latency::NORMALIZE);
 
         n_ui rt_; n_fp_.modulo(rt_, p.x, NPW);
-        return lcfr::eq(rt_, r_, NNW);
+        bool valid = lcfr::eq(rt_, r_, NNW);
+        timer.lap(stats::latency::FINAL);
+        return valid;
     }
 
     void public_key(W* qx, W* qy, const W* pk) const
@@ -410,10 +1306,10 @@ public:
 
     void box_hash(n_ui& h_box, const uint8_t* hash, size_t hash_len) const
     {
-        hash_len = get_prime_byte_length() < hash_len ? get_prime_byte_length() : hash_len;
+        hash_len = ec_cipher::get_prime_byte_length() < hash_len ? ec_cipher::get_prime_byte_length() : hash_len;
         h_box = n_ui(hash, hash_len);
-        if (hash_len * 8 > get_prime_bit_length())
-            shift_right(h_box, h_box, hash_len * 8 - get_prime_bit_length(), NNW);
+        if (hash_len * 8 > ec_cipher::get_prime_bit_length())
+            shift_right(h_box, h_box, hash_len * 8 - ec_cipher::get_prime_bit_length(), NNW);
     }
 
     void set_modulo(n_ui& y, const W* x) const
@@ -425,150 +1321,104 @@ public:
 
 
 template <class W = uint32_t>
-class ec_fp_secp256k1 : public ec_cipher<256, 256, W>
+class ec_fp_secp256k1 final : public ec_cipher<256, 256, W>
 {
 public:
     ec_fp_secp256k1()
-        : ec_cipher<256, 256, W>(
-            W(0), W(7), 
-            "79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798",
-            "483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8",
-            "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F", "1000003D1",
-            "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141", "14551231950B75FC4402DA1732FC9BEC0")
+        : ec_cipher<256, 256, W>(SECP256K1_PARAMS)
     {}
 };
 
 template <class W = uint32_t>
-class ec_fp_secp256r1 : public ec_cipher<256, 256, W>
+class ec_fp_secp256r1 final : public ec_cipher<256, 256, W>
 {
 public:
     ec_fp_secp256r1()
-        : ec_cipher<256, 256, W>(
-            "FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFC",
-            "5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B",
-            "6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296",
-            "4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5",
-            "FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF", "FFFFFFFFFFFFFFFEFFFFFFFEFFFFFFFEFFFFFFFF0000000000000003",
-            "FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551", "FFFFFFFFFFFFFFFEFFFFFFFF43190552DF1A6C21012FFD85EEDF9BFE")
+        : ec_cipher<256, 256, W>(SECP256R1_PARAMS)
     {}
 };
 
 template <class W = uint32_t>
-class ec_fp_secp192k1 : public ec_cipher<192, 192, W>
+class ec_fp_secp192k1 final : public ec_cipher<192, 192, W>
 {
 public:
     ec_fp_secp192k1()
-        : ec_cipher<192, 192, W>(
-            W(0), W(3),
-            "DB4FF10EC057E9AE26B07D0280B7F4341DA5D1B1EAE06C7D",
-            "9B2F2F6D9C5628A7844163D015BE86344082AA88D95E2F9D",
-            "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFEE37", "1000011C9",
-            "FFFFFFFFFFFFFFFFFFFFFFFE26F2FC170F69466A74DEFD8D", "1D90D03E8F096B9958B210276")
+        : ec_cipher<192, 192, W>(SECP192K1_PARAMS)
     {}
 };
 
 template <class W = uint32_t>
-class ec_fp_secp192r1 : public ec_cipher<192, 192, W>
+class ec_fp_secp192r1 final : public ec_cipher<192, 192, W>
 {
 public:
     ec_fp_secp192r1()
-        : ec_cipher<192, 192, W>(
-            "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFC",
-            "64210519E59C80E70FA7E9AB72243049FEB8DEECC146B9B1",
-            "188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012",
-            "07192B95FFC8DA78631011ED6B24CDD573F977A11E794811",
-            "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFF", "10000000000000001",
-            "FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22831", "662107C9EB94364E4B2DD7CF")
+        : ec_cipher<192, 192, W>(SECP192R1_PARAMS)
     {}
 };
 
 template <class W = uint32_t>
-class ec_fp_secp160k1 : public ec_cipher<160, 161, W>
+class ec_fp_secp160k1 final : public ec_cipher<160, 161, W>
 {
 public:
     ec_fp_secp160k1()
-        : ec_cipher<160, 161, W>(
-            W(0), W(7),
-            "3B4C382CE37AA192A4019E763036F4F5DD4D7EBB",
-            "938CF935318FDCED6BC28286531733C3F03C4FEE",
-            "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFAC73", "10000538D",
-            "100000000000000000001B8FA16DFAB9ACA16B6B3", "3FFFFFFFFFFFFFFFFFFF91C17A4815194D7A5253F")
+        : ec_cipher<160, 161, W>(SECP160K1_PARAMS)
     {}
 };
 
 template <class W = uint32_t>
-class ec_fp_secp160r1 : public ec_cipher<160, 161, W>
+class ec_fp_secp160r1 final : public ec_cipher<160, 161, W>
 {
 public:
     ec_fp_secp160r1()
-        : ec_cipher<160, 161, W>(
-            "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFFFC",
-            "1C97BEFC54BD7A8B65ACF89F81D4D4ADC565FA45",
-            "4A96B5688EF573284664698968C38BB913CBFC82",
-            "23A628553168947D59DCC912042351377AC5FB32",
-            "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFFFF", "80000001",
-            "100000000000000000001F4C8F927AED3CA752257", "3FFFFFFFFFFFFFFFFFFF82CDC1B6144B0D62B76B3")
+        : ec_cipher<160, 161, W>(SECP160R1_PARAMS)
     {}
 };
 
 template <class W = uint32_t>
-class ec_fp_secp128r1 : public ec_cipher<128, 128, W>
+class ec_fp_secp128r1 final : public ec_cipher<128, 128, W>
 {
 public:
     ec_fp_secp128r1()
-        : ec_cipher<128, 128, W>(
-            "FFFFFFFDFFFFFFFFFFFFFFFFFFFFFFFC",
-            "E87579C11079F43DD824993C2CEE5ED3",
-            "161FF7528B899B2D0C28607CA52C5B86",
-            "CF5AC8395BAFEB13C02DA292DDED7A83",
-            "FFFFFFFDFFFFFFFFFFFFFFFFFFFFFFFF", "2000000040000000800000011",
-            "FFFFFFFE0000000075A30D1B9038A115", "2000000038A5CF2EA993B2A87")
+        : ec_cipher<128, 128, W>(SECP128R1_PARAMS)
     {}
 };
 
 template <class W = uint32_t>
-class ec_fp_secp128r2 : public ec_cipher<128, 126, W>
+class ec_fp_secp128r2 final : public ec_cipher<128, 126, W>
 {
 public:
     ec_fp_secp128r2()
-        : ec_cipher<128, 126, W>(
-            "D6031998D1B3BBFEBF59CC9BBFF9AEE1",
-            "5EEEFCA380D02919DC2C6558BB6D8A5D",
-            "7B6AA5D85E572983E6FB32A7CDEBC140",
-            "27B6916A894D3AEE7106FE805FC34B44",
-            "FFFFFFFDFFFFFFFFFFFFFFFFFFFFFFFF", "2000000040000000800000011",
-            "3FFFFFFF7FFFFFFFBE0024720613B5A3", "400000008000000141FFDB9101EBB89C")
+        : ec_cipher<128, 126, W>(SECP128R2_PARAMS)
     {}
 };
 
 template <class W = uint32_t>
-class ec_fp_secp112r1 : public ec_cipher<112, 112, W>
+class ec_fp_secp112r1 final : public ec_cipher<112, 112, W>
 {
 public:
     ec_fp_secp112r1()
-        : ec_cipher<112, 112, W>(
-            "DB7C2ABF62E35E668076BEAD2088",
-            "659EF8BA043916EEDE8911702B22",
-            "09487239995A5EE76B55F9C2F098",
-            "A89CE5AF8724C0A23E0E0FF77500",
-            "DB7C2ABF62E35E668076BEAD208B", "12A97000000000000000000000000",
-            "DB7C2ABF62E35E7628DFAC6561C5", "12A96FFFFFFFFFFEAB2EA46B3447E")
+        : ec_cipher<112, 112, W>(SECP112R1_PARAMS)
     {}
 };
 
 template <class W = uint32_t>
-class ec_fp_secp112r2 : public ec_cipher<112, 110, W>
+class ec_fp_secp112r2 final : public ec_cipher<112, 110, W>
 {
 public:
     ec_fp_secp112r2()
-        : ec_cipher<112, 110, W>(
-            "6127C24C05F38A0AAAF65C0EF02C",
-            "51DEF1815DB5ED74FCC34C85D709",
-            "4BA30AB5E892B4E1649DD0928643",
-            "ADCD46F5882E3747DEF36E956E97",
-            "DB7C2ABF62E35E668076BEAD208B", "12A97000000000000000000000000",
-            "36DF0AAFD8B8D7597CA10520D04B", "4AA5C0000000005741402575BCFC")
+        : ec_cipher<112, 110, W>(SECP112R2_PARAMS)
     {}
 };
 
+/**
+  \return the process-wide cipher of the curve type C, built at the first call.
+  The cipher is immutable, so that it is shared by every thread and every EcCipher of the curve.
+*/
+template <class C>
+const C& ec_shared_cipher()
+{
+    static const C cipher;
+    return cipher;
+}
+
 }
@@ -0,0 +1,235 @@
+#pragma once
+
+#include "lcfr/crypto/simd/lane_fp.h"
+
+namespace lcfr {
+
+/** Elliptic curve point arithmetic on LANE_COUNT independent points at once.
+* The points use the same homogeneous projective coordinates as ec_point_p, the point at infinity
+* having z = 0. Every operation is performed in lockstep on all the lanes, the lanes diverging
+* only through masked selections, so that the field arithmetic runs on the vector kernels.
+*/
+template <unsigned NP, class W = uint32_t>
+class ec_lanes
+{
+public:
+    typedef lane_fp<NP, W>            fp;
+    typedef typename fp::element      element;
+    typedef typename fp::mask         mask;
+
+    static const unsigned WB = 8 * sizeof(W);
+    static const unsigned NL = fp::NL;
+
+    struct point
+    {
+        element x;
+        element y;
+        element z;
+    };
+
+private:
+    const fp fp_;
+    W        a_[fp::NW];                // curve equation parameter
+
+    void select(point& s, const point& p1, const point& p2, const mask& m) const
+    {
+        fp::select(s.x, p1.x, p2.x, m);
+        fp::select(s.y, p1.y, p2.y, m);
+        fp::select(s.z, p1.z, p2.z, m);
+    }
+
+    void twice(point& s, const point& p, const element& a) const
+    {
+        LCFR_STATS_COUNT(POINT_DOUBLE, LANE_COUNT);
+        element xq, zq, azq, u, v, xq3, uq, vy, w, t;
+        fp_.square(xq, p.x);            // x^2
+        fp_.square(zq, p.z);            // z^2
+        fp_.twice(xq3, xq);             // 2x^2
+        fp_.add(xq3, xq3, xq);          // 3x^2
+        fp_.mult(azq, a, zq);           // Az^2
+        fp_.add(u, xq3, azq);           // u = 3x^2 + Az^2
+        fp_.mult(v, p.y, p.z);          // yz
+        fp_.twice(v, v);                // v = 2yz, zero for the point at infinity and for y = 0
+        fp_.square(uq, u);              // u^2
+        fp_.mult(vy, v, p.y);           // vy
+        fp_.mult(t, p.x, vy);           // vxy
+        fp_.twice(t, t);                // 2vxy
+        fp_.twice(w, t);                // 4vxy
+        fp_.sub(w, uq, w);              // w = u^2 - 4vxy
+        fp_.sub(xq, t, w);              // 2vxy - w
+        fp_.mult(xq, xq, u);            // u(2vxy - w)
+        fp_.square(zq, vy);             // v^2y^2
+        fp_.twice(zq, zq);              // 2v^2y^2
+        fp_.sub(s.y, xq, zq);           // y'
+        fp_.mult(s.x, w, v);            // x'
+        fp_.square(s.z, v);             // v^2
+        fp_.mult(s.z, s.z, v);          // z'
+    }
+
+    void add(point& s, const point& p1, const point& p2, const element& a) const
+    {
+        LCFR_STATS_COUNT(POINT_ADD, LANE_COUNT);
+        element u0, u1, v0, v1, u, v;
+        fp_.mult(u0, p2.y, p1.z);
+        fp_.mult(u1, p1.y, p2.z);
+        fp_.mult(v0, p2.x, p1.z);
+        fp_.mult(v1, p1.x, p2.z);
+        fp_.sub(u, u0, u1);
+        fp_.sub(v, v0, v1);
+
+        // v = 0 and u != 0 (opposite points) yields z = 0 by itself
+        point r;
+        element z1z2, vq, vqz2, uq, w, w2, vcy1z2;
+        fp_.mult(z1z2, p1.z, p2.z);
+        fp_.square(vq, v);
+        fp_.mult(vqz2, vq, p2.z);
+        fp_.square(uq, u);
+        fp_.add(w2, v0, v1);
+        fp_.mult(w2, vq, w2);
+        fp_.mult(w, uq, z1z2);
+        fp_.sub(w, w, w2);
+        fp_.mult(vcy1z2, vqz2, v);
+        fp_.mult(vcy1z2, vcy1z2, p1.y);
+        fp_.mult(r.y, vqz2, p1.x);
+        fp_.sub(r.y, r.y, w);
+        fp_.mult(r.y, r.y, u);
+        fp_.sub(r.y, r.y, vcy1z2);
+        fp_.mult(r.x, w, v);
+        fp_.mult(r.z, vqz2, p1.z);
+        fp_.mult(r.z, r.z, v);
+
+        mask z1, z2, uz, vz, dbl;
+        fp::is_zero(z1, p1.z);
+        fp::is_zero(z2, p2.z);
+        fp::is_zero(uz, u);
+        fp::is_zero(vz, v);
+        bool any = false;
+        for (unsigned l = 0; l < LANE_COUNT; l++)
+        {
+            dbl.lanes[l] = uz.lanes[l] & vz.lanes[l] & ~z1.lanes[l] & ~z2.lanes[l];
+            any |= dbl.lanes[l] != 0;
+        }
+
+        // equal points, the doubling is computed only if a lane needs it
+        if (any)
+        {
+            point d;
+            twice(d, p1, a);
+            select(r, r, d, dbl);
+        }
+        select(r, r, p1, z2);
+        select(s, r, p2, z1);
+    }
+
+public:
+    /**
+      \param prime the prime number (least significant word before)
+      \param a the curve equation parameter A
+    */
+    ec_lanes(const W* prime, const W* a)
+        : fp_(prime)
+    {
+        for (unsigned i = 0; i < fp::NW; i++) a_[i] = a[i];
+    }
+
+    const fp& field() const
+    {
+        return fp_;
+    }
+
+    /**
+      Set a lane to the point (x, y), given in affine coordinates.
+    */
+    void load(point& p, unsigned lane, const W* x, const W* y) const
+    {
+        fp_.load(p.x, lane, x);
+        fp_.load(p.y, lane, y);
+        W one[fp::NW] = { W(1) };
+        fp_.load(p.z, lane, one);
+    }
+
+    /**
+      Set every lane to the point (x, y), given in affine coordinates.
+    */
+    void broadcast(point& p, const W* x, const W* y) const
+    {
+        fp_.broadcast(p.x, x);
+        fp_.broadcast(p.y, y);
+        W one[fp::NW] = { W(1) };
+        fp_.broadcast(p.z, one);
+    }
+
+    /**
+      Store the projective coordinates of every lane.
+    */
+    void store(W* const* x, W* const* y, W* const* z, const point& p) const
+    {
+        fp_.store(x, p.x);
+        fp_.store(y, p.y);
+        fp_.store(z, p.z);
+    }
+
+    /**
+      Store the affine x coordinate x / z of every lane, 0 for the point at infinity.
+      The inverses of z are computed together as z^(p - 2), inverse being the addition chain of p - 2.
+    */
+    void store_affine_x(W* const* x, const point& p, const fp_chain& inverse) const
+    {
+        element iz, t;
+        fp_.pow(iz, p.z, inverse);
+        fp_.mult(t, p.x, iz);
+        fp_.store(x, t);
+    }
+
+    /**
+      Compute p = k * b lane by lane, k holding one scalar of nk words per lane.
+      The scalar bits are scanned from the most significant one set in any lane, each step
+      doubling and adding on every lane and keeping the sum where the scalar bit is set.
+    */
+    void mult(point& p, const point& b, const W* const* k, size_t nk) const
+    {
+        element a;
+        fp_.broadcast(a, a_);
+
+        size_t top = 0;
+        for (unsigned l = 0; l < LANE_COUNT; l++)
+            for (size_t i = nk; i > top / WB; i--)
+            {
+                W word = k[l][i - 1];
+                if (word == W(0)) continue;
+                size_t bits = (i - 1) * WB;
+                while (word != W(0)) { word >>= 1; bits++; }
+                if (bits > top) top = bits;
+                break;
+            }
+
+        point acc, sum;
+        fp::zero(acc.x);
+        fp::zero(acc.y);
+        fp::zero(acc.z);
+        for (size_t bit = top; bit > 0; bit--)
+        {
+            size_t i = (bit - 1) / WB;
+            W flag = W(1) << ((bit - 1) % WB);
+            mask take;
+            for (unsigned l = 0; l < LANE_COUNT; l++) take.lanes[l] = (k[l][i] & flag) ? uint64_t(-1) : 0;
+
+            twice(acc, acc, a);
+            add(sum, acc, b, a);
+            select(acc, acc, sum, take);
+        }
+        p = acc;
+    }
+
+    /**
+      Compute s = p1 + p2 lane by lane.
+    */
+    void add(point& s, const point& p1, const point& p2) const
+    {
+        element a;
+        fp_.broadcast(a, a_);
+        add(s, p1, p2, a);
+    }
+};
+
+}
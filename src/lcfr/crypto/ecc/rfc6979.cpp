@@ -0,0 +1,125 @@
+#include <string.h>
+#include "lcfr/crypto/ecc/rfc6979.h"
+
+namespace lcfr {
+
+namespace {
+
+// the key and the message of the first HMAC of every nonce (RFC 6979, 3.2 b and c)
+const uint8_t V0[SHA256_DIGEST_SIZE] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+const hmac_sha256& zero_key()
+{
+    static const uint8_t K0[SHA256_DIGEST_SIZE] = { 0 };
+    static const hmac_sha256 key(K0, sizeof(K0));
+    return key;
+}
+
+bool less(const uint8_t* a, const uint8_t* b, size_t n)
+{
+    return memcmp(a, b, n) < 0;
+}
+
+bool is_zero(const uint8_t* a, size_t n)
+{
+    uint8_t x = 0;
+    for (size_t i = 0; i < n; i++) x |= a[i];
+    return x == 0;
+}
+
+void sub(uint8_t* a, const uint8_t* b, size_t n)
+{
+    unsigned borrow = 0;
+    for (size_t i = n; i > 0; i--)
+    {
+        unsigned d = unsigned(a[i - 1]) - b[i - 1] - borrow;
+        a[i - 1] = uint8_t(d);
+        borrow = (d >> 8) & 1;
+    }
+}
+
+// K = HMAC_K(V || tag || suffix), V = HMAC_K(V)
+void update_key(hmac_sha256& key, uint8_t* v, uint8_t tag, const uint8_t* x, const uint8_t* h, size_t rlen)
+{
+    uint8_t k[SHA256_DIGEST_SIZE];
+    sha256 inner(key.inner());
+    inner.update(v, SHA256_DIGEST_SIZE);
+    inner.update(&tag, 1);
+    if (x)
+    {
+        inner.update(x, rlen);
+        inner.update(h, rlen);
+    }
+    key.final(k, inner);
+    key = hmac_sha256(k, sizeof(k));
+    key.mac(v, v, SHA256_DIGEST_SIZE);
+}
+
+}
+
+rfc6979_nonce::rfc6979_nonce(const uint8_t* q, size_t q_bits, const uint8_t* x)
+    : qlen_(q_bits),
+      rlen_((q_bits + 7) / 8),
+      prefix_(zero_key().inner())
+{
+    memcpy(q_, q, rlen_);
+    memcpy(x_, x, rlen_);
+    const uint8_t tag = 0x00;
+    prefix_.update(V0, sizeof(V0));
+    prefix_.update(&tag, 1);
+    prefix_.update(x_, rlen_);
+}
+
+rfc6979_nonce::~rfc6979_nonce()
+{
+    volatile uint8_t* x = x_;
+    for (size_t i = 0; i < sizeof(x_); i++) x[i] = 0;
+}
+
+// the leftmost qlen bits of b, as an integer of rlen bytes
+void rfc6979_nonce::bits2int(uint8_t* z, const uint8_t* b, size_t b_size) const
+{
+    size_t n = b_size < rlen_ ? b_size : rlen_;
+    memset(z, 0, rlen_ - n);
+    memcpy(z + rlen_ - n, b, n);
+    if (n * 8 <= qlen_) return;
+
+    unsigned shift = unsigned(n * 8 - qlen_);
+    for (size_t i = rlen_; i > 0; i--)
+        z[i - 1] = uint8_t((z[i - 1] >> shift) | (i > 1 ? z[i - 2] << (8 - shift) : 0));
+}
+
+void rfc6979_nonce::generate(uint8_t* k, const uint8_t* h, size_t h_size) const
+{
+    // bits2octets(h), bits2int(h) being less than 2q
+    uint8_t h1[MAX_BYTES];
+    bits2int(h1, h, h_size);
+    if (!less(h1, q_, rlen_)) sub(h1, q_, rlen_);
+
+    // step d starts from the cached prefix, step e to g as in the RFC
+    uint8_t v[SHA256_DIGEST_SIZE], kd[SHA256_DIGEST_SIZE];
+    sha256 inner(prefix_);
+    inner.update(h1, rlen_);
+    zero_key().final(kd, inner);
+    hmac_sha256 key(kd, sizeof(kd));
+    key.mac(v, V0, sizeof(V0));
+    update_key(key, v, 0x01, x_, h1, rlen_);
+
+    for (;;)
+    {
+        uint8_t t[MAX_BYTES];
+        for (size_t tlen = 0; tlen < rlen_; tlen += SHA256_DIGEST_SIZE)
+        {
+            key.mac(v, v, sizeof(v));
+            size_t n = rlen_ - tlen < SHA256_DIGEST_SIZE ? rlen_ - tlen : SHA256_DIGEST_SIZE;
+            memcpy(t + tlen, v, n);
+        }
+        bits2int(k, t, rlen_);
+        if (!is_zero(k, rlen_) && less(k, q_, rlen_)) return;
+        update_key(key, v, 0x00, nullptr, nullptr, rlen_);
+    }
+}
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "lcfr/crypto/hash/sha256.h"
+
+namespace lcfr {
+
+/** Deterministic ECDSA nonces of RFC 6979, with HMAC-SHA-256, for one private key.
+* Integers are big-endian byte strings of the byte size of the group order q.
+* The first HMAC of a nonce is keyed with zeros and its message starts with V || 0x00 || x,
+* which do not depend on the hash: its inner hash is kept with that prefix absorbed.
+*/
+class rfc6979_nonce
+{
+public:
+    static const size_t MAX_BYTES = 32;
+
+    /**
+      \param q the group order, of (q_bits + 7) / 8 bytes
+      \param x the private key, of the same size, between 1 and q - 1
+    */
+    rfc6979_nonce(const uint8_t* q, size_t q_bits, const uint8_t* x);
+    ~rfc6979_nonce();
+
+    /**
+      \param k the nonce, of size() bytes, between 1 and q - 1
+      \param h the hash of the message
+    */
+    void generate(uint8_t* k, const uint8_t* h, size_t h_size) const;
+
+    size_t size() const
+    {
+        return rlen_;
+    }
+
+    const uint8_t* key() const
+    {
+        return x_;
+    }
+
+private:
+    uint8_t q_[MAX_BYTES];
+    uint8_t x_[MAX_BYTES];
+    size_t  qlen_;
+    size_t  rlen_;
+    sha256  prefix_;
+
+    void bits2int(uint8_t* z, const uint8_t* b, size_t b_size) const;
+};
+
+}
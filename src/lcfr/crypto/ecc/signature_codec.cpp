@@ -0,0 +1,155 @@
+#include <string.h>
+#include "lcfr/crypto/ecc/signature_codec.h"
+
+namespace lcfr {
+
+namespace {
+
+const uint8_t SEQUENCE = 0x30;
+const uint8_t INTEGER = 0x02;
+
+// copy the big-endian integer a to x, left-padded with zeros, false if it does not fit
+bool copy_integer(uint8_t* x, size_t x_size, const uint8_t* a, size_t a_size)
+{
+    while (a_size > x_size)
+    {
+        if (*a != 0) return false;
+        a++;
+        a_size--;
+    }
+    memset(x, 0, x_size - a_size);
+    memcpy(x + x_size - a_size, a, a_size);
+    return true;
+}
+
+// the length of the DER content of the INTEGER a, with the 0x00 keeping it positive
+size_t integer_length(const uint8_t*& a, size_t& a_size)
+{
+    while (a_size > 1 && *a == 0)
+    {
+        a++;
+        a_size--;
+    }
+    if (a_size == 0) return 1;
+    return a_size + ((*a & 0x80) ? 1 : 0);
+}
+
+size_t length_size(size_t length)
+{
+    return length < 0x80 ? 1 : length < 0x100 ? 2 : 3;
+}
+
+uint8_t* put_length(uint8_t* p, size_t length)
+{
+    if (length >= 0x100)
+    {
+        *p++ = 0x82;
+        *p++ = uint8_t(length >> 8);
+    }
+    else if (length >= 0x80)
+    {
+        *p++ = 0x81;
+    }
+    *p++ = uint8_t(length);
+    return p;
+}
+
+uint8_t* put_integer(uint8_t* p, const uint8_t* a, size_t a_size, size_t length)
+{
+    *p++ = INTEGER;
+    p = put_length(p, length);
+    if (a_size == 0 || length > a_size) *p++ = 0;
+    memcpy(p, a, a_size);
+    return p + a_size;
+}
+
+// read a minimal DER length, false if malformed or beyond end
+bool get_length(const uint8_t*& p, const uint8_t* end, size_t& length)
+{
+    if (p == end) return false;
+    uint8_t b = *p++;
+    if (b < 0x80)
+    {
+        length = b;
+    }
+    else if (b == 0x81)
+    {
+        if (p == end || *p < 0x80) return false;
+        length = *p++;
+    }
+    else if (b == 0x82)
+    {
+        if (end - p < 2 || p[0] == 0) return false;
+        length = (size_t(p[0]) << 8) | p[1];
+        p += 2;
+    }
+    else
+    {
+        return false;
+    }
+    return length <= size_t(end - p);
+}
+
+bool get_integer(const uint8_t*& p, const uint8_t* end, uint8_t* x, size_t x_size)
+{
+    size_t length;
+    if (p == end || *p++ != INTEGER || !get_length(p, end, length)) return false;
+    // positive, without a leading zero not needed for the sign
+    if (length == 0 || (p[0] & 0x80)) return false;
+    if (length > 1 && p[0] == 0 && !(p[1] & 0x80)) return false;
+    bool ok = copy_integer(x, x_size, p, length);
+    p += length;
+    return ok;
+}
+
+}
+
+size_t encode_der_signature(
+    uint8_t* der, size_t der_size,
+    const uint8_t* r, size_t r_size,
+    const uint8_t* s, size_t s_size)
+{
+    size_t r_length = integer_length(r, r_size);
+    size_t s_length = integer_length(s, s_size);
+    size_t content = 1 + length_size(r_length) + r_length + 1 + length_size(s_length) + s_length;
+    if (content > 0xFFFF) return 0;
+    size_t size = 1 + length_size(content) + content;
+    if (der_size < size) return 0;
+
+    uint8_t* p = der;
+    *p++ = SEQUENCE;
+    p = put_length(p, content);
+    p = put_integer(p, r, r_size, r_length);
+    put_integer(p, s, s_size, s_length);
+    return size;
+}
+
+bool decode_der_signature(
+    uint8_t* r, size_t r_size,
+    uint8_t* s, size_t s_size,
+    const uint8_t* der, size_t der_size)
+{
+    const uint8_t* p = der;
+    const uint8_t* end = der + der_size;
+    size_t content;
+    if (p == end || *p++ != SEQUENCE || !get_length(p, end, content) || size_t(end - p) != content) return false;
+    return get_integer(p, end, r, r_size) && get_integer(p, end, s, s_size) && p == end;
+}
+
+bool encode_compact_signature(
+    uint8_t* c, size_t size,
+    const uint8_t* r, size_t r_size,
+    const uint8_t* s, size_t s_size)
+{
+    return copy_integer(c, size, r, r_size) && copy_integer(c + size, size, s, s_size);
+}
+
+bool decode_compact_signature(
+    uint8_t* r, size_t r_size,
+    uint8_t* s, size_t s_size,
+    const uint8_t* c, size_t size)
+{
+    return copy_integer(r, r_size, c, size) && copy_integer(s, s_size, c + size, size);
+}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace lcfr {
+
+/* Encodings of the ECDSA signatures (r, s), r and s being big-endian byte strings.
+* DER is the ASN.1 SEQUENCE of the two INTEGERs, compact is r and s on a fixed byte size each.
+* The functions work on the caller's arrays, without allocations.
+*/
+
+/**
+  \return the size of the DER encoding, 0 if der is too short or if a component is too large to encode
+*/
+size_t encode_der_signature(
+    uint8_t* der, size_t der_size,
+    const uint8_t* r, size_t r_size,
+    const uint8_t* s, size_t s_size);
+
+/**
+  Decode a DER signature, r and s being left-padded with zeros.
+  The encoding must be strict: minimal lengths, positive INTEGERs without extra leading zeros, no trailing bytes.
+  \return false if the encoding is malformed or a component does not fit in its array
+*/
+bool decode_der_signature(
+    uint8_t* r, size_t r_size,
+    uint8_t* s, size_t s_size,
+    const uint8_t* der, size_t der_size);
+
+/**
+  Write r and s on size bytes each.
+  \return false if a component does not fit in size bytes
+*/
+bool encode_compact_signature(
+    uint8_t* c, size_t size,
+    const uint8_t* r, size_t r_size,
+    const uint8_t* s, size_t s_size);
+
+/**
+  Read r and s of size bytes each.
+  \return false if a component does not fit in its array
+*/
+bool decode_compact_signature(
+    uint8_t* r, size_t r_size,
+    uint8_t* s, size_t s_size,
+    const uint8_t* c, size_t size);
+
+}
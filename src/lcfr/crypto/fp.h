@@ -2,6 +2,7 @@
 
 #include "lcfr/crypto/mp_arithmetic.h"
 #include "lcfr/crypto/uint.h"
+#include "lcfr/stats/counters.h"
 
 // https://primes.utm.edu/lists/2small/0bit.html
 // largest n-bit primes:
@@ -97,6 +98,34 @@ public:
     }
 };
 
+/** Step of the addition chain of a fixed exponent, see pw_fp::pow.
+* The step computes t[dest] = t[src]^(2^squares) * t[mult], t[0] being the base,
+* without the product if mult is NO_MULT. The result is the entry written by the last step.
+*/
+struct fp_chain_step
+{
+    uint8_t  dest;
+    uint8_t  src;
+    uint16_t squares;
+    uint8_t  mult;
+};
+
+static const uint8_t NO_MULT = 0xFF;
+
+struct fp_chain
+{
+    static const unsigned SLOTS = 16; // entries of the table t
+
+    const fp_chain_step* steps;
+    size_t               size;
+};
+
+template <size_t N>
+constexpr fp_chain fp_chain_of(const fp_chain_step (&steps)[N])
+{
+    return fp_chain{ steps, N };
+}
+
 /** Class implementig an integer-modulus-prime finite field.
   The integers are represented as array of primitive unsigned integers (least significant word before),
   the size in bit of the array equal to the bit size of the prime.
@@ -122,6 +151,23 @@ class pw_fp
     size_t                nm_;
     size_t                nr_;
 
+    // square roots: p - 1 = q * 2^s with q odd; for s = 1 sqrt_exp_ is (p + 1) / 4,
+    // otherwise it is (q - 1) / 2 and sqrt_c_ is z^q for a non-square z (Tonelli-Shanks)
+    unsigned              sqrt_s_;
+    ui<NB, W>             sqrt_exp_;
+    ui<NB, W>             sqrt_c_;
+
+    // addition chains of p - 2 and (p + 1) / 4, empty if not known for the prime
+    fp_chain              inverse_chain_;
+    fp_chain              sqrt_chain_;
+
+    static const unsigned POW_WINDOW = 4;
+
+    static bool bit(const W* e, size_t i)
+    {
+        return ((e[i / WB] >> (i % WB)) & W(1)) != 0;
+    }
+
     void init_m_from_prime()
     {
         lcfr::shift_left(two_pow_, ui<NB, W>::ONE, size_t(NP), size_t(NW));
@@ -134,28 +180,66 @@ class pw_fp
         lcfr::add(half_prime_, half_prime_, 1, size_t(NW));
     }
 
+    void init_sqrt()
+    {
+        ui<NB, W> q;
+        lcfr::sub(q, prime_, ui<NB, W>::ONE, size_t(NW));
+        for (sqrt_s_ = 0; (q[0] & W(1)) == 0; sqrt_s_++) lcfr::shift_right(q, q, size_t(1), size_t(NW));
+
+        if (sqrt_s_ == 1)
+        {
+            lcfr::shift_right(sqrt_exp_, prime_, size_t(2), size_t(NW));
+            lcfr::add(sqrt_exp_, sqrt_exp_, 1, size_t(NW));
+            return;
+        }
+        lcfr::shift_right(sqrt_exp_, q, size_t(1), size_t(NW));
+
+        // the smallest non-square, whose power (p - 1) / 2 is -1
+        ui<NB, W> e, z(W(2)), t, minus_one;
+        lcfr::sub(minus_one, prime_, ui<NB, W>::ONE, size_t(NW));
+        lcfr::shift_right(e, prime_, size_t(1), size_t(NW));
+        for (;; lcfr::add(z, z, 1, size_t(NW)))
+        {
+            pow(t, z, e, NW);
+            if (eq(t, minus_one, NW)) break;
+        }
+        pow(sqrt_c_, z, q, NW);
+    }
+
 public:
     /**
       Constructor taking the prime as imput and r = 4^NP / p.
       \param prime the prime number as hex string (most significant octet before)
       \param r barret reduction multiplier as hex string (most significant octet before)
+      \param inverse_chain optional addition chain of p - 2, used by inverse
+      \param sqrt_chain optional addition chain of (p + 1) / 4, used by sqrt
     */
-    pw_fp(const char* prime, const char* r)
+    pw_fp(const char* prime, const char* r,
+        const fp_chain& inverse_chain = fp_chain{ nullptr, 0 },
+        const fp_chain& sqrt_chain = fp_chain{ nullptr, 0 })
         : prime_(prime),
-          r_(r)
+          r_(r),
+          inverse_chain_(inverse_chain),
+          sqrt_chain_(sqrt_chain)
     {
         init_m_from_prime();
         init_half_prime();
         nr_ = r_.word_count(); // barret optimization
+        init_sqrt();
     }
 
-    pw_fp(const ui<NB, W>& prime, const ui<NB, W>& r)
+    pw_fp(const ui<NB, W>& prime, const ui<NB, W>& r,
+        const fp_chain& inverse_chain = fp_chain{ nullptr, 0 },
+        const fp_chain& sqrt_chain = fp_chain{ nullptr, 0 })
         : prime_(prime),
-          r_(r)
+          r_(r),
+          inverse_chain_(inverse_chain),
+          sqrt_chain_(sqrt_chain)
     {
         init_m_from_prime();
         init_half_prime();
         nr_ = r_.word_count(); // barret optimization
+        init_sqrt();
     }
 
     /**
@@ -166,6 +250,14 @@ public:
         return NP;
     }
 
+    /**
+      \return the addition chain of p - 2, empty if not known for the prime
+    */
+    const fp_chain& getInverseChain() const
+    {
+        return inverse_chain_;
+    }
+
     /**
       \return the prime number as array of primitive integers (least significant word before)
     */
@@ -228,6 +320,8 @@ public:
         ui<NB * 2, W> prod_;
         ui<NB * 3, W> temp_;
         lcfr::mult(prod_, a, b, size_t(NW));
+        LCFR_STATS_COUNT(FP_MULT, 1);
+        LCFR_STATS_COUNT(REDUCTION, 1);
         if (FW) barret(x, prod_, m_, r_, size_t(NW), nm_, nr_, temp_);
         else    barret(x, prod_, prime_, r_, size_t(NW), size_t(NP), temp_);
     }
@@ -277,6 +371,8 @@ public:
         ui<NB * 3, W> temp_;
         lcfr::square(prod_, a, size_t(NW));
         //::mult(prod_, a, a, size_t(NW));
+        LCFR_STATS_COUNT(FP_SQUARE, 1);
+        LCFR_STATS_COUNT(REDUCTION, 1);
         if (FW) barret(x, prod_, m_, r_, size_t(NW), nm_, nr_, temp_);
         else    barret(x, prod_, prime_, r_, size_t(NW), size_t(NP), temp_);
     }
@@ -288,6 +384,7 @@ public:
     */
     void inverse(W* z, const W* u) const
     {
+        LCFR_STATS_COUNT(FP_INVERSE, 1);
         ui<NB, W> one(W(1));
         ui<NB, W> x1(prime_);
         ui<NB, W> x2(u);
@@ -348,6 +445,119 @@ public:
         }
     }
 
+    /**
+      Calculates a power modulus prime of the input number, with sliding windows of POW_WINDOW bits.
+      \param x the result (the array must be allocated by the client)
+      \param a the base
+      \param e the exponent (least significant word before)
+      \param ne the exponent word size
+    */
+    void pow(W* x, const W* a, const W* e, size_t ne) const
+    {
+        // odd powers a, a^3, ..., a^(2^POW_WINDOW - 1)
+        ui<NB, W> odd[1 << (POW_WINDOW - 1)], a2;
+        lcfr::set(odd[0], a, NW);
+        square(a2, a);
+        for (unsigned k = 1; k < (1 << (POW_WINDOW - 1)); k++) mult(odd[k], odd[k - 1], a2);
+
+        ui<NB, W> r(W(1));
+        bool started = false;
+        for (size_t i = ne * WB; i > 0;)
+        {
+            if (!bit(e, i - 1))
+            {
+                if (started) square(r, r);
+                i--;
+                continue;
+            }
+            // the window is the bits from i - 1 down to j, the lowest being one
+            size_t j = i > POW_WINDOW ? i - POW_WINDOW : 0;
+            while (!bit(e, j)) j++;
+            unsigned v = 0;
+            for (size_t k = i; k > j; k--) v = (v << 1) | unsigned(bit(e, k - 1));
+            if (started)
+            {
+                for (size_t k = j; k < i; k++) square(r, r);
+                mult(r, r, odd[v >> 1]);
+            }
+            else
+            {
+                r = odd[v >> 1];
+                started = true;
+            }
+            i = j;
+        }
+        lcfr::set(x, r, NW);
+    }
+
+    /**
+      Calculates a power modulus prime of the input number, the exponent being given by its addition chain.
+      The sequence of squarings and multiplications does not depend on the base.
+      \param x the result (the array must be allocated by the client)
+      \param a the base
+      \param chain the addition chain of the exponent, not empty
+    */
+    void pow(W* x, const W* a, const fp_chain& chain) const
+    {
+        ui<NB, W> t[fp_chain::SLOTS], r;
+        lcfr::set(t[0], a, NW);
+        for (size_t i = 0; i < chain.size; i++)
+        {
+            const fp_chain_step& step = chain.steps[i];
+            if (step.squares == 0) r = t[step.src];
+            else                   square(r, t[step.src]);
+            for (unsigned k = 1; k < step.squares; k++) square(r, r);
+            if (step.mult != NO_MULT) mult(r, r, t[step.mult]);
+            t[step.dest] = r;
+        }
+        lcfr::set(x, r, NW);
+    }
+
+    /**
+      Calculates a square root modulus prime of the input number, a^((p + 1) / 4) if p = 3 mod 4
+      (with the addition chain of the prime if any), with the Tonelli-Shanks algorithm otherwise.
+      \param x the result (the array must be allocated by the client), the other root being p - x
+      \param a the input number
+      \return false if the input number is not a square, x being undefined
+    */
+    bool sqrt(W* x, const W* a) const
+    {
+        ui<NB, W> r, t;
+        if (sqrt_chain_.size > 0)
+        {
+            pow(r, a, sqrt_chain_);
+        }
+        else if (sqrt_s_ == 1)
+        {
+            pow(r, a, sqrt_exp_, NW);
+        }
+        else
+        {
+            // r = a^((q + 1) / 2) and t = a^q, r^2 = a t is kept while t is brought to 1
+            ui<NB, W> w, b, c(sqrt_c_);
+            pow(w, a, sqrt_exp_, NW);
+            mult(r, a, w);
+            mult(t, r, w);
+            unsigned m = sqrt_s_;
+            while (!eq(t, ui<NB, W>::ONE, NW) && !eq(t, ui<NB, W>::ZERO, NW))
+            {
+                unsigned i = 0;
+                for (b = t; i < m && !eq(b, ui<NB, W>::ONE, NW); i++) square(b, b);
+                if (i == m) return false;
+                b = c;
+                for (unsigned j = i + 1; j < m; j++) square(b, b);
+                square(c, b);
+                mult(t, t, c);
+                mult(r, r, b);
+                m = i;
+            }
+        }
+        square(t, r);
+        if (!eq(t, a, NW)) return false;
+        lcfr::set(x, r, NW);
+        return true;
+    }
+
     /**
       Calculates the modulus prime of the input number (slow operation).
       \param x the result (the array must be allocated by the client)
@@ -358,6 +568,7 @@ public:
     {
         ui<NB * 2, W> a_(a, na);
         ui<NB * 3, W> temp_;
+        LCFR_STATS_COUNT(REDUCTION, 1);
         if (FW) barret(x, a_, m_, r_, size_t(NW), nm_, nr_, temp_);
         else    barret(x, a_, prime_, r_, size_t(NW), size_t(NP), temp_);
     }
@@ -0,0 +1,401 @@
+#include <string.h>
+#include "lcfr/crypto/hash/sha256.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define LCFR_SHA256_X86 1
+#include <immintrin.h>
+#endif
+
+namespace lcfr {
+
+namespace {
+
+const unsigned L = SHA256_LANES;
+
+const uint32_t IV[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+alignas(16) const uint32_t K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+inline uint32_t load_be32(const uint8_t* p)
+{
+    return uint32_t(p[0]) << 24 | uint32_t(p[1]) << 16 | uint32_t(p[2]) << 8 | uint32_t(p[3]);
+}
+
+inline void store_be32(uint8_t* p, uint32_t x)
+{
+    p[0] = uint8_t(x >> 24);
+    p[1] = uint8_t(x >> 16);
+    p[2] = uint8_t(x >> 8);
+    p[3] = uint8_t(x);
+}
+
+inline void store_be64(uint8_t* p, uint64_t x)
+{
+    store_be32(p, uint32_t(x >> 32));
+    store_be32(p + 4, uint32_t(x));
+}
+
+// writes the padding and the bit length of a message of length bytes after the size % 64 bytes
+// of its last partial block, and returns the number of blocks of the tail, 1 or 2
+size_t pad(uint8_t* tail, const uint8_t* rest, size_t size, uint64_t length)
+{
+    size_t blocks = size + 9 <= SHA256_BLOCK_SIZE ? 1 : 2;
+    memcpy(tail, rest, size);
+    tail[size] = 0x80;
+    memset(tail + size + 1, 0, blocks * SHA256_BLOCK_SIZE - size - 9);
+    store_be64(tail + blocks * SHA256_BLOCK_SIZE - 8, length << 3);
+    return blocks;
+}
+
+// ------------------------------------------------------------------
+// portable kernel
+
+inline uint32_t rotr(uint32_t x, unsigned n)
+{
+    return (x >> n) | (x << (32 - n));
+}
+
+void compress_generic(uint32_t* state, const uint8_t* blocks, size_t count)
+{
+    for (; count > 0; count--, blocks += SHA256_BLOCK_SIZE)
+    {
+        uint32_t w[64];
+        for (unsigned i = 0; i < 16; i++) w[i] = load_be32(blocks + 4 * i);
+        for (unsigned i = 16; i < 64; i++)
+        {
+            uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        for (unsigned i = 0; i < 64; i++)
+        {
+            uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + (g ^ (e & (f ^ g))) + K[i] + w[i];
+            uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) | (c & (a | b)));
+            h = g; g = f; f = e; e = d + t1;
+            d = c; c = b; b = a; a = t1 + t2;
+        }
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+    }
+}
+
+const sha256_kernels GENERIC_KERNELS = { "generic", &compress_generic, nullptr };
+
+#ifdef LCFR_SHA256_X86
+// ------------------------------------------------------------------
+// AVX2 multi-buffer kernel, one message per 32-bit lane
+
+__attribute__((target("avx2")))
+inline __m256i rotr8(__m256i x, int n)
+{
+    return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+}
+
+__attribute__((target("avx2")))
+void compress_lanes_avx2(uint32_t* states, const uint8_t* const* blocks)
+{
+    __m256i w[16];
+    for (unsigned i = 0; i < 16; i++)
+    {
+        w[i] = _mm256_setr_epi32(
+            load_be32(blocks[0] + 4 * i), load_be32(blocks[1] + 4 * i),
+            load_be32(blocks[2] + 4 * i), load_be32(blocks[3] + 4 * i),
+            load_be32(blocks[4] + 4 * i), load_be32(blocks[5] + 4 * i),
+            load_be32(blocks[6] + 4 * i), load_be32(blocks[7] + 4 * i));
+    }
+
+    __m256i* s = reinterpret_cast<__m256i*>(states);
+    __m256i a = _mm256_loadu_si256(s + 0), b = _mm256_loadu_si256(s + 1);
+    __m256i c = _mm256_loadu_si256(s + 2), d = _mm256_loadu_si256(s + 3);
+    __m256i e = _mm256_loadu_si256(s + 4), f = _mm256_loadu_si256(s + 5);
+    __m256i g = _mm256_loadu_si256(s + 6), h = _mm256_loadu_si256(s + 7);
+
+    for (unsigned i = 0; i < 64; i++)
+    {
+        // the schedule is computed in place, w[i % 16] becoming w[i]
+        if (i >= 16)
+        {
+            __m256i w15 = w[(i - 15) & 15], w2 = w[(i - 2) & 15];
+            __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(rotr8(w15, 7), rotr8(w15, 18)), _mm256_srli_epi32(w15, 3));
+            __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(rotr8(w2, 17), rotr8(w2, 19)), _mm256_srli_epi32(w2, 10));
+            w[i & 15] = _mm256_add_epi32(_mm256_add_epi32(w[i & 15], s0), _mm256_add_epi32(w[(i - 7) & 15], s1));
+        }
+
+        __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(rotr8(e, 6), rotr8(e, 11)), rotr8(e, 25));
+        __m256i ch = _mm256_xor_si256(g, _mm256_and_si256(e, _mm256_xor_si256(f, g)));
+        __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, s1),
+            _mm256_add_epi32(ch, _mm256_add_epi32(_mm256_set1_epi32(K[i]), w[i & 15])));
+        __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(rotr8(a, 2), rotr8(a, 13)), rotr8(a, 22));
+        __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+        h = g; g = f; f = e; e = _mm256_add_epi32(d, t1);
+        d = c; c = b; b = a; a = _mm256_add_epi32(t1, _mm256_add_epi32(s0, maj));
+    }
+
+    _mm256_storeu_si256(s + 0, _mm256_add_epi32(_mm256_loadu_si256(s + 0), a));
+    _mm256_storeu_si256(s + 1, _mm256_add_epi32(_mm256_loadu_si256(s + 1), b));
+    _mm256_storeu_si256(s + 2, _mm256_add_epi32(_mm256_loadu_si256(s + 2), c));
+    _mm256_storeu_si256(s + 3, _mm256_add_epi32(_mm256_loadu_si256(s + 3), d));
+    _mm256_storeu_si256(s + 4, _mm256_add_epi32(_mm256_loadu_si256(s + 4), e));
+    _mm256_storeu_si256(s + 5, _mm256_add_epi32(_mm256_loadu_si256(s + 5), f));
+    _mm256_storeu_si256(s + 6, _mm256_add_epi32(_mm256_loadu_si256(s + 6), g));
+    _mm256_storeu_si256(s + 7, _mm256_add_epi32(_mm256_loadu_si256(s + 7), h));
+}
+
+const sha256_kernels AVX2_KERNELS = { "avx2", &compress_generic, &compress_lanes_avx2 };
+
+// ------------------------------------------------------------------
+// SHA extensions kernel, the state being kept as the ABEF and CDGH halves used by sha256rnds2
+
+__attribute__((target("sha,sse4.1")))
+void compress_shani(uint32_t* state, const uint8_t* blocks, size_t count)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bull, 0x0405060700010203ull);
+
+    __m128i t = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0xB1);        // CDAB
+    __m128i cdgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state + 4)), 0x1B); // EFGH
+    __m128i abef = _mm_alignr_epi8(t, cdgh, 8);
+    cdgh = _mm_blend_epi16(cdgh, t, 0xF0);
+
+    for (; count > 0; count--, blocks += SHA256_BLOCK_SIZE)
+    {
+        const __m128i abef_saved = abef, cdgh_saved = cdgh;
+        __m128i m[4];
+
+        // four rounds per step, the schedule being computed four words ahead by sha256msg1 and sha256msg2
+#pragma GCC unroll 16
+        for (unsigned i = 0; i < 16; i++)
+        {
+            if (i < 4) m[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks + 16 * i)), bswap);
+            __m128i k = _mm_add_epi32(m[i & 3], _mm_load_si128(reinterpret_cast<const __m128i*>(K + 4 * i)));
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, k);
+            if (i >= 3 && i < 15)
+            {
+                __m128i next = _mm_add_epi32(m[(i + 1) & 3], _mm_alignr_epi8(m[i & 3], m[(i - 1) & 3], 4));
+                m[(i + 1) & 3] = _mm_sha256msg2_epu32(next, m[i & 3]);
+            }
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(k, 0x0E));
+            if (i >= 1 && i < 13) m[(i - 1) & 3] = _mm_sha256msg1_epu32(m[(i - 1) & 3], m[i & 3]);
+        }
+
+        abef = _mm_add_epi32(abef, abef_saved);
+        cdgh = _mm_add_epi32(cdgh, cdgh_saved);
+    }
+
+    t = _mm_shuffle_epi32(abef, 0x1B);                                          // FEBA
+    cdgh = _mm_shuffle_epi32(cdgh, 0xB1);                                       // DCHG
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_blend_epi16(t, cdgh, 0xF0));         // DCBA
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4), _mm_alignr_epi8(cdgh, t, 8));        // HGFE
+}
+
+// one message at a time with the SHA extensions beats eight with AVX2 for every message size,
+// by a third for 1 KB messages on a cpu having both, so that the multi-buffer path is left out
+const sha256_kernels SHANI_KERNELS = { "sha-ni", &compress_shani, nullptr };
+
+bool shani_supported()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1");
+}
+#endif
+
+const sha256_kernels& select_sha256_kernels()
+{
+#ifdef LCFR_SHA256_X86
+    if (shani_supported()) return SHANI_KERNELS;
+    if (__builtin_cpu_supports("avx2")) return AVX2_KERNELS;
+#endif
+    return GENERIC_KERNELS;
+}
+
+// the table is filled in while the library is loaded, the generic kernels serving any earlier call
+const sha256_kernels* kernels_ = &GENERIC_KERNELS;
+
+struct sha256_kernels_selector
+{
+    sha256_kernels_selector()
+    {
+        kernels_ = &select_sha256_kernels();
+    }
+} sha256_kernels_selector_;
+
+// hashes up to SHA256_LANES messages with the multi-buffer kernel, a lane whose message is over
+// keeps compressing its last block until the longest message is done, its digest being taken before
+void digest_lanes(
+    void (*compress_lanes)(uint32_t*, const uint8_t* const*),
+    uint8_t* digests, const uint8_t* const* m, const uint32_t* m_sizes, size_t count)
+{
+    alignas(32) uint32_t states[8 * L];
+    alignas(32) uint8_t tails[L][2 * SHA256_BLOCK_SIZE];
+    size_t full[L], blocks[L], steps = 0;
+    const uint8_t* block[L];
+
+    for (unsigned l = 0; l < L; l++)
+    {
+        for (unsigned j = 0; j < 8; j++) states[j * L + l] = IV[j];
+        if (l < count)
+        {
+            full[l] = m_sizes[l] / SHA256_BLOCK_SIZE;
+            blocks[l] = full[l] + pad(tails[l], m[l] + full[l] * SHA256_BLOCK_SIZE, m_sizes[l] % SHA256_BLOCK_SIZE, m_sizes[l]);
+            if (blocks[l] > steps) steps = blocks[l];
+        }
+        else
+        {
+            memset(tails[l], 0, SHA256_BLOCK_SIZE);
+            full[l] = blocks[l] = 0;
+        }
+    }
+
+    for (size_t i = 0; i < steps; i++)
+    {
+        for (unsigned l = 0; l < L; l++)
+        {
+            if (i < full[l]) block[l] = m[l] + i * SHA256_BLOCK_SIZE;
+            else if (i < blocks[l]) block[l] = tails[l] + (i - full[l]) * SHA256_BLOCK_SIZE;
+            else block[l] = tails[l];
+        }
+        compress_lanes(states, block);
+        for (unsigned l = 0; l < count; l++)
+        {
+            if (i + 1 != blocks[l]) continue;
+            for (unsigned j = 0; j < 8; j++) store_be32(digests + l * SHA256_DIGEST_SIZE + 4 * j, states[j * L + l]);
+        }
+    }
+}
+
+}
+
+const sha256_kernels& get_sha256_kernels()
+{
+    return *kernels_;
+}
+
+bool set_sha256_kernels(const char* name)
+{
+    const sha256_kernels* candidates[] = {
+#ifdef LCFR_SHA256_X86
+        shani_supported() ? &SHANI_KERNELS : nullptr,
+        __builtin_cpu_supports("avx2") ? &AVX2_KERNELS : nullptr,
+#endif
+        &GENERIC_KERNELS
+    };
+    for (const sha256_kernels* k : candidates)
+    {
+        if (k && strcmp(k->name, name) == 0)
+        {
+            kernels_ = k;
+            return true;
+        }
+    }
+    return false;
+}
+
+void sha256::reset()
+{
+    memcpy(state_, IV, sizeof(state_));
+    buffered_ = 0;
+    length_ = 0;
+}
+
+void sha256::update(const uint8_t* data, size_t size)
+{
+    const sha256_kernels& k = get_sha256_kernels();
+    length_ += size;
+    if (buffered_ > 0)
+    {
+        size_t n = SHA256_BLOCK_SIZE - buffered_;
+        if (n > size) n = size;
+        memcpy(buffer_ + buffered_, data, n);
+        buffered_ += n;
+        data += n;
+        size -= n;
+        if (buffered_ < SHA256_BLOCK_SIZE) return;
+        k.compress(state_, buffer_, 1);
+        buffered_ = 0;
+    }
+    size_t blocks = size / SHA256_BLOCK_SIZE;
+    if (blocks > 0) k.compress(state_, data, blocks);
+    buffered_ = size % SHA256_BLOCK_SIZE;
+    memcpy(buffer_, data + blocks * SHA256_BLOCK_SIZE, buffered_);
+}
+
+void sha256::final(uint8_t* digest)
+{
+    uint8_t tail[2 * SHA256_BLOCK_SIZE];
+    size_t blocks = pad(tail, buffer_, buffered_, length_);
+    get_sha256_kernels().compress(state_, tail, blocks);
+    for (unsigned j = 0; j < 8; j++) store_be32(digest + 4 * j, state_[j]);
+}
+
+hmac_sha256::hmac_sha256(const uint8_t* key, size_t key_size)
+{
+    uint8_t pad[SHA256_BLOCK_SIZE] = { 0 };
+    if (key_size > SHA256_BLOCK_SIZE) sha256_digest(pad, key, key_size);
+    else memcpy(pad, key, key_size);
+
+    for (uint8_t& b : pad) b ^= 0x36;
+    inner_.update(pad, sizeof(pad));
+    for (uint8_t& b : pad) b ^= 0x36 ^ 0x5c;
+    outer_.update(pad, sizeof(pad));
+}
+
+void hmac_sha256::final(uint8_t* mac, sha256& inner) const
+{
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    inner.final(digest);
+    sha256 outer(outer_);
+    outer.update(digest, sizeof(digest));
+    outer.final(mac);
+}
+
+void hmac_sha256::mac(uint8_t* mac, const uint8_t* m, size_t m_size) const
+{
+    sha256 inner(inner_);
+    inner.update(m, m_size);
+    final(mac, inner);
+}
+
+void sha256_digest(uint8_t* digest, const uint8_t* m, size_t m_size)
+{
+    const sha256_kernels& k = get_sha256_kernels();
+    uint32_t state[8];
+    memcpy(state, IV, sizeof(state));
+    size_t full = m_size / SHA256_BLOCK_SIZE;
+    if (full > 0) k.compress(state, m, full);
+
+    uint8_t tail[2 * SHA256_BLOCK_SIZE];
+    size_t blocks = pad(tail, m + full * SHA256_BLOCK_SIZE, m_size % SHA256_BLOCK_SIZE, m_size);
+    k.compress(state, tail, blocks);
+    for (unsigned j = 0; j < 8; j++) store_be32(digest + 4 * j, state[j]);
+}
+
+void sha256_digests(uint8_t* digests, const uint8_t* const* m, const uint32_t* m_sizes, size_t count)
+{
+    const sha256_kernels& k = get_sha256_kernels();
+    size_t i = 0;
+    if (k.compress_lanes)
+    {
+        // a lone message is not worth the eight lanes
+        for (; i + 1 < count; i += L)
+        {
+            size_t n = count - i < L ? count - i : L;
+            digest_lanes(k.compress_lanes, digests + i * SHA256_DIGEST_SIZE, m + i, m_sizes + i, n);
+        }
+    }
+    for (; i < count; i++) sha256_digest(digests + i * SHA256_DIGEST_SIZE, m[i], m_sizes[i]);
+}
+
+}
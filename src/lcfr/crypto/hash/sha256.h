@@ -0,0 +1,99 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace lcfr {
+
+static const size_t SHA256_DIGEST_SIZE = 32;
+static const size_t SHA256_BLOCK_SIZE = 64;
+
+// messages hashed side by side by the multi-buffer kernel
+static const unsigned SHA256_LANES = 8;
+
+/** SHA-256 compression kernels.
+* compress processes count consecutive blocks into the eight state words.
+* compress_lanes, if any, processes one block of each of SHA256_LANES independent messages:
+* word j of lane l is states[j * SHA256_LANES + l], as for the lane elements of lane_kernels.
+*/
+struct sha256_kernels
+{
+    const char* name;
+    void (*compress)(uint32_t* state, const uint8_t* blocks, size_t count);
+    void (*compress_lanes)(uint32_t* states, const uint8_t* const* blocks);
+};
+
+/**
+  \return the fastest kernels supported by the running cpu, selected while the library is loaded
+*/
+const sha256_kernels& get_sha256_kernels();
+
+/**
+  Replace the kernels with the ones of the given name ("generic", "avx2" or "sha-ni"),
+  so that benchmarks can compare them. It is not synchronized with the running computations.
+  \return false if the kernels are unknown or not supported by the running cpu
+*/
+bool set_sha256_kernels(const char* name);
+
+/** Incremental SHA-256 of a message given in pieces.
+*/
+class sha256
+{
+public:
+    sha256()
+    {
+        reset();
+    }
+
+    void reset();
+    void update(const uint8_t* data, size_t size);
+
+    // writes the SHA256_DIGEST_SIZE bytes of the digest, the object must be reset before another message
+    void final(uint8_t* digest);
+
+private:
+    uint32_t state_[8];
+    uint8_t  buffer_[SHA256_BLOCK_SIZE];
+    size_t   buffered_;
+    uint64_t length_;
+};
+
+/** HMAC-SHA-256 (RFC 2104) keeping the hashes of the inner and outer padded keys,
+* so that the MACs computed with the key start from them instead of hashing the pads again.
+*/
+class hmac_sha256
+{
+public:
+    hmac_sha256(const uint8_t* key, size_t key_size);
+
+    // the inner hash with the padded key absorbed, to be copied and fed with a message
+    const sha256& inner() const
+    {
+        return inner_;
+    }
+
+    // writes the SHA256_DIGEST_SIZE bytes of the MAC of the message fed into inner, a copy of inner()
+    void final(uint8_t* mac, sha256& inner) const;
+
+    void mac(uint8_t* mac, const uint8_t* m, size_t m_size) const;
+
+private:
+    sha256 inner_;
+    sha256 outer_;
+};
+
+/**
+  Hash a whole message.
+  \param digest the SHA256_DIGEST_SIZE bytes of the digest
+*/
+void sha256_digest(uint8_t* digest, const uint8_t* m, size_t m_size);
+
+/**
+  Hash count independent messages, SHA256_LANES at a time when the kernels have a multi-buffer path.
+  \param digests the count digests, one after the other
+  \param m the addresses of the messages
+  \param m_sizes the byte sizes of the messages
+*/
+void sha256_digests(uint8_t* digests, const uint8_t* const* m, const uint32_t* m_sizes, size_t count);
+
+}
@@ -4,6 +4,10 @@
 #include "intrin.h"
 #endif
 
+#if (defined(__x86_64__) && defined(__GNUC__))
+#include <immintrin.h>
+#endif
+
 namespace lcfr {
 
 template <class W>
@@ -444,16 +448,173 @@ void or_imp(W* x, const W* a, const W* b, size_t n)
     for (size_t i = 0; i < n; i++) x[i] = a[i] | b[i];
 }
 
-template <class W>
+// word multiplication used by the reductions, the default one being the schoolbook product
+struct narrow_mult
+{
+    template <class W>
+    static void mult(W* x, const W* a, const W* b, size_t na, size_t nb)
+    {
+        mult_imp(x, a, b, na, nb);
+    }
+
+    template <class W>
+    static void square(W* x, const W* a, size_t n)
+    {
+        square_imp(x, a, n);
+    }
+};
+
+#ifdef __SIZEOF_INT128__
+// pairs of 32-bit words are multiplied as 64-bit words by M, quartering the number of word products
+template <class M>
+struct wide_mult
+{
+    static const size_t MAX_WORDS = 32;
+    static const size_t MIN_PRODUCTS = 36;   // smaller products do not pay back the widening
+
+    static size_t widen(uint64_t* y, const uint32_t* a, size_t n)
+    {
+        size_t m = n / 2;
+        for (size_t i = 0; i < m; i++) y[i] = uint64_t(a[2 * i]) | (uint64_t(a[2 * i + 1]) << 32);
+        if (n % 2 == 0) return m;
+        y[m] = a[n - 1];
+        return m + 1;
+    }
+
+    static void narrow(uint32_t* x, const uint64_t* y, size_t n)
+    {
+        for (size_t i = 0; i < n; i++) x[i] = uint32_t(y[i / 2] >> (32 * (i % 2)));
+    }
+
+    // at -O1 the inlined product loops are not tied to the widened sizes, tripping a spurious uninitialized warning
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+    static void mult(uint32_t* x, const uint32_t* a, const uint32_t* b, size_t na, size_t nb)
+    {
+        if ((na > 2 * MAX_WORDS) || (nb > 2 * MAX_WORDS) || (na * nb < MIN_PRODUCTS))
+        {
+            mult_imp(x, a, b, na, nb);
+            return;
+        }
+        uint64_t a64[MAX_WORDS], b64[MAX_WORDS], x64[2 * MAX_WORDS];
+        size_t ma = widen(a64, a, na);
+        size_t mb = widen(b64, b, nb);
+        M::mult(x64, a64, b64, ma, mb);
+        narrow(x, x64, na + nb);
+    }
+
+    static void square(uint32_t* x, const uint32_t* a, size_t n)
+    {
+        if ((n > 2 * MAX_WORDS) || (n * n < MIN_PRODUCTS))
+        {
+            square_imp(x, a, n);
+            return;
+        }
+        uint64_t a64[MAX_WORDS], x64[2 * MAX_WORDS];
+        size_t m = widen(a64, a, n);
+        M::square(x64, a64, m);
+        narrow(x, x64, 2 * n);
+    }
+#pragma GCC diagnostic pop
+};
+
+struct int128_words
+{
+    static void mult(uint64_t* x, const uint64_t* a, const uint64_t* b, size_t na, size_t nb)
+    {
+        mult_imp(x, a, b, na, nb);
+    }
+
+    static void square(uint64_t* x, const uint64_t* a, size_t n)
+    {
+        square_imp(x, a, n);
+    }
+};
+
+#if (defined(__x86_64__) && defined(__GNUC__))
+// y[0..n) += a m and y[n] = the carry word, n > 0: the low halves of the products are summed on the adcx carry chain
+// and the high halves on the adox one, the loop being counted with lea and jrcxz that leave both flags untouched
+inline void mulx_row(uint64_t* y, const uint64_t* a, uint64_t m, size_t n)
+{
+    uint64_t h, lo, hi;
+    __asm__ volatile(
+        "xorl %k[h], %k[h]\n\t"
+        "1:\n\t"
+        "mulxq (%[a]), %[lo], %[hi]\n\t"
+        "adoxq %[h], %[lo]\n\t"
+        "adcxq (%[y]), %[lo]\n\t"
+        "movq %[lo], (%[y])\n\t"
+        "movq %[hi], %[h]\n\t"
+        "leaq 8(%[a]), %[a]\n\t"
+        "leaq 8(%[y]), %[y]\n\t"
+        "leaq -1(%[n]), %[n]\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n\t"
+        "2:\n\t"
+        "movl $0, %k[lo]\n\t"
+        "adoxq %[lo], %[h]\n\t"
+        "adcxq %[lo], %[h]\n\t"
+        "movq %[h], (%[y])"
+        : [y] "+r"(y), [a] "+r"(a), [n] "+c"(n), [h] "=&r"(h), [lo] "=&r"(lo), [hi] "=&r"(hi)
+        : "d"(m)
+        : "cc", "memory");
+}
+
+__attribute__((target("bmi2,adx")))
+void mult_mulx(uint64_t* x, const uint64_t* a, const uint64_t* b, size_t na, size_t nb)
+{
+    for (size_t i = 0; i < na; i++) x[i] = 0;
+    for (size_t j = 0; j < nb; j++) mulx_row(x + j, a, b[j], na);
+}
+
+// the products a[i] a[j], i < j, are summed by rows, then doubled while the squares a[i]^2 are added
+__attribute__((target("bmi2,adx")))
+void square_mulx(uint64_t* x, const uint64_t* a, size_t n)
+{
+    for (size_t i = 0; i < n; i++) x[i] = 0;
+    for (size_t j = 0; j + 1 < n; j++) mulx_row(x + 2 * j + 1, a + j + 1, a[j], n - j - 1);
+    x[2 * n - 1] = 0;
+
+    uint64_t t = 0;
+    unsigned char c = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        unsigned long long hi, s;
+        unsigned long long lo = _mulx_u64(a[i], a[i], &hi);
+        uint64_t x0 = x[2 * i], x1 = x[2 * i + 1];
+        c = _addcarryx_u64(c, (x0 << 1) | t, lo, &s);
+        x[2 * i] = s;
+        c = _addcarryx_u64(c, (x1 << 1) | (x0 >> 63), hi, &s);
+        x[2 * i + 1] = s;
+        t = x1 >> 63;
+    }
+}
+
+struct mulx_words
+{
+    static void mult(uint64_t* x, const uint64_t* a, const uint64_t* b, size_t na, size_t nb)
+    {
+        mult_mulx(x, a, b, na, nb);
+    }
+
+    static void square(uint64_t* x, const uint64_t* a, size_t n)
+    {
+        square_mulx(x, a, n);
+    }
+};
+#endif
+#endif
+
+template <class K, class W>
 void barret_imp(W* x, const W* p, const W* m, const W* r, size_t n, size_t nm, size_t nr, W* t)
 {
     // mudulus = 2^n - m
     // t = p * (2^n + r)    r ~ m (1 + m / 2^n)
-    mult_imp(t, p, r, 2 * n, nr);
+    K::mult(t, p, r, 2 * n, nr);
     add_imp(t + n, p, t + n, 2 * n, n + nr);
 
     // t = floor(t * 2^-2n) * (2^n - m)
-    mult_imp(t, t + 2 * n, m, n, nm);
+    K::mult(t, t + 2 * n, m, n, nm);
     two(t, t, 2 * n, n + nm);
     add_imp(t + n, t + 2 * n, t + n, n, n);
 
@@ -464,13 +625,13 @@ void barret_imp(W* x, const W* p, const W* m, const W* r, size_t n, size_t nm, s
     else add_imp(x, t, m, n, nm);
 }
 
-template <class W>
+template <class K, class W>
 void barret_imp(W* x, const W* prod, const W* prime, const W* r, size_t nw, size_t npb, W* t)
 {
-    mult_imp(t, prod, r, 2 * nw, nw);
+    K::mult(t, prod, r, 2 * nw, nw);
     shift_right_imp(t, t, npb * 2, 3 * nw);
 
-    mult_imp(t + nw, t, prime, nw, nw);
+    K::mult(t + nw, t, prime, nw, nw);
     sub_imp(t + nw, prod, t + nw, 2 * nw);
 
     bool done = z_imp(t + 2 * nw, nw) && l(t + nw, prime, nw);
@@ -598,6 +759,115 @@ bool le_imp(const W* a, const W* b, size_t n)
     return true;
 }
 
+// ------------------------------------------------------------------
+// 32-bit word multiplication and reduction kernels, selected once for the running cpu
+namespace {
+
+struct mp_kernels
+{
+    const char* name;
+    void (*mult)(uint32_t* x, const uint32_t* a, const uint32_t* b, size_t na, size_t nb);
+    void (*square)(uint32_t* x, const uint32_t* a, size_t n);
+    void (*barret_m)(uint32_t* x, const uint32_t* p, const uint32_t* m, const uint32_t* r, size_t n, size_t nm, size_t nr, uint32_t* t);
+    void (*barret_p)(uint32_t* x, const uint32_t* prod, const uint32_t* prime, const uint32_t* r, size_t nw, size_t npb, uint32_t* t);
+};
+
+template <class K>
+void mult_kernel(uint32_t* x, const uint32_t* a, const uint32_t* b, size_t na, size_t nb)
+{
+    K::mult(x, a, b, na, nb);
+}
+
+template <class K>
+void square_kernel(uint32_t* x, const uint32_t* a, size_t n)
+{
+    K::square(x, a, n);
+}
+
+template <class K>
+void barret_m_kernel(uint32_t* x, const uint32_t* p, const uint32_t* m, const uint32_t* r, size_t n, size_t nm, size_t nr, uint32_t* t)
+{
+    barret_imp<K>(x, p, m, r, n, nm, nr, t);
+}
+
+template <class K>
+void barret_p_kernel(uint32_t* x, const uint32_t* prod, const uint32_t* prime, const uint32_t* r, size_t nw, size_t npb, uint32_t* t)
+{
+    barret_imp<K>(x, prod, prime, r, nw, npb, t);
+}
+
+const mp_kernels GENERIC_MP_KERNELS = {
+    "generic",
+    &mult_kernel<narrow_mult>, &square_kernel<narrow_mult>,
+    &barret_m_kernel<narrow_mult>, &barret_p_kernel<narrow_mult> };
+
+#ifdef __SIZEOF_INT128__
+const mp_kernels WIDE_MP_KERNELS = {
+    "int128",
+    &mult_kernel<wide_mult<int128_words>>, &square_kernel<wide_mult<int128_words>>,
+    &barret_m_kernel<wide_mult<int128_words>>, &barret_p_kernel<wide_mult<int128_words>> };
+
+#if (defined(__x86_64__) && defined(__GNUC__))
+const mp_kernels MULX_MP_KERNELS = {
+    "bmi2-adx",
+    &mult_kernel<wide_mult<mulx_words>>, &square_kernel<wide_mult<mulx_words>>,
+    &barret_m_kernel<wide_mult<mulx_words>>, &barret_p_kernel<wide_mult<mulx_words>> };
+#endif
+#endif
+
+const mp_kernels& select_mp_kernels()
+{
+#ifdef __SIZEOF_INT128__
+#if (defined(__x86_64__) && defined(__GNUC__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx")) return MULX_MP_KERNELS;
+#endif
+    return WIDE_MP_KERNELS;
+#else
+    return GENERIC_MP_KERNELS;
+#endif
+}
+
+// the table is filled in while the library is loaded, the generic kernels serving any earlier call
+const mp_kernels* mp_kernels_ = &GENERIC_MP_KERNELS;
+
+struct mp_kernels_selector
+{
+    mp_kernels_selector()
+    {
+        mp_kernels_ = &select_mp_kernels();
+    }
+} mp_kernels_selector_;
+
+}
+
+const char* get_mp_kernels_name()
+{
+    return mp_kernels_->name;
+}
+
+bool set_mp_kernels(const char* name)
+{
+    const mp_kernels* candidates[] = {
+#ifdef __SIZEOF_INT128__
+#if (defined(__x86_64__) && defined(__GNUC__))
+        __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx") ? &MULX_MP_KERNELS : nullptr,
+#endif
+        &WIDE_MP_KERNELS,
+#endif
+        &GENERIC_MP_KERNELS
+    };
+    for (const mp_kernels* k : candidates)
+    {
+        if (k && strcmp(k->name, name) == 0)
+        {
+            mp_kernels_ = k;
+            return true;
+        }
+    }
+    return false;
+}
+
 void zero(uint32_t* x, size_t n)
 {
     zero_imp(x, n);
@@ -640,18 +910,18 @@ int32_t sub(uint32_t* x, const uint32_t* a, const uint32_t* b, size_t na, size_t
 
 void mult(uint32_t* x, const uint32_t* a, const uint32_t* b, size_t n)
 {
-    mult_imp(x, a, b, n, n);
+    mp_kernels_->mult(x, a, b, n, n);
 }
 
 void mult(uint32_t* x, const uint32_t* a, const uint32_t* b, size_t na, size_t nb)
 {
-    mult_imp(x, a, b, na, nb);
+    mp_kernels_->mult(x, a, b, na, nb);
 }
 
 void square(uint32_t* x, const uint32_t* a, size_t na)
 {
     //mult_imp(x, a, a, na, na);
-    square_imp(x, a, na);
+    mp_kernels_->square(x, a, na);
 }
 
 uint32_t mult_add(uint32_t* x, const uint32_t* a, const uint32_t* b, uint32_t m, size_t na, size_t nb)
@@ -707,12 +977,12 @@ void bitwise_or(uint32_t* x, const uint32_t* a, const uint32_t* b, size_t n)
 //   < x^2 + p
 void barret(uint32_t* x, const uint32_t* p, const uint32_t* m, const uint32_t* r, size_t n, size_t nm, size_t nr, uint32_t* t)
 {
-    barret_imp(x, p, m, r, n, nm, nr, t);
+    mp_kernels_->barret_m(x, p, m, r, n, nm, nr, t);
 }
 
 void barret(uint32_t* x, const uint32_t* prod, const uint32_t* prime, const uint32_t* r, size_t nw, size_t npb, uint32_t* t)
 {
-    barret_imp(x, prod, prime, r, nw, npb, t);
+    mp_kernels_->barret_p(x, prod, prime, r, nw, npb, t);
 }
 
 uint32_t inverse(uint32_t x)
@@ -854,12 +1124,12 @@ void bitwise_or(uint16_t* x, const uint16_t* a, const uint16_t* b, size_t n)
 
 void barret(uint16_t* x, const uint16_t* p, const uint16_t* m, const uint16_t* r, size_t n, size_t nm, size_t nr, uint16_t* t)
 {
-    barret_imp(x, p, m, r, n, nm, nr, t);
+    barret_imp<narrow_mult>(x, p, m, r, n, nm, nr, t);
 }
 
 void barret(uint16_t* x, const uint16_t* prod, const uint16_t* prime, const uint16_t* r, size_t nw, size_t npb, uint16_t* t)
 {
-    barret_imp(x, prod, prime, r, nw, npb, t);
+    barret_imp<narrow_mult>(x, prod, prime, r, nw, npb, t);
 }
 
 uint16_t inverse(uint16_t x)
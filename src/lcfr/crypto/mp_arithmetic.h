@@ -8,6 +8,17 @@ template <class W>
 struct uint_traits {
 };
 
+#ifdef __SIZEOF_INT128__
+template <>
+struct uint_traits<uint64_t>
+{
+    typedef unsigned __int128 d;
+    typedef __int128 sd;
+    typedef int64_t s;
+    enum : unsigned { bits = 8 * sizeof(uint64_t) };
+};
+#endif
+
 template <>
 struct uint_traits<uint32_t>
 {
@@ -75,6 +86,18 @@ bool l(const uint32_t* a, const uint32_t* b, size_t n);
 bool ge(const uint32_t* a, const uint32_t* b, size_t n);
 bool le(const uint32_t* a, const uint32_t* b, size_t n);
 
+/**
+  \return the name of the 32-bit word multiplication and reduction kernels selected for the running cpu
+*/
+const char* get_mp_kernels_name();
+
+/**
+  Replace the 32-bit word kernels with the ones of the given name ("generic", "int128" or "bmi2-adx"),
+  so that benchmarks can compare them. It is not synchronized with the running computations.
+  \return false if the kernels are unknown or not supported by the running cpu
+*/
+bool set_mp_kernels(const char* name);
+
 // ------------------------------------------------------------------
 void zero(uint16_t* x, size_t n);
 void set(uint16_t* x, const uint16_t* a, size_t n);
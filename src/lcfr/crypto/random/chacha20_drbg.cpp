@@ -0,0 +1,160 @@
+#include <string.h>
+#include <atomic>
+#include <stdexcept>
+#ifdef __linux__
+#include <errno.h>
+#include <sys/random.h>
+#else
+#include <random>
+#endif
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+#include "lcfr/crypto/random/chacha20_drbg.h"
+
+namespace lcfr {
+
+namespace {
+
+inline uint32_t rotl(uint32_t x, unsigned n)
+{
+    return (x << n) | (x >> (32 - n));
+}
+
+inline uint32_t load32(const uint8_t* p)
+{
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+inline void store32(uint8_t* p, uint32_t x)
+{
+    p[0] = uint8_t(x); p[1] = uint8_t(x >> 8); p[2] = uint8_t(x >> 16); p[3] = uint8_t(x >> 24);
+}
+
+#define QUARTER_ROUND(a, b, c, d) \
+    a += b; d ^= a; d = rotl(d, 16); \
+    c += d; b ^= c; b = rotl(b, 12); \
+    a += b; d ^= a; d = rotl(d, 8);  \
+    c += d; b ^= c; b = rotl(b, 7);
+
+// forks of the process, counted in the child: the generators seeded before a fork take a new seed
+std::atomic<unsigned> forks(0);
+
+#ifndef _WIN32
+struct fork_handler
+{
+    fork_handler()
+    {
+        pthread_atfork(nullptr, nullptr, [] { forks.fetch_add(1, std::memory_order_relaxed); });
+    }
+} fork_handler_;
+#endif
+
+}
+
+void chacha20_blocks(uint8_t* out, const uint8_t* key, const uint8_t* nonce, uint32_t counter, size_t count)
+{
+    uint32_t input[16] = { 0x61707865, 0x3320646e, 0x79622d32, 0x6b206574 };
+    for (unsigned i = 0; i < 8; i++) input[4 + i] = load32(key + 4 * i);
+    for (unsigned i = 0; i < 3; i++) input[13 + i] = load32(nonce + 4 * i);
+
+    for (size_t b = 0; b < count; b++, out += 64)
+    {
+        input[12] = counter + uint32_t(b);
+        uint32_t x[16];
+        for (unsigned i = 0; i < 16; i++) x[i] = input[i];
+        for (unsigned i = 0; i < 10; i++)
+        {
+            QUARTER_ROUND(x[0], x[4], x[8],  x[12])
+            QUARTER_ROUND(x[1], x[5], x[9],  x[13])
+            QUARTER_ROUND(x[2], x[6], x[10], x[14])
+            QUARTER_ROUND(x[3], x[7], x[11], x[15])
+            QUARTER_ROUND(x[0], x[5], x[10], x[15])
+            QUARTER_ROUND(x[1], x[6], x[11], x[12])
+            QUARTER_ROUND(x[2], x[7], x[8],  x[13])
+            QUARTER_ROUND(x[3], x[4], x[9],  x[14])
+        }
+        for (unsigned i = 0; i < 16; i++) store32(out + 4 * i, x[i] + input[i]);
+    }
+    secure_zero(input + 4, 8 * sizeof(uint32_t));
+}
+
+void get_entropy(uint8_t* out, size_t size)
+{
+#ifdef __linux__
+    while (size > 0)
+    {
+        ssize_t n = getrandom(out, size, 0);
+        if (n < 0)
+        {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("random source unavailable");
+        }
+        out += n;
+        size -= size_t(n);
+    }
+#else
+    std::random_device device;
+    for (size_t i = 0; i < size; i++) out[i] = uint8_t(device());
+#endif
+}
+
+void secure_zero(void* p, size_t size)
+{
+    volatile uint8_t* v = static_cast<uint8_t*>(p);
+    for (size_t i = 0; i < size; i++) v[i] = 0;
+}
+
+chacha20_drbg::chacha20_drbg()
+{
+    reseed();
+}
+
+chacha20_drbg::~chacha20_drbg()
+{
+    secure_zero(key_, sizeof(key_));
+    secure_zero(buffer_, sizeof(buffer_));
+}
+
+chacha20_drbg& chacha20_drbg::local()
+{
+    static thread_local chacha20_drbg drbg;
+    return drbg;
+}
+
+void chacha20_drbg::reseed()
+{
+    forks_ = forks.load(std::memory_order_relaxed);
+    get_entropy(key_, sizeof(key_));
+    generated_ = 0;
+    refill();
+}
+
+void chacha20_drbg::refill()
+{
+    static const uint8_t nonce[12] = { 0 };
+    chacha20_blocks(buffer_, key_, nonce, 0, BLOCKS);
+    memcpy(key_, buffer_, KEY_SIZE);
+    secure_zero(buffer_, KEY_SIZE);
+    position_ = KEY_SIZE;
+}
+
+void chacha20_drbg::generate(void* out, size_t size)
+{
+    if (forks_ != forks.load(std::memory_order_relaxed) || generated_ >= RESEED_INTERVAL) reseed();
+    generated_ += size;
+
+    uint8_t* o = static_cast<uint8_t*>(out);
+    while (size > 0)
+    {
+        if (position_ == sizeof(buffer_)) refill();
+        size_t n = sizeof(buffer_) - position_ < size ? sizeof(buffer_) - position_ : size;
+        memcpy(o, buffer_ + position_, n);
+        secure_zero(buffer_ + position_, n);
+        position_ += n;
+        o += n;
+        size -= n;
+    }
+}
+
+}
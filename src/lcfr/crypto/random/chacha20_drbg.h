@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace lcfr {
+
+/**
+  Write count 64-byte blocks of the ChaCha20 key stream (RFC 8439).
+  \param key the 32 bytes of the key
+  \param nonce the 12 bytes of the nonce
+  \param counter the block counter of the first block
+*/
+void chacha20_blocks(uint8_t* out, const uint8_t* key, const uint8_t* nonce, uint32_t counter, size_t count);
+
+/**
+  Fill the array with bytes of the operating system generator (getrandom on Linux).
+  Throws if the generator is not available.
+*/
+void get_entropy(uint8_t* out, size_t size);
+
+// overwrite secrets with zeros, the writes are not removed by the compiler
+void secure_zero(void* p, size_t size);
+
+/** Random generator on the ChaCha20 key stream, seeded by get_entropy.
+* The key stream is generated BLOCKS blocks at a time, the first KEY_SIZE bytes of which replace the key,
+* so that the output already returned cannot be computed again from the state (fast key erasure).
+* The generator takes a new seed after RESEED_INTERVAL output bytes and in the child of a fork,
+* which would return the same bytes as the parent otherwise.
+*/
+class chacha20_drbg
+{
+public:
+    static const size_t KEY_SIZE = 32;
+    static const size_t BLOCK_SIZE = 64;
+    static const size_t BLOCKS = 16;
+    static const uint64_t RESEED_INTERVAL = uint64_t(1) << 24;
+
+    chacha20_drbg();
+    ~chacha20_drbg();
+
+    chacha20_drbg(const chacha20_drbg&) = delete;
+    chacha20_drbg& operator = (const chacha20_drbg&) = delete;
+
+    void generate(void* out, size_t size);
+
+    // the generator of the calling thread
+    static chacha20_drbg& local();
+
+private:
+    uint8_t  key_[KEY_SIZE];
+    uint8_t  buffer_[BLOCKS * BLOCK_SIZE];
+    size_t   position_;         // the bytes of the buffer before it are used or are the next key
+    uint64_t generated_;        // output bytes since the last seed
+    unsigned forks_;            // forks seen at the last seed
+
+    void reseed();
+    void refill();
+};
+
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+#include "lcfr/crypto/fp.h"
+#include "lcfr/crypto/simd/lane_kernels.h"
+#include "lcfr/stats/counters.h"
+
+namespace lcfr {
+
+/** Prime field whose elements hold LANE_COUNT independent values, processed together by the lane kernels.
+* The values are kept in Montgomery form with respect to 2^(LANE_RADIX * NL).
+* The class holds no over-aligned data, the elements are meant to live on the stack.
+* Template parameters are:
+* - NP: bit size of the prime number
+* - W: primitive unsigned integer type of the big integers converted to and from the lanes
+*/
+template <unsigned NP, class W = uint32_t>
+class lane_fp
+{
+public:
+    // two spare bits keep the Montgomery products below 2p without a carry out of the top limb
+    static const unsigned NL = (NP + 2 + LANE_RADIX - 1) / LANE_RADIX;
+    static const unsigned WB = 8 * sizeof(W);
+    static const unsigned NW = (NP + WB - 1) / WB;
+
+    static_assert(NL <= LANE_MAX_LIMBS, "prime too large for the lane kernels");
+
+    struct alignas(64) element
+    {
+        uint64_t limbs[NL * LANE_COUNT];
+    };
+
+    // lanes set to all ones are selected, lanes set to zero are not
+    struct alignas(64) mask
+    {
+        uint64_t lanes[LANE_COUNT];
+    };
+
+private:
+    const lane_kernels& k_;
+    lane_modulus        m_;
+    uint64_t            r2_[NL];        // 2^(2 * LANE_RADIX * NL) mod p, single lane
+
+    static void to_limbs(uint64_t* limbs, const W* a)
+    {
+        for (unsigned j = 0; j < NL; j++)
+        {
+            uint64_t v = 0;
+            for (unsigned k = 0; k < LANE_RADIX; )
+            {
+                unsigned pos = j * LANE_RADIX + k;
+                if (pos / WB >= NW) break;
+                unsigned take = WB - pos % WB < LANE_RADIX - k ? WB - pos % WB : LANE_RADIX - k;
+                v |= ((uint64_t(a[pos / WB] >> (pos % WB))) & ((uint64_t(1) << take) - 1)) << k;
+                k += take;
+            }
+            limbs[j] = v;
+        }
+    }
+
+public:
+    /**
+      \param prime the prime number (NW words, least significant word before)
+    */
+    lane_fp(const W* prime)
+        : k_(get_lane_kernels())
+    {
+        m_.nl = NL;
+        to_limbs(m_.p, prime);
+        for (unsigned j = NL; j < LANE_MAX_LIMBS; j++) m_.p[j] = 0;
+
+        // Newton iteration doubling the number of correct bits of p^-1 at each step
+        uint64_t inv = 1;
+        for (unsigned i = 0; i < 5; i++) inv = (inv * (2 - m_.p[0] * inv)) & LANE_MASK;
+        m_.pinv = (0 - inv) & LANE_MASK;
+
+        element r;
+        for (unsigned j = 0; j < NL * LANE_COUNT; j++) r.limbs[j] = 0;
+        for (unsigned l = 0; l < LANE_COUNT; l++) r.limbs[l] = 1;
+        for (unsigned i = 0; i < 2 * LANE_RADIX * NL; i++) add(r, r, r);
+        for (unsigned j = 0; j < NL; j++) r2_[j] = r.limbs[j * LANE_COUNT];
+    }
+
+    const char* kernels_name() const
+    {
+        return k_.name;
+    }
+
+    /**
+      Set a lane to the Montgomery form of a (NW words, least significant word before, a < p).
+    */
+    void load(element& x, unsigned lane, const W* a) const
+    {
+        uint64_t limbs[NL];
+        to_limbs(limbs, a);
+        element t;
+        for (unsigned j = 0; j < NL * LANE_COUNT; j++) t.limbs[j] = 0;
+        for (unsigned j = 0; j < NL; j++) t.limbs[j * LANE_COUNT] = limbs[j];
+        to_montgomery(t, t);
+        for (unsigned j = 0; j < NL; j++) x.limbs[j * LANE_COUNT + lane] = t.limbs[j * LANE_COUNT];
+    }
+
+    /**
+      Set every lane to the Montgomery form of a (NW words, least significant word before, a < p).
+    */
+    void broadcast(element& x, const W* a) const
+    {
+        uint64_t limbs[NL];
+        to_limbs(limbs, a);
+        for (unsigned j = 0; j < NL; j++)
+            for (unsigned l = 0; l < LANE_COUNT; l++) x.limbs[j * LANE_COUNT + l] = limbs[j];
+        to_montgomery(x, x);
+    }
+
+    /**
+      Store the value of every lane (NW words each, least significant word before) leaving the Montgomery form.
+    */
+    void store(W* const* a, const element& x) const
+    {
+        element one, t;
+        for (unsigned j = 0; j < NL * LANE_COUNT; j++) one.limbs[j] = j < LANE_COUNT ? 1 : 0;
+        mult(t, x, one);
+        for (unsigned l = 0; l < LANE_COUNT; l++)
+        {
+            for (unsigned i = 0; i < NW; i++) a[l][i] = W(0);
+            for (unsigned j = 0; j < NL; j++)
+            {
+                uint64_t v = t.limbs[j * LANE_COUNT + l];
+                for (unsigned pos = j * LANE_RADIX; v != 0 && pos / WB < NW; )
+                {
+                    unsigned take = WB - pos % WB;
+                    a[l][pos / WB] |= W(v << (pos % WB));
+                    v = take < 64 ? v >> take : 0;
+                    pos += take;
+                }
+            }
+        }
+    }
+
+    void to_montgomery(element& x, const element& a) const
+    {
+        element r2;
+        for (unsigned j = 0; j < NL; j++)
+            for (unsigned l = 0; l < LANE_COUNT; l++) r2.limbs[j * LANE_COUNT + l] = r2_[j];
+        mult(x, a, r2);
+    }
+
+    void mult(element& x, const element& a, const element& b) const
+    {
+        LCFR_STATS_COUNT(FP_MULT, LANE_COUNT);
+        LCFR_STATS_COUNT(REDUCTION, LANE_COUNT);
+        k_.mult(x.limbs, a.limbs, b.limbs, m_);
+    }
+
+    void square(element& x, const element& a) const
+    {
+        LCFR_STATS_COUNT(FP_SQUARE, LANE_COUNT);
+        LCFR_STATS_COUNT(REDUCTION, LANE_COUNT);
+        k_.mult(x.limbs, a.limbs, a.limbs, m_);
+    }
+
+    /**
+      Compute x = a^e lane by lane, the exponent being given by its addition chain (see pw_fp::pow).
+    */
+    void pow(element& x, const element& a, const fp_chain& chain) const
+    {
+        element t[fp_chain::SLOTS], r;
+        t[0] = a;
+        for (size_t i = 0; i < chain.size; i++)
+        {
+            const fp_chain_step& step = chain.steps[i];
+            if (step.squares == 0) r = t[step.src];
+            else                   square(r, t[step.src]);
+            for (unsigned k = 1; k < step.squares; k++) square(r, r);
+            if (step.mult != NO_MULT) mult(r, r, t[step.mult]);
+            t[step.dest] = r;
+        }
+        x = r;
+    }
+
+    void add(element& x, const element& a, const element& b) const
+    {
+        k_.add(x.limbs, a.limbs, b.limbs, m_);
+    }
+
+    void twice(element& x, const element& a) const
+    {
+        k_.add(x.limbs, a.limbs, a.limbs, m_);
+    }
+
+    void sub(element& x, const element& a, const element& b) const
+    {
+        k_.sub(x.limbs, a.limbs, b.limbs, m_);
+    }
+
+    static void zero(element& x)
+    {
+        for (unsigned j = 0; j < NL * LANE_COUNT; j++) x.limbs[j] = 0;
+    }
+
+    // x = m ? b : a, lane by lane
+    static void select(element& x, const element& a, const element& b, const mask& m)
+    {
+        for (unsigned j = 0; j < NL; j++)
+            for (unsigned l = 0; l < LANE_COUNT; l++)
+            {
+                unsigned i = j * LANE_COUNT + l;
+                x.limbs[i] = (a.limbs[i] & ~m.lanes[l]) | (b.limbs[i] & m.lanes[l]);
+            }
+    }
+
+    static void is_zero(mask& m, const element& a)
+    {
+        for (unsigned l = 0; l < LANE_COUNT; l++) m.lanes[l] = 0;
+        for (unsigned j = 0; j < NL; j++)
+            for (unsigned l = 0; l < LANE_COUNT; l++) m.lanes[l] |= a.limbs[j * LANE_COUNT + l];
+        for (unsigned l = 0; l < LANE_COUNT; l++) m.lanes[l] = m.lanes[l] == 0 ? uint64_t(-1) : 0;
+    }
+};
+
+}
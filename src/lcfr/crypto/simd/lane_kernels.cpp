@@ -0,0 +1,331 @@
+#include "lcfr/crypto/simd/lane_kernels.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define LCFR_LANE_X86 1
+#include <immintrin.h>
+#endif
+
+namespace lcfr {
+
+namespace {
+
+const unsigned L = LANE_COUNT;
+const uint64_t RADIX = uint64_t(1) << LANE_RADIX;
+
+// ------------------------------------------------------------------
+// portable kernels, one lane at a time
+
+void finalize_generic(uint64_t* x, uint64_t* t, const lane_modulus& m)
+{
+    uint64_t c = 0;
+    for (unsigned j = 0; j < m.nl; j++)
+    {
+        t[j] += c;
+        c = t[j] >> LANE_RADIX;
+        t[j] &= LANE_MASK;
+    }
+
+    uint64_t d[LANE_MAX_LIMBS];
+    uint64_t bw = 0;
+    for (unsigned j = 0; j < m.nl; j++)
+    {
+        uint64_t v = t[j] + RADIX - m.p[j] - bw;
+        bw = 1 - (v >> LANE_RADIX);
+        d[j] = v & LANE_MASK;
+    }
+    for (unsigned j = 0; j < m.nl; j++) x[j * L] = bw == 0 ? d[j] : t[j];
+}
+
+void mult_generic(uint64_t* x, const uint64_t* a, const uint64_t* b, const lane_modulus& m)
+{
+    const unsigned nl = m.nl;
+    for (unsigned l = 0; l < L; l++)
+    {
+        uint64_t t[LANE_MAX_LIMBS] = { 0 };
+        for (unsigned i = 0; i < nl; i++)
+        {
+            uint64_t bi = b[i * L + l];
+            for (unsigned j = 0; j < nl; j++) t[j] += a[j * L + l] * bi;
+            uint64_t q = ((t[0] & LANE_MASK) * m.pinv) & LANE_MASK;
+            for (unsigned j = 0; j < nl; j++) t[j] += q * m.p[j];
+            uint64_t c = t[0] >> LANE_RADIX;
+            for (unsigned j = 0; j + 1 < nl; j++) t[j] = t[j + 1];
+            t[0] += c;
+            t[nl - 1] = 0;
+        }
+        finalize_generic(x + l, t, m);
+    }
+}
+
+void add_generic(uint64_t* x, const uint64_t* a, const uint64_t* b, const lane_modulus& m)
+{
+    for (unsigned l = 0; l < L; l++)
+    {
+        uint64_t t[LANE_MAX_LIMBS];
+        for (unsigned j = 0; j < m.nl; j++) t[j] = a[j * L + l] + b[j * L + l];
+        finalize_generic(x + l, t, m);
+    }
+}
+
+void sub_generic(uint64_t* x, const uint64_t* a, const uint64_t* b, const lane_modulus& m)
+{
+    for (unsigned l = 0; l < L; l++)
+    {
+        uint64_t d[LANE_MAX_LIMBS];
+        uint64_t bw = 0;
+        for (unsigned j = 0; j < m.nl; j++)
+        {
+            uint64_t v = a[j * L + l] + RADIX - b[j * L + l] - bw;
+            bw = 1 - (v >> LANE_RADIX);
+            d[j] = v & LANE_MASK;
+        }
+        uint64_t c = 0;
+        for (unsigned j = 0; j < m.nl; j++)
+        {
+            uint64_t v = d[j] + (bw ? m.p[j] : 0) + c;
+            c = v >> LANE_RADIX;
+            x[j * L + l] = v & LANE_MASK;
+        }
+    }
+}
+
+const lane_kernels GENERIC_KERNELS = { "generic", &mult_generic, &add_generic, &sub_generic };
+
+#ifdef LCFR_LANE_X86
+// ------------------------------------------------------------------
+// AVX2 kernels, two vectors of four lanes
+
+__attribute__((target("avx2")))
+inline __m256i load4(const uint64_t* p)
+{
+    return _mm256_load_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+__attribute__((target("avx2")))
+inline void store4(uint64_t* p, __m256i v)
+{
+    _mm256_store_si256(reinterpret_cast<__m256i*>(p), v);
+}
+
+__attribute__((target("avx2")))
+void finalize_avx2(uint64_t* x, __m256i* t, const __m256i* p, unsigned nl)
+{
+    const __m256i mask = _mm256_set1_epi64x(LANE_MASK);
+    const __m256i radix = _mm256_set1_epi64x(RADIX);
+    const __m256i one = _mm256_set1_epi64x(1);
+
+    __m256i c = _mm256_setzero_si256();
+    for (unsigned j = 0; j < nl; j++)
+    {
+        t[j] = _mm256_add_epi64(t[j], c);
+        c = _mm256_srli_epi64(t[j], LANE_RADIX);
+        t[j] = _mm256_and_si256(t[j], mask);
+    }
+
+    __m256i d[LANE_MAX_LIMBS];
+    __m256i bw = _mm256_setzero_si256();
+    for (unsigned j = 0; j < nl; j++)
+    {
+        __m256i v = _mm256_sub_epi64(_mm256_sub_epi64(_mm256_add_epi64(t[j], radix), p[j]), bw);
+        bw = _mm256_sub_epi64(one, _mm256_srli_epi64(v, LANE_RADIX));
+        d[j] = _mm256_and_si256(v, mask);
+    }
+    __m256i ge = _mm256_cmpeq_epi64(bw, _mm256_setzero_si256());
+    for (unsigned j = 0; j < nl; j++) store4(x + j * L, _mm256_blendv_epi8(t[j], d[j], ge));
+}
+
+__attribute__((target("avx2")))
+void mult_avx2(uint64_t* x, const uint64_t* a, const uint64_t* b, const lane_modulus& m)
+{
+    const unsigned nl = m.nl;
+    const __m256i mask = _mm256_set1_epi64x(LANE_MASK);
+    const __m256i pinv = _mm256_set1_epi64x(m.pinv);
+    __m256i p[LANE_MAX_LIMBS];
+    for (unsigned j = 0; j < nl; j++) p[j] = _mm256_set1_epi64x(m.p[j]);
+
+    for (unsigned h = 0; h < L; h += 4)
+    {
+        __m256i t[LANE_MAX_LIMBS];
+        for (unsigned j = 0; j < nl; j++) t[j] = _mm256_setzero_si256();
+        for (unsigned i = 0; i < nl; i++)
+        {
+            __m256i bi = load4(b + i * L + h);
+            for (unsigned j = 0; j < nl; j++) t[j] = _mm256_add_epi64(t[j], _mm256_mul_epu32(load4(a + j * L + h), bi));
+            __m256i q = _mm256_and_si256(_mm256_mul_epu32(t[0], pinv), mask);
+            for (unsigned j = 0; j < nl; j++) t[j] = _mm256_add_epi64(t[j], _mm256_mul_epu32(q, p[j]));
+            __m256i c = _mm256_srli_epi64(t[0], LANE_RADIX);
+            for (unsigned j = 0; j + 1 < nl; j++) t[j] = t[j + 1];
+            t[0] = _mm256_add_epi64(t[0], c);
+            t[nl - 1] = _mm256_setzero_si256();
+        }
+        finalize_avx2(x + h, t, p, nl);
+    }
+}
+
+__attribute__((target("avx2")))
+void add_avx2(uint64_t* x, const uint64_t* a, const uint64_t* b, const lane_modulus& m)
+{
+    __m256i p[LANE_MAX_LIMBS];
+    for (unsigned j = 0; j < m.nl; j++) p[j] = _mm256_set1_epi64x(m.p[j]);
+    for (unsigned h = 0; h < L; h += 4)
+    {
+        __m256i t[LANE_MAX_LIMBS];
+        for (unsigned j = 0; j < m.nl; j++) t[j] = _mm256_add_epi64(load4(a + j * L + h), load4(b + j * L + h));
+        finalize_avx2(x + h, t, p, m.nl);
+    }
+}
+
+__attribute__((target("avx2")))
+void sub_avx2(uint64_t* x, const uint64_t* a, const uint64_t* b, const lane_modulus& m)
+{
+    const __m256i mask = _mm256_set1_epi64x(LANE_MASK);
+    const __m256i radix = _mm256_set1_epi64x(RADIX);
+    const __m256i one = _mm256_set1_epi64x(1);
+    for (unsigned h = 0; h < L; h += 4)
+    {
+        __m256i d[LANE_MAX_LIMBS];
+        __m256i bw = _mm256_setzero_si256();
+        for (unsigned j = 0; j < m.nl; j++)
+        {
+            __m256i v = _mm256_sub_epi64(_mm256_sub_epi64(_mm256_add_epi64(load4(a + j * L + h), radix), load4(b + j * L + h)), bw);
+            bw = _mm256_sub_epi64(one, _mm256_srli_epi64(v, LANE_RADIX));
+            d[j] = _mm256_and_si256(v, mask);
+        }
+        __m256i lt = _mm256_cmpeq_epi64(bw, one);
+        __m256i c = _mm256_setzero_si256();
+        for (unsigned j = 0; j < m.nl; j++)
+        {
+            __m256i v = _mm256_add_epi64(_mm256_add_epi64(d[j], _mm256_and_si256(_mm256_set1_epi64x(m.p[j]), lt)), c);
+            c = _mm256_srli_epi64(v, LANE_RADIX);
+            store4(x + j * L + h, _mm256_and_si256(v, mask));
+        }
+    }
+}
+
+const lane_kernels AVX2_KERNELS = { "avx2", &mult_avx2, &add_avx2, &sub_avx2 };
+
+// ------------------------------------------------------------------
+// AVX-512 kernels, one vector of eight lanes
+
+// the unmasked intrinsics of some compiler versions trip a spurious uninitialized warning
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+__attribute__((target("avx512f")))
+void finalize_avx512(uint64_t* x, __m512i* t, const __m512i* p, unsigned nl)
+{
+    const __m512i mask = _mm512_set1_epi64(LANE_MASK);
+    const __m512i radix = _mm512_set1_epi64(RADIX);
+    const __m512i one = _mm512_set1_epi64(1);
+
+    __m512i c = _mm512_setzero_si512();
+    for (unsigned j = 0; j < nl; j++)
+    {
+        t[j] = _mm512_add_epi64(t[j], c);
+        c = _mm512_srli_epi64(t[j], LANE_RADIX);
+        t[j] = _mm512_and_si512(t[j], mask);
+    }
+
+    __m512i d[LANE_MAX_LIMBS];
+    __m512i bw = _mm512_setzero_si512();
+    for (unsigned j = 0; j < nl; j++)
+    {
+        __m512i v = _mm512_sub_epi64(_mm512_sub_epi64(_mm512_add_epi64(t[j], radix), p[j]), bw);
+        bw = _mm512_sub_epi64(one, _mm512_srli_epi64(v, LANE_RADIX));
+        d[j] = _mm512_and_si512(v, mask);
+    }
+    __mmask8 ge = _mm512_cmpeq_epi64_mask(bw, _mm512_setzero_si512());
+    for (unsigned j = 0; j < nl; j++) _mm512_store_si512(x + j * L, _mm512_mask_blend_epi64(ge, t[j], d[j]));
+}
+
+__attribute__((target("avx512f")))
+void mult_avx512(uint64_t* x, const uint64_t* a, const uint64_t* b, const lane_modulus& m)
+{
+    const unsigned nl = m.nl;
+    const __m512i mask = _mm512_set1_epi64(LANE_MASK);
+    const __m512i pinv = _mm512_set1_epi64(m.pinv);
+    __m512i p[LANE_MAX_LIMBS];
+    for (unsigned j = 0; j < nl; j++) p[j] = _mm512_set1_epi64(m.p[j]);
+
+    __m512i t[LANE_MAX_LIMBS];
+    for (unsigned j = 0; j < nl; j++) t[j] = _mm512_setzero_si512();
+    for (unsigned i = 0; i < nl; i++)
+    {
+        __m512i bi = _mm512_load_si512(b + i * L);
+        for (unsigned j = 0; j < nl; j++) t[j] = _mm512_add_epi64(t[j], _mm512_mul_epu32(_mm512_load_si512(a + j * L), bi));
+        __m512i q = _mm512_and_si512(_mm512_mul_epu32(t[0], pinv), mask);
+        for (unsigned j = 0; j < nl; j++) t[j] = _mm512_add_epi64(t[j], _mm512_mul_epu32(q, p[j]));
+        __m512i c = _mm512_srli_epi64(t[0], LANE_RADIX);
+        for (unsigned j = 0; j + 1 < nl; j++) t[j] = t[j + 1];
+        t[0] = _mm512_add_epi64(t[0], c);
+        t[nl - 1] = _mm512_setzero_si512();
+    }
+    finalize_avx512(x, t, p, nl);
+}
+
+__attribute__((target("avx512f")))
+void add_avx512(uint64_t* x, const uint64_t* a, const uint64_t* b, const lane_modulus& m)
+{
+    __m512i p[LANE_MAX_LIMBS];
+    __m512i t[LANE_MAX_LIMBS];
+    for (unsigned j = 0; j < m.nl; j++)
+    {
+        p[j] = _mm512_set1_epi64(m.p[j]);
+        t[j] = _mm512_add_epi64(_mm512_load_si512(a + j * L), _mm512_load_si512(b + j * L));
+    }
+    finalize_avx512(x, t, p, m.nl);
+}
+
+__attribute__((target("avx512f")))
+void sub_avx512(uint64_t* x, const uint64_t* a, const uint64_t* b, const lane_modulus& m)
+{
+    const __m512i mask = _mm512_set1_epi64(LANE_MASK);
+    const __m512i radix = _mm512_set1_epi64(RADIX);
+    const __m512i one = _mm512_set1_epi64(1);
+    __m512i d[LANE_MAX_LIMBS];
+    __m512i bw = _mm512_setzero_si512();
+    for (unsigned j = 0; j < m.nl; j++)
+    {
+        __m512i v = _mm512_sub_epi64(_mm512_sub_epi64(_mm512_add_epi64(_mm512_load_si512(a + j * L), radix), _mm512_load_si512(b + j * L)), bw);
+        bw = _mm512_sub_epi64(one, _mm512_srli_epi64(v, LANE_RADIX));
+        d[j] = _mm512_and_si512(v, mask);
+    }
+    __mmask8 lt = _mm512_cmpeq_epi64_mask(bw, one);
+    __m512i c = _mm512_setzero_si512();
+    for (unsigned j = 0; j < m.nl; j++)
+    {
+        __m512i v = _mm512_add_epi64(_mm512_add_epi64(d[j], _mm512_maskz_mov_epi64(lt, _mm512_set1_epi64(m.p[j]))), c);
+        c = _mm512_srli_epi64(v, LANE_RADIX);
+        _mm512_store_si512(x + j * L, _mm512_and_si512(v, mask));
+    }
+}
+
+#pragma GCC diagnostic pop
+
+const lane_kernels AVX512_KERNELS = { "avx512f", &mult_avx512, &add_avx512, &sub_avx512 };
+#endif
+
+const lane_kernels& select_lane_kernels()
+{
+#ifdef LCFR_LANE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return AVX512_KERNELS;
+    if (__builtin_cpu_supports("avx2")) return AVX2_KERNELS;
+#endif
+    return GENERIC_KERNELS;
+}
+
+}
+
+const lane_kernels& get_lane_kernels()
+{
+    static const lane_kernels& kernels = select_lane_kernels();
+    return kernels;
+}
+
+bool lane_kernels_vectorized()
+{
+    return &get_lane_kernels() != &GENERIC_KERNELS;
+}
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace lcfr {
+
+/** Multi-lane Montgomery arithmetic kernels.
+* A lane element stores LANE_COUNT independent integers as a structure of arrays:
+* limb j of lane l is limbs[j * LANE_COUNT + l], each limb holding LANE_RADIX bits in a 64-bit word,
+* so that the limb products of all the lanes are computed by the same vector instruction.
+*/
+static const unsigned LANE_COUNT = 8;
+static const unsigned LANE_RADIX = 26;
+static const unsigned LANE_MAX_LIMBS = 10;
+static const uint64_t LANE_MASK = (uint64_t(1) << LANE_RADIX) - 1;
+
+struct lane_modulus
+{
+    unsigned nl;                        // limb count
+    uint64_t pinv;                      // -p^-1 mod 2^LANE_RADIX
+    uint64_t p[LANE_MAX_LIMBS];         // prime limbs
+};
+
+/** Kernel table, the operands are lane elements of m.nl limbs, fully reduced.
+* mult computes the Montgomery product a * b / 2^(LANE_RADIX * nl) mod p.
+*/
+struct lane_kernels
+{
+    const char* name;
+    void (*mult)(uint64_t* x, const uint64_t* a, const uint64_t* b, const lane_modulus& m);
+    void (*add)(uint64_t* x, const uint64_t* a, const uint64_t* b, const lane_modulus& m);
+    void (*sub)(uint64_t* x, const uint64_t* a, const uint64_t* b, const lane_modulus& m);
+};
+
+/**
+  \return the fastest kernels supported by the running cpu, selected at the first call
+*/
+const lane_kernels& get_lane_kernels();
+
+/**
+  \return true if the selected kernels use vector instructions, so that lane arithmetic beats the scalar one
+*/
+bool lane_kernels_vectorized();
+
+}
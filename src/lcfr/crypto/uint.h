@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include <string.h>
+#include <new>
 #include "lcfr/arch/endianness.h"
 #include "lcfr/crypto/mp_arithmetic.h"
 
@@ -56,8 +57,14 @@ struct alignas(16) ui
         size_t m = n < NO ? n : NO;
         size_t w = m / WO;
         for (size_t i = 0; i < w; i++) be_deserialize(digits[i], x + n - (i + 1) * WO);
-        lcfr::zero(digits + w, NW - w);
-        for (size_t j = w * WO, k = 0; j < m; j++, k++) digits[w] |= x[n - j - 1] << (k * 8);
+        for (size_t i = w; i < NW; i++) digits[i] = W(0);
+        // the partial word is read right-aligned in a zero-padded word
+        if (m % WO != 0)
+        {
+            uint8_t t[WO] = { 0 };
+            memcpy(t + WO - m % WO, x + n - m, m % WO);
+            be_deserialize(digits[w], t);
+        }
     }
 
     ui(const ui& x)
@@ -128,13 +135,44 @@ struct alignas(16) ui
         }
     }
 
-    void to_bytes(uint8_t* a, size_t n)
+    void to_bytes(uint8_t* a, size_t n) const
+    {
+        size_t m = n < NO ? n : NO;
+        size_t w = m / WO;
+        for (size_t i = 0; i < w; i++) be_serialize(a + n - (i + 1) * WO, digits[i]);
+        if (m % WO != 0)
+        {
+            uint8_t t[WO];
+            be_serialize(t, digits[w]);
+            memcpy(a + n - m, t + WO - m % WO, m % WO);
+        }
+        memset(a, 0, n - m);
+    }
+
+    /** Construct count numbers from count big-endian byte strings of n bytes stored one after the other,
+    * as the byte array constructor does for each. x may be uninitialized memory.
+    */
+    static void from_bytes(ui* x, const uint8_t* a, size_t n, size_t count)
     {
-        size_t nw = n / WO < NW ? n / WO : NW;
-        size_t no = (n < NO ? n : NO) % WO;
-        for (size_t i = 0; i < nw; i++) be_serialize(a + n - (i + 1) * WO, digits[i]);
-        for (size_t j = 0; j < no; j++) a[n - nw * WO - j - 1] = (uint8_t)(W(0xff) & (digits[nw] >> (j * 8)));
-        for (size_t k = NO; k < n; k++) a[n - k - 1] = 0;
+#if LCFR_BIG_ENDIAN
+        for (size_t i = 0; i < count; i++) new(x + i) ui(a + i * n, n);
+#else
+        size_t m = n < NO ? n : NO;
+        reverse_bytes(reinterpret_cast<uint8_t*>(x), sizeof(ui), a + n - m, n, m, count);
+        if (m < NO) for (size_t i = 0; i < count; i++) memset(reinterpret_cast<uint8_t*>(x[i].digits) + m, 0, NO - m);
+#endif
+    }
+
+    // writes count numbers as big-endian byte strings of n bytes one after the other, as to_bytes does for each
+    static void to_bytes(uint8_t* a, size_t n, const ui* x, size_t count)
+    {
+#if LCFR_BIG_ENDIAN
+        for (size_t i = 0; i < count; i++) x[i].to_bytes(a + i * n, n);
+#else
+        size_t m = n < NO ? n : NO;
+        reverse_bytes(a + n - m, n, reinterpret_cast<const uint8_t*>(x), sizeof(ui), m, count);
+        if (m < n) for (size_t i = 0; i < count; i++) memset(a + i * n, 0, n - m);
+#endif
     }
 
     static ui ones(size_t nb)
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "lcfr/crypto/ecc/ec_fp.h"
+
+namespace lcfr
+{
+
+/** Curve tags selecting the curve of ecdsa at compile time. */
+struct secp112r1 { typedef ec_fp_secp112r1<> cipher; };
+struct secp112r2 { typedef ec_fp_secp112r2<> cipher; };
+struct secp128r1 { typedef ec_fp_secp128r1<> cipher; };
+struct secp128r2 { typedef ec_fp_secp128r2<> cipher; };
+struct secp160k1 { typedef ec_fp_secp160k1<> cipher; };
+struct secp160r1 { typedef ec_fp_secp160r1<> cipher; };
+struct secp192k1 { typedef ec_fp_secp192k1<> cipher; };
+struct secp192r1 { typedef ec_fp_secp192r1<> cipher; };
+struct secp256k1 { typedef ec_fp_secp256k1<> cipher; };
+struct secp256r1 { typedef ec_fp_secp256r1<> cipher; };
+
+/** Typed ECDSA front end for a curve known at compile time, e.g. lcfr::ecdsa<lcfr::secp256k1>.
+* The calls bind directly to the concrete cipher, without the runtime curve dispatch of EcCipher.
+* It is not header-only: it is a header of the library core, outside the public include directory,
+* for programs built with src on their include path and linked with the core sources, as lcfr_bench is.
+* Scalars and signature components are PRIME_BYTES long, point coordinates COORDINATE_BYTES long,
+* all of them big-endian. The object refers to the process-wide cipher of the curve, so it is cheap to build.
+*/
+template <class Curve>
+class ecdsa
+{
+public:
+    typedef typename Curve::cipher cipher_type;
+
+    static const size_t PRIME_BYTES = cipher_type::NNO;
+    static const size_t COORDINATE_BYTES = cipher_type::NPO;
+
+    ecdsa()
+        : cipher_(ec_shared_cipher<cipher_type>())
+    {
+    }
+
+    const cipher_type& cipher() const
+    {
+        return cipher_;
+    }
+
+    void generate_public_key(
+        uint8_t* qx, uint8_t* qy,
+        const uint8_t* pk) const
+    {
+        cipher_.generate_public_key(qx, COORDINATE_BYTES, qy, COORDINATE_BYTES, pk, PRIME_BYTES);
+    }
+
+    void sign(
+        uint8_t* r, uint8_t* s,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* ek, const uint8_t* pk) const
+    {
+        cipher_.generate_signature(r, PRIME_BYTES, s, PRIME_BYTES, h, h_size, ek, PRIME_BYTES, pk, PRIME_BYTES);
+    }
+
+    bool verify(
+        const uint8_t* r, const uint8_t* s,
+        const uint8_t* h, size_t h_size,
+        const uint8_t* qx, const uint8_t* qy) const
+    {
+        return cipher_.verify_signature(r, PRIME_BYTES, s, PRIME_BYTES, h, h_size, qx, COORDINATE_BYTES, qy, COORDINATE_BYTES);
+    }
+
+private:
+    const cipher_type& cipher_;
+};
+
+}
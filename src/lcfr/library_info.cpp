@@ -1,8 +1,12 @@
+#include <string>
 #include "library_info.h"
+#include "lcfr/crypto/hash/sha256.h"
+#include "lcfr/crypto/mp_arithmetic.h"
+#include "lcfr/crypto/simd/lane_kernels.h"
 
 namespace lcfr {
 
-const char * LCFR_VERSION = "1.0.0";
+const char * LCFR_VERSION = "2.0.0";
 
 LibraryInfo::LibraryInfo()
 {}
@@ -12,4 +16,12 @@ const char* LibraryInfo::getVersion() const
     return LCFR_VERSION;
 }
 
+const char* LibraryInfo::getActiveKernels() const
+{
+    static const std::string kernels =
+        std::string("mult=") + get_mp_kernels_name() + " lanes=" + get_lane_kernels().name +
+        " sha256=" + get_sha256_kernels().name;
+    return kernels.c_str();
+}
+
 }
@@ -7,6 +7,7 @@ class LibraryInfo
 public:
     LibraryInfo();
     const char* getVersion() const;
+    const char* getActiveKernels() const;
 };
 
 }
@@ -0,0 +1,76 @@
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include "runtime.h"
+#include "autotune.h"
+#include "self_test.h"
+
+namespace lcfr {
+
+namespace {
+
+std::mutex                   configure_mutex_;
+std::shared_ptr<thread_pool> pool_;
+std::mutex                   autotune_mutex_;
+
+}
+
+void Runtime::configure(uint32_t threadCount, uint32_t pinning)
+{
+    std::lock_guard<std::mutex> lock(configure_mutex_);
+    std::shared_ptr<thread_pool> pool;
+    if (threadCount > 1) pool = std::make_shared<thread_pool>(threadCount, pinning != 0);
+    std::atomic_store(&pool_, pool);
+}
+
+void Runtime::configureParallelVerify(uint32_t helperCount, uint32_t pinning)
+{
+    spin_executor::configure(helperCount, pinning != 0);
+}
+
+bool Runtime::autotune(const char* configPath)
+{
+    std::lock_guard<std::mutex> lock(autotune_mutex_);
+    bool save = configPath && (configPath[0] != 0);
+    if (save && load_tuning(configPath)) return false;
+    autotune_curves();
+    if (save && !save_tuning(configPath)) throw std::runtime_error("cannot write the tuning file");
+    return true;
+}
+
+void Runtime::getTuning(const char* curve, uint32_t& window, uint32_t& minLanes)
+{
+    curve_tuning t;
+    if (!get_tuning(curve, t)) throw std::runtime_error("invalid curve name");
+    window = t.window;
+    minLanes = t.min_lanes;
+}
+
+void Runtime::selfTest()
+{
+    const char* failed = run_self_tests();
+    if (failed) throw std::runtime_error(std::string("self test failed: ") + failed);
+}
+
+std::shared_ptr<thread_pool> Runtime::pool()
+{
+    return std::atomic_load(&pool_);
+}
+
+void Runtime::run(thread_pool::task t, void* context, size_t count, size_t grain)
+{
+    if (count == 0) return;
+    auto pool = Runtime::pool();
+    if (pool && (count > grain))
+    {
+        pool->run(t, context, count, grain);
+        return;
+    }
+
+    static thread_local std::unique_ptr<uint8_t[]> buffer;
+    if (!buffer) buffer.reset(new uint8_t[thread_pool::DEFAULT_SCRATCH_SIZE]);
+    thread_pool::scratch s = { buffer.get(), thread_pool::DEFAULT_SCRATCH_SIZE };
+    t(context, 0, count, s);
+}
+
+}
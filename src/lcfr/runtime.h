@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include "lcfr/concurrency/spin_executor.h"
+#include "lcfr/concurrency/thread_pool.h"
+
+namespace lcfr {
+
+class Runtime
+{
+public:
+    /** Configure the pool of threads shared by the batch operations.
+      * A concurrency lower than two restores the serial execution.
+      */
+    static void configure(uint32_t threadCount, uint32_t pinning);
+
+    /** Configure the helper threads computing the two scalar multiplications of a verification in parallel.
+      * A helper count equal to 0 restores the serial execution.
+      */
+    static void configureParallelVerify(uint32_t helperCount, uint32_t pinning);
+
+    /** Return the configured pool, or an empty pointer when batches run serially.
+      */
+    static std::shared_ptr<thread_pool> pool();
+
+    /** Tune the parameters of every curve, or load them from the configuration file
+      * when it was written on a cpu selecting the same kernels. A new tuning is saved into the file,
+      * unless the path is null or empty. Return true if the tuning ran.
+      */
+    static bool autotune(const char* configPath);
+
+    /** Return the parameters in use for the curve.
+      */
+    static void getTuning(const char* curve, uint32_t& window, uint32_t& minLanes);
+
+    /** Run the known-answer tests of the library, throwing an exception naming the first failed check.
+      */
+    static void selfTest();
+
+    /** Run the task on the configured pool, or on the calling thread if none is configured.
+      */
+    static void run(thread_pool::task t, void* context, size_t count, size_t grain);
+};
+
+}
@@ -0,0 +1,151 @@
+#include <string.h>
+#include "self_test.h"
+#include "cipher.h"
+#include "signing_key.h"
+#include "lcfr/crypto/hash/sha256.h"
+
+namespace lcfr {
+
+namespace {
+
+// the P-256 key and the SHA-256 signatures of RFC 6979 A.2.5
+const char* const CURVE = "secp256r1";
+const char* const X  = "C9AFA9D845BA75166B5C215767B1D6934E50C3DB36E89B127B8A622B120F6721";
+const char* const UX = "60FED4BA255A9D31C961EB74C6356D68C049B8923B61FA6CE669622E60F29FB6";
+const char* const UY = "7903FE1008B8BC99A41AE9E95628BC64F2F1B20C2D7E9F5177A3C294D4462299";
+
+struct signature_vector
+{
+    const char* message;
+    const char* h;
+    const char* k;
+    const char* r;
+    const char* s;      // the low s, n - s for the high s of the RFC
+    const char* der;
+};
+
+const signature_vector SIGNATURES[] = {
+    {
+        "sample",
+        "AF2BDBE1AA9B6EC1E2ADE1D694F41FC71A831D0268E9891562113D8A62ADD1BF",
+        "A6E3C57DD01ABE90086538398355DD4C3B17AA873382B0F24D6129493D8AAD60",
+        "EFD48B2AACB6A8FD1140DD9CD45E81D69D2C877B56AAF991C34D0EA84EAF3716",
+        "0834E36AD29A83BF2BC9385E491D6099C8FDF9D1ED67AA7EA5F51F93782857A9",
+        "3045022100EFD48B2AACB6A8FD1140DD9CD45E81D69D2C877B56AAF991C34D0EA84EAF3716"
+        "02200834E36AD29A83BF2BC9385E491D6099C8FDF9D1ED67AA7EA5F51F93782857A9"
+    },
+    {
+        "test",
+        "9F86D081884C7D659A2FEAA0C55AD015A3BF4F1B2B0B822CD15D6C15B0F00A08",
+        "D16B6AE827F17175E040871A1C7EC3500192C4C92677336EC2537ACAEE0008E0",
+        "F1ABB023518351CD71D881567B1EA663ED3EFCF6C5132B354F28D3B0B7D38367",
+        "019F4113742A2B14BD25926B49C649155F267E60D3814B4C0CC84250E46F0083",
+        "3045022100F1ABB023518351CD71D881567B1EA663ED3EFCF6C5132B354F28D3B0B7D38367"
+        "0220019F4113742A2B14BD25926B49C649155F267E60D3814B4C0CC84250E46F0083"
+    }
+};
+
+const size_t SIZE = 32;
+const size_t MAX_DER = 72;
+
+unsigned hex_digit(char c)
+{
+    if (c >= '0' && c <= '9') return unsigned(c - '0');
+    if (c >= 'A' && c <= 'F') return unsigned(c - 'A' + 10);
+    return unsigned(c - 'a' + 10);
+}
+
+// the hex string decoded into a, returning its byte size
+size_t from_hex(uint8_t* a, const char* hex)
+{
+    size_t size = strlen(hex) / 2;
+    for (size_t i = 0; i < size; i++) a[i] = uint8_t((hex_digit(hex[2 * i]) << 4) | hex_digit(hex[2 * i + 1]));
+    return size;
+}
+
+bool equals(const uint8_t* a, size_t size, const char* hex)
+{
+    uint8_t b[MAX_DER];
+    return from_hex(b, hex) == size && memcmp(a, b, size) == 0;
+}
+
+const char* test_sha256()
+{
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    sha256_digest(digest, reinterpret_cast<const uint8_t*>("abc"), 3);
+    if (!equals(digest, sizeof(digest), "BA7816BF8F01CFEA414140DE5DAE2223B00361A396177A9CB410FF61F20015AD")) return "sha-256";
+    return nullptr;
+}
+
+const char* test_public_key(const EcCipher& cipher)
+{
+    uint8_t x[SIZE], qx[SIZE], qy[SIZE], q[1 + 2 * SIZE];
+    from_hex(x, X);
+    cipher.generatePublicKey(qx, SIZE, qy, SIZE, x, SIZE);
+    if (!equals(qx, SIZE, UX) || !equals(qy, SIZE, UY)) return "public key";
+
+    // y is odd
+    if (cipher.encodePublicKey(q, sizeof(q), qx, SIZE, qy, SIZE, true) != 1 + SIZE || q[0] != 0x03 || !equals(q + 1, SIZE, UX))
+        return "sec1 encoding";
+    memset(qy, 0, SIZE);
+    cipher.decodePublicKey(qx, SIZE, qy, SIZE, q, 1 + SIZE);
+    if (!equals(qx, SIZE, UX) || !equals(qy, SIZE, UY)) return "sec1 decoding";
+    return nullptr;
+}
+
+const char* test_signature(const EcCipher& cipher, const EcSigningKey& key, const signature_vector& v)
+{
+    uint8_t x[SIZE], ux[SIZE], uy[SIZE], h[SIZE], k[SIZE], r[SIZE], s[SIZE], qx[SIZE], qy[SIZE], der[MAX_DER];
+    from_hex(x, X);
+    from_hex(ux, UX);
+    from_hex(uy, UY);
+    const uint8_t* m = reinterpret_cast<const uint8_t*>(v.message);
+    size_t m_size = strlen(v.message);
+
+    sha256_digest(h, m, m_size);
+    if (!equals(h, SIZE, v.h)) return "sha-256";
+
+    key.generateNonce(k, SIZE, h, SIZE);
+    if (!equals(k, SIZE, v.k)) return "rfc 6979 nonce";
+
+    key.signMessage(r, SIZE, s, SIZE, m, m_size);
+    if (!equals(r, SIZE, v.r) || !equals(s, SIZE, v.s)) return "rfc 6979 signature";
+
+    if (cipher.verifySignature(r, SIZE, s, SIZE, h, SIZE, ux, SIZE, uy, SIZE) != -1) return "verification";
+    h[SIZE - 1] ^= 1;
+    if (cipher.verifySignature(r, SIZE, s, SIZE, h, SIZE, ux, SIZE, uy, SIZE) != 0) return "verification of a wrong hash";
+    h[SIZE - 1] ^= 1;
+
+    uint32_t der_size = cipher.encodeSignatureDer(der, sizeof(der), r, SIZE, s, SIZE);
+    if (!equals(der, der_size, v.der)) return "der encoding";
+    memset(r, 0, SIZE);
+    memset(s, 0, SIZE);
+    cipher.decodeSignatureDer(r, SIZE, s, SIZE, der, der_size);
+    if (!equals(r, SIZE, v.r) || !equals(s, SIZE, v.s)) return "der decoding";
+
+    uint32_t id = cipher.generateRecoverableSignature(r, SIZE, s, SIZE, h, SIZE, k, SIZE, x, SIZE);
+    if (!equals(r, SIZE, v.r) || !equals(s, SIZE, v.s)) return "recoverable signature";
+    cipher.recoverPublicKey(qx, SIZE, qy, SIZE, r, SIZE, s, SIZE, h, SIZE, id);
+    if (memcmp(qx, ux, SIZE) != 0 || memcmp(qy, uy, SIZE) != 0) return "public key recovery";
+    return nullptr;
+}
+
+}
+
+const char* run_self_tests()
+{
+    const char* failed = test_sha256();
+    if (failed) return failed;
+
+    EcCipher cipher(CURVE);
+    if ((failed = test_public_key(cipher)) != nullptr) return failed;
+
+    uint8_t x[SIZE];
+    from_hex(x, X);
+    EcSigningKey key(&cipher, x, SIZE);
+    for (const signature_vector& v : SIGNATURES)
+        if ((failed = test_signature(cipher, key, v)) != nullptr) return failed;
+    return nullptr;
+}
+
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace lcfr {
+
+/**
+  Run the known-answer tests: SHA-256, the RFC 6979 nonces and signatures of the P-256 key of RFC 6979 A.2.5
+  (low-s, s being replaced by n - s when it is high), their verification, DER round trip and public key recovery,
+  and the SEC1 encoding of the key.
+  \return the name of the first failed check, null if all the checks passed
+*/
+const char* run_self_tests();
+
+}
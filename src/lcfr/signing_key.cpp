@@ -0,0 +1,86 @@
+#include <string.h>
+#include <stdexcept>
+#include <vector>
+#include "lcfr/crypto/hash/sha256.h"
+#include "signing_key.h"
+
+namespace lcfr {
+
+EcSigningKey::EcSigningKey(const EcCipher* cipher, const uint8_t* sk, size_t sk_size)
+    : cipher_(*cipher)
+{
+    const size_t n = cipher_.getPrimeByteLength();
+    uint8_t q[rfc6979_nonce::MAX_BYTES], x[rfc6979_nonce::MAX_BYTES];
+    cipher_.getPrime(q, n);
+
+    // the key is an integer between 1 and q - 1, left-padded with zeros to the size of q
+    size_t skip = 0;
+    while (sk_size - skip > n)
+    {
+        if (sk[skip] != 0) throw std::runtime_error("invalid secret key");
+        skip++;
+    }
+    memset(x, 0, n - (sk_size - skip));
+    memcpy(x + n - (sk_size - skip), sk + skip, sk_size - skip);
+
+    bool zero = true;
+    for (size_t i = 0; i < n; i++) zero &= x[i] == 0;
+    if (zero || memcmp(x, q, n) >= 0) throw std::runtime_error("invalid secret key");
+
+    nonce_.reset(new rfc6979_nonce(q, cipher_.getPrimeBitLength(), x));
+    volatile uint8_t* wipe = x;
+    for (size_t i = 0; i < n; i++) wipe[i] = 0;
+}
+
+void EcSigningKey::generateNonce(
+    uint8_t* k,       size_t k_size,
+    const uint8_t* h, size_t h_size) const
+{
+    const size_t n = nonce_->size();
+    if (k_size < n) throw std::runtime_error("nonce array too short");
+    memset(k, 0, k_size - n);
+    nonce_->generate(k + k_size - n, h, h_size);
+}
+
+void EcSigningKey::generateSignature(
+    uint8_t* r,       size_t r_size,
+    uint8_t* s,       size_t s_size,
+    const uint8_t* h, size_t h_size) const
+{
+    const size_t n = nonce_->size();
+    uint8_t k[rfc6979_nonce::MAX_BYTES];
+    nonce_->generate(k, h, h_size);
+    cipher_.generateSignature(r, r_size, s, s_size, h, h_size, k, n, nonce_->key(), n);
+}
+
+void EcSigningKey::signMessage(
+    uint8_t* r,       size_t r_size,
+    uint8_t* s,       size_t s_size,
+    const uint8_t* m, size_t m_size) const
+{
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    sha256_digest(digest, m, m_size);
+    generateSignature(r, r_size, s, s_size, digest, sizeof(digest));
+}
+
+void EcSigningKey::generateSignatures(
+    uint8_t* r,       size_t r_size,
+    uint8_t* s,       size_t s_size,
+    const uint8_t* h, size_t h_size,
+    size_t count) const
+{
+    // the nonces take a few microseconds against tens for a signature, they are derived up front
+    // and the batch goes through the cipher with the key repeated for every signature
+    const size_t n = nonce_->size();
+    std::vector<uint8_t> ek(count * n), sk(count * n);
+    for (size_t i = 0; i < count; i++)
+    {
+        nonce_->generate(ek.data() + i * n, h + i * h_size, h_size);
+        memcpy(sk.data() + i * n, nonce_->key(), n);
+    }
+    cipher_.generateSignatures(r, r_size, s, s_size, h, h_size, ek.data(), n, sk.data(), n, count);
+    volatile uint8_t* wipe = sk.data();
+    for (size_t i = 0; i < sk.size(); i++) wipe[i] = 0;
+}
+
+}
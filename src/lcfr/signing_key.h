@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <memory>
+#include "lcfr/cipher.h"
+#include "lcfr/crypto/ecc/rfc6979.h"
+
+namespace lcfr {
+
+/** Private key bound to a cipher, signing with the deterministic nonces of RFC 6979 (HMAC-SHA-256),
+* so that the callers supply no ephemeral key. The key-dependent part of the nonce derivation
+* is computed once, when the key is created. The cipher is copied, it is only a handle.
+*/
+class EcSigningKey
+{
+public:
+    EcSigningKey(const EcCipher* cipher, const uint8_t* sk, size_t sk_size);
+
+    EcSigningKey(const EcSigningKey&) = delete;
+    EcSigningKey& operator = (const EcSigningKey&) = delete;
+
+    void generateNonce(
+        uint8_t* k,       size_t k_size,
+        const uint8_t* h, size_t h_size) const;
+
+    void generateSignature(
+        uint8_t* r,       size_t r_size,
+        uint8_t* s,       size_t s_size,
+        const uint8_t* h, size_t h_size) const;
+
+    void signMessage(
+        uint8_t* r,       size_t r_size,
+        uint8_t* s,       size_t s_size,
+        const uint8_t* m, size_t m_size) const;
+
+    void generateSignatures(
+        uint8_t* r,       size_t r_size,
+        uint8_t* s,       size_t s_size,
+        const uint8_t* h, size_t h_size,
+        size_t count) const;
+
+private:
+    const EcCipher                 cipher_;
+    std::unique_ptr<rfc6979_nonce> nonce_;     // keeps the private key too
+};
+
+}
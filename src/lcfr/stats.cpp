@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <stdexcept>
+#include "stats.h"
+
+namespace lcfr {
+
+bool Stats::isEnabled()
+{
+#ifdef LCFR_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint32_t Stats::snapshot(uint64_t* counters, uint32_t countersSize)
+{
+    uint64_t values[CURVE_COUNT * COUNTER_COUNT];
+    stats::snapshot(values);
+    std::copy(values, values + std::min(countersSize, CURVE_COUNT * COUNTER_COUNT), counters);
+    return CURVE_COUNT * COUNTER_COUNT;
+}
+
+void Stats::reset()
+{
+    stats::reset();
+    stats::latency::clear();
+}
+
+void Stats::enableLatency(bool enabled)
+{
+    stats::latency::enable(enabled);
+}
+
+uint64_t Stats::getLatency(
+    uint32_t curve, uint32_t operation, uint32_t stage,
+    const double* quantiles, double* values, uint32_t count)
+{
+    if (curve >= CURVE_COUNT) throw std::runtime_error("invalid curve index");
+    if (operation >= OPERATION_COUNT) throw std::runtime_error("invalid operation");
+    if (stage >= STAGE_COUNT) throw std::runtime_error("invalid stage");
+    for (uint32_t i = 0; i < count; i++)
+        if (!(quantiles[i] >= 0 && quantiles[i] <= 1)) throw std::runtime_error("invalid quantile");
+    return stats::latency::summary(
+        curve, stats::latency::operation(operation), stats::latency::stage(stage), quantiles, values, count);
+}
+
+const char* Stats::getCurveName(uint32_t curve)
+{
+    const char* name = stats::curve_name(curve);
+    if (name == nullptr) throw std::runtime_error("invalid curve index");
+    return name;
+}
+
+}
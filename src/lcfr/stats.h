@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+#include "lcfr/stats/counters.h"
+#include "lcfr/stats/latency.h"
+
+namespace lcfr {
+
+class Stats
+{
+public:
+    static const uint32_t COUNTER_COUNT = stats::COUNTER_COUNT;
+    static const uint32_t CURVE_COUNT = stats::CURVE_COUNT;
+    static const uint32_t OPERATION_COUNT = stats::latency::OPERATION_COUNT;
+    static const uint32_t STAGE_COUNT = stats::latency::STAGE_COUNT;
+
+    /** Return true if the library was built with the LCFR_STATS option, else the counters stay at zero.
+      */
+    static bool isEnabled();
+
+    /** Copy the counters summed over all the threads since the last reset, curve major.
+      * At most countersSize values are copied, the number of values available is returned.
+      */
+    static uint32_t snapshot(uint64_t* counters, uint32_t countersSize);
+
+    /** Restart the counters and the latency histograms from zero.
+      */
+    static void reset();
+
+    /** Start or stop recording the latency histograms of the sign and verify stages.
+      */
+    static void enableLatency(bool enabled);
+
+    /** Compute the latencies of a stage at the given quantiles, in nanoseconds.
+      * Return the number of durations recorded.
+      */
+    static uint64_t getLatency(
+        uint32_t curve, uint32_t operation, uint32_t stage,
+        const double* quantiles, double* values, uint32_t count);
+
+    /** Return the name of the curve of the given index in the snapshot.
+      */
+    static const char* getCurveName(uint32_t curve);
+};
+
+}
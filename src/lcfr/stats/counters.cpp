@@ -0,0 +1,116 @@
+#include <string.h>
+#include <algorithm>
+#include <mutex>
+#include <vector>
+#include "lcfr/stats/counters.h"
+
+namespace lcfr {
+namespace stats {
+
+namespace {
+
+const char* const CURVE_NAMES[CURVE_COUNT] = {
+    "secp112r1", "secp112r2", "secp128r1", "secp128r2", "secp160k1",
+    "secp160r1", "secp192k1", "secp192r1", "secp256k1", "secp256r1"
+};
+
+const size_t VALUE_COUNT = CURVE_COUNT * COUNTER_COUNT;
+
+std::mutex                     registry_mutex_;
+std::vector<thread_counters*>  live_;
+thread_counters                retired_;           // counts of the dead threads
+uint64_t                       baseline_[VALUE_COUNT];
+
+void add_values(uint64_t* sums, const thread_counters& t)
+{
+    for (unsigned c = 0; c < CURVE_COUNT; c++)
+        for (unsigned k = 0; k < COUNTER_COUNT; k++)
+            sums[c * COUNTER_COUNT + k] += t.values[c][k].load(std::memory_order_relaxed);
+}
+
+// caller holds registry_mutex_
+void totals(uint64_t* sums)
+{
+    std::fill(sums, sums + VALUE_COUNT, uint64_t(0));
+    add_values(sums, retired_);
+    for (thread_counters* t : live_) add_values(sums, *t);
+}
+
+}
+
+unsigned curve_index(const char* name)
+{
+    for (unsigned c = 0; c < CURVE_COUNT; c++)
+        if (strcmp(CURVE_NAMES[c], name) == 0) return c;
+    return OTHER_CURVE;
+}
+
+const char* curve_name(unsigned curve)
+{
+    return curve < CURVE_COUNT ? CURVE_NAMES[curve] : nullptr;
+}
+
+void snapshot(uint64_t* values)
+{
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    totals(values);
+    for (size_t i = 0; i < VALUE_COUNT; i++) values[i] -= baseline_[i];
+}
+
+void reset()
+{
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    totals(baseline_);
+}
+
+#ifdef LCFR_STATS
+
+thread_local thread_counters* local_counters_ = nullptr;
+thread_local unsigned current_curve_ = OTHER_CURVE;
+
+namespace {
+
+// folds the counters of the thread into retired_ when the thread exits
+struct registration
+{
+    thread_counters counters;
+
+    registration()
+    {
+        for (auto& curve : counters.values)
+            for (auto& v : curve) v.store(0, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        live_.push_back(&counters);
+    }
+
+    ~registration()
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        for (unsigned c = 0; c <= CURVE_COUNT; c++)
+        {
+            for (unsigned k = 0; k < COUNTER_COUNT; k++)
+            {
+                std::atomic<uint64_t>& r = retired_.values[c][k];
+                r.store(r.load(std::memory_order_relaxed) + counters.values[c][k].load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+            }
+        }
+        live_.erase(std::find(live_.begin(), live_.end(), &counters));
+        // the operations of the later thread_local destructors land in retired_, at worst losing a few counts
+        local_counters_ = &retired_;
+    }
+};
+
+}
+
+thread_counters* attach()
+{
+    static thread_local registration r;
+    local_counters_ = &r.counters;
+    return local_counters_;
+}
+
+#endif
+
+}
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+namespace lcfr {
+namespace stats {
+
+/** Operations counted when the library is built with LCFR_STATS.
+* Field operations are counted in both the coordinate and the scalar field, reductions being the
+* modular reductions of the products; lane operations count once per lane.
+*/
+enum counter : unsigned
+{
+    FP_MULT,
+    FP_SQUARE,
+    FP_INVERSE,
+    REDUCTION,
+    POINT_ADD,
+    POINT_DOUBLE,
+    SIGN,
+    VERIFY,
+    COUNTER_COUNT
+};
+
+// curves in the order of their names, OTHER_CURVE collecting the operations made outside a cipher call
+static const unsigned CURVE_COUNT = 10;
+static const unsigned OTHER_CURVE = CURVE_COUNT;
+
+/**
+  \return the index of the named curve, OTHER_CURVE if the name is unknown
+*/
+unsigned curve_index(const char* name);
+
+/**
+  \return the name of the curve, nullptr if the index is out of range
+*/
+const char* curve_name(unsigned curve);
+
+/** Counters of one thread, aligned on cache lines so that the threads never share one.
+* Only the owning thread writes them, the increments are relaxed loads and stores
+* and the atomics only make the reads of the snapshots well defined.
+*/
+struct alignas(64) thread_counters
+{
+    std::atomic<uint64_t> values[CURVE_COUNT + 1][COUNTER_COUNT];
+};
+
+/**
+  Sum the counters of all the threads, dead ones included, since the last reset.
+  \param values the CURVE_COUNT * COUNTER_COUNT sums, curve major
+*/
+void snapshot(uint64_t* values);
+
+/**
+  Restart the counts from zero.
+*/
+void reset();
+
+#ifdef LCFR_STATS
+
+extern thread_local thread_counters* local_counters_;
+extern thread_local unsigned current_curve_;
+
+// registers the counters of the calling thread
+thread_counters* attach();
+
+inline void count(counter c, uint64_t n)
+{
+    thread_counters* t = local_counters_;
+    if (!t) t = attach();
+    std::atomic<uint64_t>& v = t->values[current_curve_][c];
+    v.store(v.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+/** Attributes the operations of the calling thread to a curve until the end of the scope.
+*/
+class curve_scope
+{
+public:
+    explicit curve_scope(unsigned curve)
+        : saved_(current_curve_)
+    {
+        current_curve_ = curve;
+    }
+
+    ~curve_scope()
+    {
+        current_curve_ = saved_;
+    }
+
+    curve_scope(const curve_scope&) = delete;
+    curve_scope& operator = (const curve_scope&) = delete;
+
+private:
+    unsigned saved_;
+};
+
+#define LCFR_STATS_COUNT(c, n) ::lcfr::stats::count(::lcfr::stats::c, (n))
+#define LCFR_STATS_CURVE(curve) ::lcfr::stats::curve_scope lcfr_stats_curve_(curve)
+
+#else
+
+#define LCFR_STATS_COUNT(c, n) ((void)0)
+#define LCFR_STATS_CURVE(curve) ((void)0)
+
+#endif
+
+}
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include <atomic>
+
+namespace lcfr {
+namespace stats {
+
+/** Log-linear histogram of durations in clock ticks, in the manner of HdrHistogram.
+* The values below 2 * SUB_BUCKETS are counted exactly, the larger ones in SUB_BUCKETS buckets per power of two,
+* so that a bucket is at most 1 / SUB_BUCKETS wide relative to its values (6.25%).
+* Values beyond the range are counted in the last bucket. Recording is a relaxed atomic increment.
+*/
+class latency_histogram
+{
+public:
+    static const unsigned SUB_BITS = 4;
+    static const unsigned SUB_BUCKETS = 1u << SUB_BITS;
+    static const unsigned MAX_BITS = 40;
+    static const unsigned BUCKETS = (MAX_BITS - SUB_BITS + 1) * SUB_BUCKETS;
+
+    void record(uint64_t value)
+    {
+        counts_[index(value)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+      Copy the bucket counts.
+      \return the total count
+    */
+    uint64_t copy(uint64_t* counts) const
+    {
+        uint64_t total = 0;
+        for (unsigned i = 0; i < BUCKETS; i++)
+        {
+            counts[i] = counts_[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+        return total;
+    }
+
+    void clear()
+    {
+        for (auto& c : counts_) c.store(0, std::memory_order_relaxed);
+    }
+
+    static unsigned index(uint64_t value)
+    {
+        if (value < 2 * SUB_BUCKETS) return unsigned(value);
+        unsigned shift = 63 - __builtin_clzll(value) - SUB_BITS;
+        unsigned i = (shift + 1) * SUB_BUCKETS + unsigned(value >> shift) - SUB_BUCKETS;
+        return i < BUCKETS ? i : BUCKETS - 1;
+    }
+
+    // middle of the values of the bucket
+    static double value(unsigned index)
+    {
+        if (index < 2 * SUB_BUCKETS) return double(index);
+        unsigned shift = index / SUB_BUCKETS - 1;
+        uint64_t low = uint64_t(SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+        return double(low) + double(uint64_t(1) << shift) / 2;
+    }
+
+    /**
+      \param counts the bucket counts, as copied
+      \param total the total count
+      \param q the quantile, from 0 to 1
+      \return the value at the quantile, 0 if the histogram is empty
+    */
+    static double percentile(const uint64_t* counts, uint64_t total, double q)
+    {
+        if (total == 0) return 0;
+        double rank = ceil(q * double(total));
+        uint64_t target = rank < 1 ? 1 : uint64_t(rank);
+        if (target > total) target = total;
+        uint64_t sum = 0;
+        for (unsigned i = 0; i < BUCKETS; i++)
+        {
+            sum += counts[i];
+            if (sum >= target) return value(i);
+        }
+        return value(BUCKETS - 1);
+    }
+
+private:
+    std::atomic<uint64_t> counts_[BUCKETS];
+};
+
+}
+}
@@ -0,0 +1,82 @@
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include "lcfr/stats/latency.h"
+
+namespace lcfr {
+namespace stats {
+namespace latency {
+
+std::atomic<histogram_set*> active_;
+
+namespace {
+
+// the clock frequency is measured over the time elapsed since the first start, at least CALIBRATION_NS
+const int64_t CALIBRATION_NS = 10000000;
+
+std::mutex     enable_mutex_;
+histogram_set* histograms_ = nullptr;   // never freed, a timer may still hold a row after a stop
+uint64_t       start_ticks_;
+int64_t        start_ns_;
+
+int64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double ticks_per_ns()
+{
+    int64_t elapsed = now_ns() - start_ns_;
+    if (elapsed < CALIBRATION_NS)
+        std::this_thread::sleep_for(std::chrono::nanoseconds(CALIBRATION_NS - elapsed));
+    uint64_t ticks = read_tsc();
+    return double(ticks - start_ticks_) / double(now_ns() - start_ns_);
+}
+
+}
+
+void enable(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(enable_mutex_);
+    if (enabled && !histograms_)
+    {
+        histograms_ = new histogram_set();
+        for (auto& curve : histograms_->h)
+            for (auto& op : curve)
+                for (auto& h : op) h.clear();
+        start_ticks_ = read_tsc();
+        start_ns_ = now_ns();
+    }
+    active_.store(enabled ? histograms_ : nullptr, std::memory_order_release);
+}
+
+void clear()
+{
+    std::lock_guard<std::mutex> lock(enable_mutex_);
+    if (!histograms_) return;
+    for (auto& curve : histograms_->h)
+        for (auto& op : curve)
+            for (auto& h : op) h.clear();
+}
+
+uint64_t summary(unsigned curve, operation op, stage s, const double* quantiles, double* values, size_t count)
+{
+    std::lock_guard<std::mutex> lock(enable_mutex_);
+    if (!histograms_)
+    {
+        for (size_t i = 0; i < count; i++) values[i] = 0;
+        return 0;
+    }
+
+    uint64_t counts[latency_histogram::BUCKETS];
+    uint64_t total = histograms_->h[curve][op][s].copy(counts);
+    double scale = total > 0 ? 1 / ticks_per_ns() : 0;
+    for (size_t i = 0; i < count; i++)
+        values[i] = latency_histogram::percentile(counts, total, quantiles[i]) * scale;
+    return total;
+}
+
+}
+}
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include "lcfr/arch/tsc.h"
+#include "lcfr/stats/counters.h"
+#include "lcfr/stats/histogram.h"
+
+namespace lcfr {
+namespace stats {
+namespace latency {
+
+enum operation : unsigned
+{
+    SIGN,
+    VERIFY,
+    OPERATION_COUNT
+};
+
+// CALL is the whole library call, the other stages are timed inside ec_cipher
+enum stage : unsigned
+{
+    CALL,
+    HASH,
+    INVERSE,
+    SCALAR_MULT,
+    NORMALIZE,
+    FINAL,
+    STAGE_COUNT
+};
+
+struct histogram_set
+{
+    latency_histogram h[CURVE_COUNT + 1][OPERATION_COUNT][STAGE_COUNT];
+};
+
+// the histograms being recorded, nullptr while the recording is disabled
+extern std::atomic<histogram_set*> active_;
+
+/**
+  Start or stop the recording, the histograms being allocated at the first start.
+*/
+void enable(bool enabled);
+
+/**
+  Clear the histograms.
+*/
+void clear();
+
+/**
+  \param quantiles the quantiles, from 0 to 1
+  \param values the durations at the quantiles, in nanoseconds
+  \param count the number of quantiles
+  \return the number of durations recorded
+*/
+uint64_t summary(unsigned curve, operation op, stage s, const double* quantiles, double* values, size_t count);
+
+/** Records the consecutive stages of an operation, each lap closing a stage.
+* When the recording is disabled, the timer costs a load and a test per call.
+*/
+class stage_timer
+{
+public:
+    stage_timer(unsigned curve, operation op)
+    {
+        histogram_set* set = active_.load(std::memory_order_acquire);
+        row_ = set ? set->h[curve][op] : nullptr;
+        last_ = row_ ? read_tsc() : 0;
+    }
+
+    void lap(stage s)
+    {
+        if (!row_) return;
+        uint64_t now = read_tsc();
+        row_[s].record(now - last_);
+        last_ = now;
+    }
+
+    stage_timer(const stage_timer&) = delete;
+    stage_timer& operator = (const stage_timer&) = delete;
+
+private:
+    latency_histogram* row_;
+    uint64_t           last_;
+};
+
+}
+}
+}